@@ -231,6 +231,10 @@ echo "rbox 1000 W5e-4 D4 | qhull C-1e-5 Qc Tv"
 rbox 1000 W5e-4 D4 | qhull C-1e-5 Qc Tv
 echo "rbox 400 W1e-3 D5 | qhull C-1e-5 Qx Qc Tv"
 rbox 400 W1e-3 D5 | qhull C-1e-5 Qx Qc Tv
+echo "rbox 2000 s D3 C1,1e-10 | qhull Q19 Tcv"
+rbox 2000 s D3 C1,1e-10 | qhull Q19 Tcv
+echo "rbox 2000 s D3 C1,1e-10 | qhull Q19 Qc Tcv"
+rbox 2000 s D3 C1,1e-10 | qhull Q19 Qc Tcv
 
 echo === check input format etc. ${d:-`date`}
 echo "=== test long and short input to Qhull by hand, see eg/q_test ==="
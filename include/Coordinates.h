@@ -16,6 +16,9 @@
 #include <ostream>
 // Requires STL vector class.  Can use with another vector class such as QList.
 #include <vector>
+#ifdef QHULL_USES_MOVE
+#include <utility>  // std::move
+#endif
 
 namespace orgQhull {
 
@@ -26,6 +29,7 @@ namespace orgQhull {
     class Coordinates;
 
     //! Java-style iterators are not implemented for Coordinates.  std::vector has an expensive copy constructor and copy assignment.
+    //!    With QHULL_USES_MOVE, return by value and assignment from a temporary move the std::vector instead of copying it
     //!    A pointer to Coordinates is vulnerable to mysterious overwrites (e.g., deleting a returned value and reusing its memory)
     //! Qt's 'foreach' should not be used.  It makes a copy of the std::vector
 
@@ -57,12 +61,21 @@ public:
                         Coordinates(const Coordinates &other) : coordinate_array(other.coordinate_array) {}
     Coordinates &       operator=(const Coordinates &other) { coordinate_array= other.coordinate_array; return *this; }
     Coordinates &       operator=(const std::vector<coordT> &other) { coordinate_array= other; return *this; }
+#ifdef QHULL_USES_MOVE
+                        //! Moves the std::vector.  'other' is left empty
+                        Coordinates(Coordinates &&other) : coordinate_array(std::move(other.coordinate_array)) { other.coordinate_array.clear(); }
+    explicit            Coordinates(std::vector<coordT> &&other) : coordinate_array(std::move(other)) {}
+    Coordinates &       operator=(Coordinates &&other) { if(this!=&other){ coordinate_array= std::move(other.coordinate_array); other.coordinate_array.clear(); } return *this; }
+    Coordinates &       operator=(std::vector<coordT> &&other) { coordinate_array= std::move(other); return *this; }
+#endif //QHULL_USES_MOVE
                         ~Coordinates() {}
 
 #//!\name Conversion
 
 #ifndef QHULL_NO_STL
     std::vector<coordT> toStdVector() const { return coordinate_array; }
+    void                toStdVector(std::vector<coordT> *vs) const { vs->assign(coordinate_array.begin(), coordinate_array.end()); }
+    void                swap(std::vector<coordT> &other) { coordinate_array.swap(other); }
 #endif //QHULL_NO_STL
 #ifdef QHULL_USES_QT
     QList<coordT>       toQList() const;
@@ -128,6 +141,7 @@ public:
     void                removeLast() { erase(--end()); }
     void                replace(countT idx, const coordT &c) { (*this)[idx]= c; }
     void                reserve(countT i) { coordinate_array.reserve(i); }
+    void                resize(countT i) { coordinate_array.resize(i); }
     void                swap(countT idx, countT other);
     coordT              takeAt(countT idx);
     coordT              takeFirst() { return takeAt(0); }
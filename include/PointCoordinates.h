@@ -28,6 +28,7 @@ namespace orgQhull {
     class PointCoordinates;
 
     //! Java-style iterators are not implemented for PointCoordinates.  Expensive copy constructor and copy assignment for Coordinates (std::vector).
+    //!   With QHULL_USES_MOVE, the move constructor and move assignment take the coordinates of a temporary without copying them
     //! A pointer to PointCoordinates is vulnerable to mysterious overwrites (e.g., deleting a returned value and reusing its memory)
     //! 'foreach' likewise makes a copy of point_coordinates and should be avoided
 
@@ -59,6 +60,11 @@ public:
                         //! Use append() and appendPoints() for Coordinates and vector<coordT>
                         PointCoordinates(const PointCoordinates &other);
     PointCoordinates &  operator=(const PointCoordinates &other);
+#ifdef QHULL_USES_MOVE
+                        //! Moves the coordinates and comment.  'other' is left empty with the same dimension
+                        PointCoordinates(PointCoordinates &&other);
+    PointCoordinates &  operator=(PointCoordinates &&other);
+#endif //QHULL_USES_MOVE
                         ~PointCoordinates();
 
 #//!\name Convert
@@ -66,6 +72,7 @@ public:
 #ifndef QHULL_NO_STL
     void                append(const std::vector<coordT> &otherCoordinates) { if(!otherCoordinates.empty()){ append(static_cast<int>(otherCoordinates.size()), &otherCoordinates[0]); } }
     std::vector<coordT> toStdVector() const { return point_coordinates.toStdVector(); }
+    void                toStdVector(std::vector<coordT> *vs) const { point_coordinates.toStdVector(vs); }
 #endif //QHULL_NO_STL
 #ifdef QHULL_USES_QT
     void                append(const QList<coordT> &pointCoordinates) { if(!pointCoordinates.isEmpty()){ append(pointCoordinates.count(), &pointCoordinates[0]); } }
@@ -114,6 +121,7 @@ public:
     void                append(const PointCoordinates &other);
     void                appendComment(const std::string &s);
     void                appendPoints(std::istream &in);
+    coordT *            extendCoordinates(countT coordinatesCount);  //! Dimension previously defined
     PointCoordinates &  operator+=(const PointCoordinates &other) { append(other); return *this; }
     PointCoordinates &  operator+=(const coordT &c) { append(c); return *this; }
     PointCoordinates &  operator+=(const QhullPoint &p) { append(p); return *this; }
@@ -28,6 +28,11 @@ namespace orgQhull {
   #define QHULL_ASSERT
       Defined by QhullError.h
       It invokes assert()
+
+  #define QHULL_USES_MOVE
+      Defined by QhullError.h for C++11.  Define QHULL_NO_MOVE to disable
+      Move constructors and move assignment for Qhull, RboxPoints, PointCoordinates, Coordinates, and QhullVertexSet
+      Required by QhullPool
 */
 
 #//!\name Used here
@@ -55,6 +60,11 @@ public:
                         Qhull(const RboxPoints &rboxPoints, const char *qhullCommand2);
                         Qhull(const char *inputComment2, int pointDimension, int pointCount, const realT *pointCoordinates, const char *qhullCommand2);
                         ~Qhull() throw();
+#ifdef QHULL_USES_MOVE
+                        //! Moves QhullQh and the hull from 'other'.  'other' may only be destroyed or assigned
+                        Qhull(Qhull &&other);
+    Qhull &             operator=(Qhull &&other);
+#endif //QHULL_USES_MOVE
 private:                //! Disable copy constructor and assignment.  Qhull owns QhullQh.
                         Qhull(const Qhull &);
     Qhull &             operator=(const Qhull &);
@@ -117,16 +127,28 @@ public:
 
 #//!\name Methods
     double              area();
+                        //! CSR arrays from qh.facet_list without qh_fprintf (qh_extract_facets, qh_extract_voronoi).  Null vectors are skipped
+    countT              extractDelaunay(std::vector<countT> *simplices, std::vector<countT> *neighborIds= 0, std::vector<countT> *siteOffsets= 0, std::vector<countT> *siteSimplices= 0);
+    countT              extractFacets(std::vector<countT> *vertexOffsets, std::vector<countT> *vertexIds, std::vector<countT> *neighborOffsets= 0, std::vector<countT> *neighborIds= 0, std::vector<coordT> *normals= 0, bool printAll= false);
+    countT              extractVoronoi(std::vector<coordT> *voronoiVertices, std::vector<countT> *regionOffsets, std::vector<countT> *regionIds, bool printAll= false);
+    QhullFacet          locateDelaunay(const coordT *site, double *bestDist, bool *isOutside);
+    QhullFacet          locateFacet(const coordT *point, bool bestOutside, double *bestDist, bool *isOutside);
+    std::vector<QhullFacet> locateFacets(int pointDimension, int pointCount, const coordT *points, bool bestOutside, std::vector<double> *bestDists= 0);
     void                outputQhull();
     void                outputQhull(const char * outputflags);
+    void                prepareLocate(); //!< Build the point-location grid for locateFacet.  Otherwise built on first use
     void                prepareVoronoi(bool *isLower, int *voronoiVertexCount);
+    void                resetQhull();
     void                runQhull(const RboxPoints &rboxPoints, const char *qhullCommand2);
     void                runQhull(const char *inputComment2, int pointDimension, int pointCount, const realT *pointCoordinates, const char *qhullCommand2);
+    void                runQhull(const char *inputComment2, int pointDimension, int pointCount, const double *pointCoordinates, int pointStride, const char *qhullCommand2, coordT *scratchCoordinates= 0);
+    void                runQhull(const char *inputComment2, int pointDimension, int pointCount, const float *pointCoordinates, int pointStride, const char *qhullCommand2, coordT *scratchCoordinates= 0);
     double              volume();
 
 #//!\name Helpers
 private:
     void                initializeFeasiblePoint(int hulldim);
+    void                runQhullStrided(const char *inputComment2, int pointDimension, int pointCount, const void *pointCoordinates, int pointStride, bool isFloat, const char *qhullCommand2, coordT *scratchCoordinates);
 };//Qhull
 
 }//namespace orgQhull
@@ -17,6 +17,14 @@
 #include <assert.h>
 #endif
 
+//! QHULL_USES_MOVE -- defined for C++11 rvalue references (move constructors and move assignment)
+//!   Define QHULL_NO_MOVE to disable
+#if !defined(QHULL_USES_MOVE) && !defined(QHULL_NO_MOVE)
+#if __cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1600)
+#define QHULL_USES_MOVE
+#endif
+#endif
+
 namespace orgQhull {
 
 #//!\name Defined here
@@ -29,7 +37,7 @@ public:
 #//!\name Constants
     enum {
         QHULLfirstError= 10000, //MSG_QHULL_ERROR in Qhull's user.h
-        QHULLlastError= 10081,
+        QHULLlastError= 10092,
         NOthrow= 1 //! For flag to indexOf()
     };
 
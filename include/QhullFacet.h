@@ -64,6 +64,7 @@ public:
     int                 dimension() const { return (qh_qh ? qh_qh->hull_dim : 0); }
     QhullPoint          getCenter() { return getCenter(qh_PRINTpoints); }
     QhullPoint          getCenter(qh_PRINT printFormat);
+    countT              getCenter(qh_PRINT printFormat, coordT *center);
     facetT *            getBaseT() const { return getFacetT(); } //!< For QhullSet<QhullFacet>
                         // Do not define facetT().  It conflicts with return type facetT*
     facetT *            getFacetT() const { return qh_facet; }
@@ -71,7 +72,7 @@ public:
     bool                hasPrevious() const { return (qh_facet->previous != NULL); }
     QhullHyperplane     hyperplane() const { return QhullHyperplane(qh_qh, dimension(), qh_facet->normal, qh_facet->offset); }
     countT              id() const { return (qh_facet ? qh_facet->id : static_cast<countT>(qh_IDunknown)); }
-    QhullHyperplane     innerplane() const;
+    QhullHyperplane     innerplane() const; //!< Shares the coordinates of hyperplane().  Does not allocate
     bool                isValid() const { return qh_qh && qh_facet && qh_facet != &s_empty_facet; }
     bool                isGood() const { return qh_facet && qh_facet->good; }
     bool                isSimplicial() const { return qh_facet && qh_facet->simplicial; }
@@ -82,7 +83,7 @@ public:
     QhullFacet          nextFacet2d(QhullVertex *nextVertex) const;
     bool                operator==(const QhullFacet &other) const { return qh_facet==other.qh_facet; }
     bool                operator!=(const QhullFacet &other) const { return !operator==(other); }
-    QhullHyperplane     outerplane() const;
+    QhullHyperplane     outerplane() const; //!< Shares the coordinates of hyperplane().  Does not allocate
     QhullFacet          previous() const { return QhullFacet(qh_qh, qh_facet->previous); }
     QhullQh *           qh() const { return qh_qh; }
     void                setFacetT(QhullQh *qqh, facetT *facet) { qh_qh= qqh; qh_facet= facet; }
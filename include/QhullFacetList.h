@@ -55,7 +55,9 @@ public:
 #//!\name Conversion
 #ifndef QHULL_NO_STL
     std::vector<QhullFacet> toStdVector() const;
+    void                toStdVector(std::vector<QhullFacet> *vs) const;
     std::vector<QhullVertex> vertices_toStdVector() const;
+    void                vertices_toStdVector(std::vector<QhullVertex> *vs) const;
 #endif //QHULL_NO_STL
 #ifdef QHULL_USES_QT
     QList<QhullFacet>   toQList() const;
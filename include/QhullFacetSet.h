@@ -56,6 +56,7 @@ public:
 #//!\name Conversion
 #ifndef QHULL_NO_STL
     std::vector<QhullFacet> toStdVector() const;
+    void                toStdVector(std::vector<QhullFacet> *vs) const;
 #endif //QHULL_NO_STL
 #ifdef QHULL_USES_QT
     QList<QhullFacet>   toQList() const;
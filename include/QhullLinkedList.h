@@ -78,6 +78,7 @@ public:
 #//!\name Conversions
 #ifndef QHULL_NO_STL
     std::vector<T>      toStdVector() const;
+    void                toStdVector(std::vector<T> *vs) const;
 #endif
 #ifdef QHULL_USES_QT
     QList<T>            toQList() const;
@@ -223,6 +224,15 @@ toStdVector() const
     std::copy(constBegin(), constEnd(), std::back_inserter(tmp));
     return tmp;
 }//toStdVector
+
+//! Replace the contents of vs.  Reuses its capacity
+template <typename T>
+void QhullLinkedList<T>::
+toStdVector(std::vector<T> *vs) const
+{
+    vs->clear();
+    std::copy(constBegin(), constEnd(), std::back_inserter(*vs));
+}//toStdVector vs
 #endif
 
 #ifdef QHULL_USES_QT
@@ -72,6 +72,7 @@ public:
 
 #ifndef QHULL_NO_STL
     std::vector<coordT> toStdVector() const;
+    void                toStdVector(std::vector<coordT> *vs) const;
 #endif //QHULL_NO_STL
 #ifdef QHULL_USES_QT
     QList<coordT>       toQList() const;
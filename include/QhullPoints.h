@@ -63,6 +63,7 @@ public:
 
 #ifndef QHULL_NO_STL
     std::vector<QhullPoint> toStdVector() const;
+    void                toStdVector(std::vector<QhullPoint> *vs) const;
 #endif //QHULL_NO_STL
 #ifdef QHULL_USES_QT
     QList<QhullPoint>   toQList() const;
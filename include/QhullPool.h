@@ -0,0 +1,67 @@
+/****************************************************************************
+**
+** Copyright (c) 2008-2020 C.B. Barber. All rights reserved.
+** $Id: //main/2019/qhull/src/libqhullcpp/QhullPool.h#1 $$Change: 3010 $
+** $DateTime: 2020/07/30 22:14:11 $$Author: bbarber $
+**
+****************************************************************************/
+
+#ifndef QHULLPOOL_H
+#define QHULLPOOL_H
+
+#include "Qhull.h"
+
+#ifdef QHULL_USES_MOVE  // QhullPool requires C++11 for std::mutex and Qhull's move constructor
+
+#include <mutex>
+#include <vector>
+
+namespace orgQhull {
+
+#//!\name Defined here
+    //! QhullPool -- warm Qhull instances for many independent hulls, possibly from several threads
+    class QhullPool;
+
+//! A QhullPool keeps Qhull instances whose QhullQh has initialized memory with warm freelists (qh.qhmem)
+//! acquire() moves an idle Qhull out of the pool.  Each thread runs its own Qhull.
+//! release() resets the Qhull (Qhull::resetQhull) and moves it back into the pool for the next hull
+//! A Qhull that is not released (e.g., destroyed by a QhullError) is replaced by a new Qhull on demand
+//! acquire() and release() are thread-safe.  A Qhull is not thread-safe.
+class QhullPool {
+
+private:
+#//!\name Fields
+    std::vector<Qhull>  idle_qhulls;    //!< Reset Qhull with warm memory, ready for runQhull
+    std::mutex          pool_mutex;     //!< Guards idle_qhulls and the counts
+    countT              new_count;      //!< Number of Qhull constructed by acquire() when idle_qhulls was empty
+    countT              reuse_count;    //!< Number of Qhull reused by acquire()
+
+public:
+#//!\name Constructors
+                        //! Creates poolSize Qhull.  Warms each one by a hull of a hullDimension simplex.  No warm up if hullDimension is 0
+                        QhullPool(countT poolSize, int hullDimension);
+                        ~QhullPool() {}
+private:                //! Disable copy constructor and assignment.  std::mutex is not copyable
+                        QhullPool(const QhullPool &);
+    QhullPool &         operator=(const QhullPool &);
+public:
+
+#//!\name GetSet
+    countT              idleCount();
+    countT              newCount();
+    countT              reuseCount();
+
+#//!\name Methods
+    Qhull               acquire();
+    void                release(Qhull &&q);
+
+#//!\name Helpers
+private:
+    static void         warmQhull(Qhull *q, int hullDimension);
+};//class QhullPool
+
+}//namespace orgQhull
+
+#endif //QHULL_USES_MOVE
+
+#endif // QHULLPOOL_H
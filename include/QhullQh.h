@@ -103,6 +103,7 @@ public:
     double              angleEpsilon() const { return this->ANGLEround*factor_epsilon; } //!< Epsilon for hyperplane angle equality
     void                checkAndFreeQhullMemory();
     double              distanceEpsilon() const { return this->DISTround*factor_epsilon; } //!< Epsilon for distance to hyperplane
+    void                resetQhull();
 
 };//class QhullQh
 
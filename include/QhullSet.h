@@ -127,6 +127,7 @@ public:
 
 #ifndef QHULL_NO_STL
     std::vector<T> toStdVector() const;
+    void           toStdVector(std::vector<T> *vs) const;
 #endif
 #ifdef QHULL_USES_QT
     QList<typename T> toQList() const;
@@ -145,7 +146,7 @@ public:
     // Constructs T.  Cannot return reference.
     const T             back() const { return last(); }
     T                   back() { return last(); }
-    //! end element is NULL
+    //! A view of count() elements of T::base_type (e.g., facetT* for QhullSet<QhullFacet>) without a copy.  end element is NULL
     const typename T::base_type * constData() const { return reinterpret_cast<const typename T::base_type *>(beginPointer()); }
     typename T::base_type *     data() { return reinterpret_cast<typename T::base_type *>(beginPointer()); }
     const typename T::base_type *data() const { return reinterpret_cast<const typename T::base_type *>(beginPointer()); }
@@ -326,15 +327,25 @@ public:
 template <typename T>
 std::vector<T> QhullSet<T>::
 toStdVector() const
+{
+    std::vector<T> vs;
+    toStdVector(&vs);
+    return vs;
+}//toStdVector
+
+//! Replace the contents of vs.  Reuses its capacity
+template <typename T>
+void QhullSet<T>::
+toStdVector(std::vector<T> *vs) const
 {
     typename QhullSet<T>::const_iterator i= begin();
     typename QhullSet<T>::const_iterator e= end();
-    std::vector<T> vs;
+    vs->clear();
+    vs->reserve(count());
     while(i!=e){
-        vs.push_back(*i++);
+        vs->push_back(*i++);
     }
-    return vs;
-}//toStdVector
+}//toStdVector vs
 #endif //QHULL_NO_STL
 
 #ifdef QHULL_USES_QT
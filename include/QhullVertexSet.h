@@ -44,6 +44,11 @@ public:
                         //Copy constructor and assignment copies pointer but not contents.  Throws error if qhsettemp_defined.  Needed for return by value.
                         QhullVertexSet(const QhullVertexSet &other);
     QhullVertexSet &    operator=(const QhullVertexSet &other);
+#ifdef QHULL_USES_MOVE
+                        //!Move constructor and assignment transfer qhsettemp_defined.  Allows return by value of a temporary set
+                        QhullVertexSet(QhullVertexSet &&other);
+    QhullVertexSet &    operator=(QhullVertexSet &&other);
+#endif //QHULL_USES_MOVE
                         ~QhullVertexSet();
 
 private:                //!Default constructor disabled.  Will implement allocation later
@@ -56,6 +61,7 @@ public:
 #//!\name Conversion
 #ifndef QHULL_NO_STL
     std::vector<QhullVertex> toStdVector() const;
+    void                toStdVector(std::vector<QhullVertex> *vs) const;
 #endif //QHULL_NO_STL
 #ifdef QHULL_USES_QT
     QList<QhullVertex>   toQList() const;
@@ -43,6 +43,11 @@ public:
                         RboxPoints();
     explicit            RboxPoints(const char *rboxCommand);
                         ~RboxPoints();
+#ifdef QHULL_USES_MOVE
+                        //! Moves the points and the QhullQh owned by 'other'.  'other' may only be destroyed or assigned
+                        RboxPoints(RboxPoints &&other);
+    RboxPoints &        operator=(RboxPoints &&other);
+#endif //QHULL_USES_MOVE
 private:                // Disable copy constructor and assignment.  RboxPoints owns QhullQh.
                         RboxPoints(const RboxPoints &);
                         RboxPoints &operator=(const RboxPoints &);
@@ -103,6 +103,9 @@ extern "C" {
 #endif
 
 void    qh_backnormal(qhT *qh, realT **rows, int numrow, int numcol, bool sign, coordT *normal, bool *nearzero);
+int     qh_backnormal_local(qhT *qh, realT **rows, int numrow, int numcol, bool sign, coordT *normal);
+void    qh_detnormal(int dim, coordT **rows, coordT *normal);
+bool   qh_detoffset(qhT *qh, int dim, coordT **rows, coordT *point0, coordT *normal, realT *offset);
 void    qh_distplane(qhT *qh, pointT *point, facetT *facet, realT *dist);
 facetT *qh_findbest(qhT *qh, pointT *point, facetT *startfacet,
                      bool bestoutside, bool isnewfacets, bool noupper,
@@ -112,6 +115,7 @@ facetT *qh_findbesthorizon(qhT *qh, bool ischeckmax, pointT *point,
 facetT *qh_findbestnew(qhT *qh, pointT *point, facetT *startfacet, realT *dist,
                      bool bestoutside, bool *isoutside, int *numpart);
 void    qh_gausselim(qhT *qh, realT **rows, int numrow, int numcol, bool *sign, bool *nearzero);
+int     qh_gausselim_local(qhT *qh, realT **rows, int numrow, int numcol, bool *sign, bool *nearzero, realT *lastpivot);
 realT   qh_getangle(qhT *qh, pointT *vect1, pointT *vect2);
 pointT *qh_getcenter(qhT *qh, setT *vertices);
 pointT *qh_getcentrum(qhT *qh, facetT *facet);
@@ -119,9 +123,11 @@ coordT  qh_getdistance(qhT *qh, facetT *facet, facetT *neighbor, coordT *mindist
 void    qh_normalize(qhT *qh, coordT *normal, int dim, bool toporient);
 void    qh_normalize2(qhT *qh, coordT *normal, int dim, bool toporient,
             realT *minnorm, bool *ismin);
+bool   qh_normalize2_local(qhT *qh, coordT *normal, int dim, bool toporient, realT *normp);
 pointT *qh_projectpoint(qhT *qh, pointT *point, facetT *facet, realT dist);
 
 void    qh_setfacetplane(qhT *qh, facetT *newfacets);
+void    qh_setfacetplane_finish(qhT *qh, facetT *facet);
 void    qh_sethyperplane_det(qhT *qh, int dim, coordT **rows, coordT *point0,
               bool toporient, coordT *normal, realT *offset, bool *nearzero);
 void    qh_sethyperplane_gauss(qhT *qh, int dim, coordT **rows, pointT *point0,
@@ -131,8 +137,11 @@ bool   qh_sharpnewfacets(qhT *qh);
 /*========= infrequently used code in geom2_r.c =============*/
 
 coordT *qh_copypoints(qhT *qh, coordT *points, int numpoints, int dimension);
+coordT *qh_copypoints_strided(qhT *qh, const void *points, int numpoints, int dimension, int stride, bool isfloat, bool islift, coordT *newpoints);
 void    qh_crossproduct(int dim, realT vecA[3], realT vecB[3], realT vecC[3]);
 realT   qh_determinant(qhT *qh, realT **rows, int dim, bool *nearzero);
+realT   qh_determinant_fixed(realT rows[4][4], int dim);
+realT   qh_determinant_local(qhT *qh, realT **rows, int dim, bool *nearzero, bool *zeropivot, realT *lastpivot);
 realT   qh_detjoggle(qhT *qh, pointT *points, int numpoints, int dimension);
 void    qh_detmaxoutside(qhT *qh);
 void    qh_detroundoff(qhT *qh);
@@ -141,6 +150,8 @@ realT   qh_distnorm(int dim, pointT *point, pointT *normal, realT *offsetp);
 realT   qh_distround(qhT *qh, int dimension, realT maxabs, realT maxsumabs);
 realT   qh_divzero(realT numer, realT denom, realT mindenom1, bool *zerodiv);
 realT   qh_facetarea(qhT *qh, facetT *facet);
+void    qh_facetarea_all(qhT *qh, setT *facets, realT *areas);
+realT   qh_facetarea_fixed(qhT *qh, facetT *facet);
 realT   qh_facetarea_simplex(qhT *qh, int dim, coordT *apex, setT *vertices,
           vertexT *notvertex,  bool toporient, coordT *normal, realT *offset);
 pointT *qh_facetcenter(qhT *qh, setT *vertices);
@@ -148,13 +159,17 @@ facetT *qh_findgooddist(qhT *qh, pointT *point, facetT *facetA, realT *distp, fa
 vertexT *qh_furthestnewvertex(qhT *qh, unsigned int unvisited, facetT *facet, realT *maxdistp /* qh.newvertex_list */);
 vertexT *qh_furthestvertex(qhT *qh, facetT *facetA, facetT *facetB, realT *maxdistp, realT *mindistp);
 void    qh_getarea(qhT *qh, facetT *facetlist);
+void    qh_getvolume(qhT *qh, facetT *facetlist);
 bool   qh_gram_schmidt(qhT *qh, int dim, realT **rows);
 bool   qh_inthresholds(qhT *qh, coordT *normal, realT *angle);
 void    qh_joggleinput(qhT *qh);
 realT  *qh_maxabsval(realT *normal, int dim);
 setT   *qh_maxmin(qhT *qh, pointT *points, int numpoints, int dimension);
+void    qh_maxmin_parallel(qhT *qh, int numthreads, pointT *points, int numpoints, int dimension, pointT **minpoints, pointT **maxpoints);
 realT   qh_maxouter(qhT *qh);
 void    qh_maxsimplex(qhT *qh, int dim, setT *maxpoints, pointT *points, int numpoints, setT **simplex);
+int     qh_maxsimplex_parallel(qhT *qh, int numthreads, int dim, setT *maxpoints, pointT *points, int numpoints, setT *simplex,
+          realT mindet, pointT **maxpoint, realT *maxdet, bool *maxnearzero);
 realT   qh_minabsval(realT *normal, int dim);
 int     qh_mindiff(realT *vecA, realT *vecB, int dim);
 bool   qh_orientoutside(qhT *qh, facetT *facet);
@@ -172,12 +187,16 @@ void    qh_scalelast(qhT *qh, coordT *points, int numpoints, int dim, coordT low
                    coordT high, coordT newhigh);
 void    qh_scalepoints(qhT *qh, pointT *points, int numpoints, int dim,
                 realT *newlows, realT *newhighs);
+void    qh_setfacetplane_all(qhT *qh, setT *facets, int numthreads);
+bool    qh_setfacetplane_local(qhT *qh, facetT *facet, coordT **rows, coordT *buffer, realT *mindenom);
 bool   qh_sethalfspace(qhT *qh, int dim, coordT *coords, coordT **nextp,
               coordT *normal, coordT *offset, coordT *feasible);
 coordT *qh_sethalfspace_all(qhT *qh, int dim, int count, coordT *halfspaces, pointT *feasible);
+void    qh_sumkahan(realT *sum, realT *error, realT value);
 coordT  qh_vertex_bestdist(qhT *qh, setT *vertices);
 coordT  qh_vertex_bestdist2(qhT *qh, setT *vertices, vertexT **vertexp, vertexT **vertexp2);
 pointT *qh_voronoi_center(qhT *qh, int dim, setT *points);
+realT   qh_voronoi_center_fixed(qhT *qh, int dim, pointT **simplex, pointT *center);
 
 #ifdef __cplusplus
 } /* extern "C"*/
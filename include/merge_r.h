@@ -155,6 +155,7 @@ void    qh_checkconnect(qhT *qh /* qh.new_facets */);
 void    qh_checkdelfacet(qhT *qh, facetT *facet, setT *mergeset);
 void    qh_checkdelridge(qhT *qh /* qh.visible_facets, vertex_mergeset */);
 bool   qh_checkzero(qhT *qh, bool testall);
+facetT *qh_checkzero_parallel(qhT *qh, setT *newfacets, int numthreads);
 int     qh_compare_anglemerge(const void *p1, const void *p2);
 int     qh_compare_facetmerge(const void *p1, const void *p2);
 int     qh_comparevisit(const void *p1, const void *p2);
@@ -60,6 +60,137 @@
 
 /*============ -structures- ====================*/
 
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >--------------------------------</a><a name="hull3dT">-</a>
+
+  hull3dT
+    half-edge triangulation of a 3-d convex hull for 'Q19' (qh_buildhull3d)
+    half-edge 3*f+i of face f is the edge from f.vertices[i] to f.vertices[(i+1)%3]
+
+  notes:
+    allocated by qh_hull3d_new, freed by qh_hull3d_free
+    the conflict list of a face is a range of hull->points, its outside points followed by its near points
+    a deleted face is on the free list from hull->freeface, linked by f.start
+    a conflict list copies the coordinates of its points.  Partitioning reads the points in order
+    the planes of the cone of new faces are arrays of coordinates (conex..coneoffset) for vectorized distance tests
+*/
+typedef struct conflict3dT conflict3dT;
+struct conflict3dT {
+  coordT  point[3];       /* coordinates of the point */
+  int     id;             /* point id */
+};
+
+typedef struct face3dT face3dT;
+struct face3dT {
+  int     vertices[3];    /* point ids, counter-clockwise from outside */
+  int     twins[3];       /* twin of half-edge i, a half-edge of the neighboring face */
+  coordT  normal[3];      /* unit normal, pointing outside */
+  coordT  offset;         /* distance of a point is normal.point + offset */
+  int     start;          /* first point of the conflict list in hull->points, or the next free face */
+  int     numoutside;     /* number of outside points, clearly above the face */
+  int     numnear;        /* number of near points, within the near margin of the hull */
+  int     furthest;       /* point id of the furthest outside point */
+  realT   furthestdist;   /* distance of the furthest point above the face */
+  unsigned int visitid;   /* hull->visit_id if visible from the current apex */
+  bool    deleted;        /* true if the face is on the free list */
+};
+
+typedef struct hull3dT hull3dT;
+struct hull3dT {
+  coordT *coords;         /* coordinates of point id 0 */
+  face3dT *faces;         /* faces, including deleted faces */
+  int     numfaces;       /* number of faces in use or deleted */
+  int     maxfaces;       /* allocated faces */
+  int     freeface;       /* first deleted face or -1 */
+  conflict3dT *points;    /* pool of the conflict lists of the faces */
+  int     numpoints;      /* end of the conflict lists in points */
+  int     maxpoints;      /* allocated points */
+  int     livepoints;     /* number of points in the conflict lists */
+  int    *pending;        /* stack of faces that may have outside points */
+  int     numpending;     /* number of pending faces */
+  int     maxpending;     /* allocated pending */
+  int    *visible;        /* faces visible from the apex */
+  int    *frames;         /* depth-first search of the visible faces, face and edge count */
+  int    *horizon;        /* half-edges of the horizon in counter-clockwise order */
+  int    *newfaces;       /* new faces, newfaces[i] is the apex over horizon[i] */
+  int     numvisible;     /* number of visible faces */
+  int     numhorizon;     /* number of horizon half-edges and new faces */
+  int     maxcone;        /* allocated visible, frames, horizon, and newfaces */
+  coordT *conex;          /* normals and offsets of the new faces, then the horizon faces */
+  coordT *coney;
+  coordT *conez;
+  coordT *coneoffset;
+  realT  *conedists;      /* distances of a point to the cone */
+  int    *counts;         /* number of outside and near points of each new face */
+  int     maxplanes;      /* allocated conex..conedists, 2*numhorizon, and counts */
+  conflict3dT *gather;    /* points of the visible faces */
+  int    *assign;         /* 2*i for outside newfaces[i], 2*i+1 for near, -1 for inside */
+  realT  *gatherdists;    /* distance of each gathered point to its new face */
+  int     maxgather;      /* allocated gather, assign, and gatherdists */
+  int     tetra[4];       /* point ids of the initial simplex */
+  unsigned int visit_id;  /* visit id for f.visitid */
+  realT   tolout;         /* a point is outside a face if its distance is > tolout ('qh.MINoutside') */
+  realT   tolconvex;      /* a vertex is below a neighboring face if its distance is < -tolconvex */
+  realT   margin;         /* a point is near the hull if its distance is >= -margin */
+  bool    keepnear;       /* true if near points include the horizon faces, for 'Qc' and qh.KEEPnearinside */
+  int     numapex;        /* number of points added to the hull */
+};
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >--------------------------------</a><a name="pointtreeT">-</a>
+
+  pointtreeT
+    bounding-box tree of the checked points for the exhaustive check ('Tv', qh_check_points)
+    a facet skips a subtree if the subtree's box is below the facet
+
+  notes:
+    built by qh_pointtree_new, freed by qh_pointtree_free
+    nodes are in preorder.  The subtree of nodes[i] ends before nodes[nodes[i].skip]
+    a leaf has qh_POINTleaf points or less
+*/
+typedef struct pointnodeT pointnodeT;
+struct pointnodeT {
+  int     start;          /* first point of the node in tree->points */
+  int     end;            /* after the last point of the node */
+  int     skip;           /* next node after the node's subtree, node+1 for a leaf */
+};
+
+typedef struct pointtreeT pointtreeT;
+struct pointtreeT {
+  pointT **points;        /* checked points, each node is a range of points */
+  pointnodeT *nodes;      /* nodes in preorder, nodes[0] is the root */
+  coordT *boxes;          /* low and high coordinates of each node, 2*hull_dim per node */
+  int     numpoints;      /* number of points in the tree */
+  int     maxpoints;      /* allocated points */
+  int     numnodes;       /* number of nodes in the tree */
+  int     maxnodes;       /* allocated nodes and boxes */
+};
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >--------------------------------</a><a name="queryT">-</a>
+
+  queryT
+    scratch state for read-only queries of a finished hull (qh_query_locate)
+    one queryT per thread.  The hull may not change while queries exist
+
+  notes:
+    allocated by qh_query_new, freed by qh_query_free before qh_freeqhull
+    replaces qh.visit_id, facet->visitid, and qh.coplanarfacetset
+*/
+typedef struct queryT queryT;
+struct queryT {
+  unsigned int facet_id;  /* qh.facet_id at qh_query_new, queries fail if the hull changed */
+  unsigned int visit_id;  /* last visit id for visitids */
+  unsigned int *visitids; /* visit id of each facet, indexed by facet->id */
+  facetT **searchset;     /* stack of facets for the horizon search, up to qh.num_facets */
+  int     searchsize;     /* number of elements in searchset, qh.num_facets+1 at qh_query_alloc */
+  coordT *point;          /* point lifted to the paraboloid by qh_query_lift */
+  realT   lastscale;      /* scale for the last coordinate ('Qbb'), from qh.last_low, etc. */
+  realT   lastshift;      /* shift for the last coordinate */
+  bool    isscalelast;    /* true if qh_query_lift scales the last coordinate */
+  int     numpart;        /* number of distance tests by the last query */
+};
+
 /*=========== -macros- =========================*/
 
 /*-<a                             href="qh-poly_r.htm#TOC"
@@ -233,6 +364,7 @@ bool   qh_matchvertices(qhT *qh, int firstindex, setT *verticesA, int skipA,
 facetT *qh_newfacet(qhT *qh);
 ridgeT *qh_newridge(qhT *qh);
 int     qh_pointid(qhT *qh, pointT *point);
+ptr_intT qh_pointid_input(qhT *qh, pointT *point);
 void    qh_removefacet(qhT *qh, facetT *facet);
 void    qh_removevertex(qhT *qh, vertexT *vertex);
 void    qh_update_vertexneighbors(qhT *qh);
@@ -243,11 +375,17 @@ void    qh_update_vertexneighbors_cone(qhT *qh);
 
 bool   qh_addfacetvertex(qhT *qh, facetT *facet, vertexT *newvertex);
 void    qh_addhash(void *newelem, setT *hashtable, int hashsize, int hash);
+bool   qh_buildhull2d(qhT *qh, pointT *points, int numpoints);
+bool   qh_buildhull3d(qhT *qh, pointT *points, int numpoints);
 void    qh_check_bestdist(qhT *qh);
+realT   qh_check_facetpoints(qhT *qh, pointtreeT *tree, facetT *facet, realT maxoutside, int *numdist, bool *isoutside);
 void    qh_check_maxout(qhT *qh);
+void    qh_check_maxoutpoints(qhT *qh, setT *facets, int numthreads, facetT **bestfacets, realT *dists, int *numpart);
+void    qh_check_minvertex(qhT *qh, int numthreads, realT *mindist, vertexT **minvertex, facetT **minfacet);
 void    qh_check_output(qhT *qh);
 void    qh_check_point(qhT *qh, pointT *point, facetT *facet, realT *maxoutside, realT *maxdist, facetT **errfacet1, facetT **errfacet2, int *errcount);
 void    qh_check_points(qhT *qh);
+void    qh_check_pointtree(qhT *qh, realT maxoutside, bool testouter, realT *maxdists, bool *isoutsides);
 void    qh_checkconvex(qhT *qh, facetT *facetlist, int fault);
 void    qh_checkfacet(qhT *qh, facetT *facet, bool newmerge, bool *waserrorp);
 void    qh_checkflipped_all(qhT *qh, facetT *facetlist);
@@ -255,12 +393,15 @@ bool   qh_checklists(qhT *qh, facetT *facetlist);
 void    qh_checkpolygon(qhT *qh, facetT *facetlist);
 void    qh_checkvertex(qhT *qh, vertexT *vertex, bool allchecks, bool *waserrorp);
 void    qh_clearcenters(qhT *qh, qh_CENTER type);
+int     qh_compare_point2d(const void *p1, const void *p2);
 void    qh_createsimplex(qhT *qh, setT *vertices);
 void    qh_delridge(qhT *qh, ridgeT *ridge);
 void    qh_delvertex(qhT *qh, vertexT *vertex);
 setT   *qh_facet3vertex(qhT *qh, facetT *facet);
 facetT *qh_findbestfacet(qhT *qh, pointT *point, bool bestoutside,
            realT *bestdist, bool *isoutside);
+facetT *qh_findbestfacet_start(qhT *qh, pointT *point, facetT *startfacet, bool bestoutside,
+           realT *bestdist, bool *isoutside, int *numpart);
 facetT *qh_findbestlower(qhT *qh, facetT *upperfacet, pointT *point, realT *bestdistp, int *numpart);
 facetT *qh_findfacet_all(qhT *qh, pointT *point, bool noupper, realT *bestdist, bool *isoutside,
                           int *numpart);
@@ -268,11 +409,30 @@ int     qh_findgood(qhT *qh, facetT *facetlist, int goodhorizon);
 void    qh_findgood_all(qhT *qh, facetT *facetlist);
 void    qh_furthestnext(qhT *qh /* qh.facet_list */);
 void    qh_furthestout(qhT *qh, facetT *facet);
+bool   qh_hull3d_addpoint(qhT *qh, hull3dT *hull, int face);
+void    qh_hull3d_delface(hull3dT *hull, int face);
+realT   qh_hull3d_dist(hull3dT *hull, int id, face3dT *face);
+void    qh_hull3d_free(qhT *qh, hull3dT *hull);
+void    qh_hull3d_growcone(qhT *qh, hull3dT *hull, int numframes);
+void    qh_hull3d_growgather(qhT *qh, hull3dT *hull, int numgather);
+bool   qh_hull3d_horizon(qhT *qh, hull3dT *hull, int apex, int face);
+bool   qh_hull3d_makefacets(qhT *qh, hull3dT *hull);
+hull3dT *qh_hull3d_new(qhT *qh, pointT *points, int numpoints);
+int     qh_hull3d_newface(qhT *qh, hull3dT *hull, int a, int b, int c);
+void    qh_hull3d_partition(qhT *qh, hull3dT *hull, int numgather, int numhorizon);
+void   *qh_hull3d_realloc(qhT *qh, void *array, int oldsize, int newsize, int copysize);
+void    qh_hull3d_reserve(qhT *qh, hull3dT *hull, int numpoints);
+bool   qh_hull3d_simplex(qhT *qh, hull3dT *hull, int numpoints);
 void    qh_infiniteloop(qhT *qh, facetT *facet);
 void    qh_initbuild(qhT *qh);
 void    qh_initialhull(qhT *qh, setT *vertices);
 setT   *qh_initialvertices(qhT *qh, int dim, setT *maxpoints, pointT *points, int numpoints);
 vertexT *qh_isvertex(pointT *point, setT *vertices);
+void    qh_locate_build(qhT *qh);
+int     qh_locate_cell(qhT *qh, pointT *point);
+void    qh_locate_free(qhT *qh);
+facetT *qh_locatefacet(qhT *qh, pointT *point, bool bestoutside,
+           realT *bestdist, bool *isoutside);
 vertexT *qh_makenewfacets(qhT *qh, pointT *point /* qh.horizon_list, visible_list */);
 coordT  qh_matchdupridge(qhT *qh, facetT *atfacet, int atskip, int hashsize, int *hashcount);
 void    qh_nearcoplanar(qhT *qh /* qh.facet_list */);
@@ -286,13 +446,32 @@ void    qh_outcoplanar(qhT *qh /* qh.facet_list */);
 pointT *qh_point(qhT *qh, int id);
 void    qh_point_add(qhT *qh, setT *set, pointT *point, void *elem);
 setT   *qh_pointfacet(qhT *qh /* qh.facet_list */);
+void    qh_pointtree_free(qhT *qh, pointtreeT **treep);
+pointtreeT *qh_pointtree_new(qhT *qh);
+void    qh_pointtree_select(pointT **points, int start, int end, int nth, int k);
+void    qh_pointtree_split(qhT *qh, pointtreeT *tree, int start, int end);
 setT   *qh_pointvertex(qhT *qh /* qh.facet_list */);
 void    qh_prependfacet(qhT *qh, facetT *facet, facetT **facetlist);
 void    qh_printhashtable(qhT *qh, FILE *fp);
 void    qh_printlists(qhT *qh);
+queryT *qh_query_alloc(qhT *qh);
+facetT *qh_query_findall(qhT *qh, queryT *query, pointT *point, bool noupper, realT *bestdist, bool *isoutside);
+facetT *qh_query_findbest(qhT *qh, queryT *query, pointT *point, facetT *startfacet,
+           bool bestoutside, bool noupper, realT *dist, bool *isoutside);
+facetT *qh_query_findhorizon(qhT *qh, queryT *query, bool ischeckmax, pointT *point, facetT *startfacet,
+           bool noupper, realT *bestdist, int *numpart, realT *maxoutsides);
+facetT *qh_query_findlower(qhT *qh, queryT *query, facetT *upperfacet, pointT *point, realT *bestdist);
+void    qh_query_free(qhT *qh, queryT **queryp);
+pointT *qh_query_lift(qhT *qh, queryT *query, pointT *site);
+facetT *qh_query_locate(qhT *qh, queryT *query, pointT *point, bool bestoutside,
+           realT *bestdist, bool *isoutside);
+void    qh_query_locate_all(qhT *qh, int dim, int numpoints, coordT *points, bool bestoutside,
+           facetT **bestfacets, realT *bestdists, bool *isoutsides);
+queryT *qh_query_new(qhT *qh);
 void    qh_replacefacetvertex(qhT *qh, facetT *facet, vertexT *oldvertex, vertexT *newvertex);
 void    qh_resetlists(qhT *qh, bool stats, bool resetVisible /* qh.newvertex_list qh.newfacet_list qh.visible_list */);
 void    qh_setvoronoi_all(qhT *qh);
+bool    qh_setvoronoi_parallel(qhT *qh);
 void    qh_triangulate(qhT *qh /* qh.facet_list */);
 void    qh_triangulate_facet(qhT *qh, facetT *facetA, vertexT **first_vertex);
 void    qh_triangulate_link(qhT *qh, facetT *oldfacetA, facetT *facetA, facetT *oldfacetB, facetT *facetB);
@@ -468,6 +468,8 @@ struct qhT {
                              for improving precision in Delaunay triangulations */
   bool AVOIDold;         /* true 'Q4' if avoid old->new merges */
   bool BESToutside;      /* true 'Qf' if partition points into best outsideset */
+  bool BUILD2d;          /* true 'Q18' if qh_initbuild constructs 2-d convex hulls with qh_buildhull2d */
+  bool BUILD3d;          /* true 'Q19' if qh_initbuild constructs 3-d convex hulls with qh_buildhull3d */
   bool CDDinput;         /* true 'Pc' if input uses CDD format (1.0/offset first) */
   bool CDDoutput;        /* true 'PC' if print normals in CDD format (offset first) */
   bool CHECKduplicates;  /* true 'Q15' if qh_maybe_duplicateridges after each qh_mergefacet */
@@ -511,6 +513,7 @@ struct qhT {
   bool NOpremerge;       /* true 'Q0' if no defaults for C-0 or Qx */
   bool ONLYgood;         /* true 'Qg' if process points with good visible or horizon facets */
   bool ONLYmax;          /* true 'Qm' if only process points that increase max_outside */
+  int   PARALLELthreads;  /* 'QPn' max threads for parallel sections, 0 for OpenMP default, 1 for serial (qh_PARALLEL) */
   bool PICKfurthest;     /* true 'Q9' if process furthest of furthest points*/
   bool POSTmerge;        /* true if merging after buildhull ('Cn' or 'An') */
   bool PREmerge;         /* true if merging during buildhull ('C-n' or 'A-n') */
@@ -527,6 +530,7 @@ struct qhT {
   bool PRINToptions1st;  /* true 'FO' if printing options to stderr */
   bool PRINTouter;       /* true 'Go' if printing outer planes */
   bool PRINTprecision;   /* false 'Pp' if not reporting precision problems */
+  bool PRINTprofile;     /* true 'Tj' if printing a JSON profile of wall-clock time by phase to stderr */
   qh_PRINT PRINTout[qh_PRINTEND]; /* list of output formats to print */
   bool PRINTridges;      /* true 'Gr' if print ridges */
   bool PRINTspheres;     /* true 'Gv' if print vertices as spheres */
@@ -544,6 +548,7 @@ struct qhT {
   int   REPORTfreq;       /* 'TFn' buildtracing reports every n facets */
   int   REPORTfreq2;      /* tracemerging reports every REPORTfreq/2 facets */
   int   RERUN;            /* 'TRn' rerun qhull n times (qh.build_cnt) */
+  bool REUSEsimplex;     /* true 'Q16' if a 'QJ' restart reuses the initial simplex, qh.restart_simplex */
   int   ROTATErandom;     /* 'QRn' n<-1 random seed, n==-1 time is seed, n==0 random rotation by time, n>0 rotate input */
   bool SCALEinput;       /* true 'Qbk' if scaling input */
   bool SCALElast;        /* true 'Qbb' if scale last coord to max prev coord */
@@ -588,6 +593,7 @@ struct qhT {
   bool POINTSmalloc;     /*   true if qh.first_point/num_points allocated */
   pointT *input_points;   /* copy of original qh.first_point for input points for qh_joggleinput */
   bool input_malloc;     /* true if qh.input_points malloc'd */
+  ptr_intT *input_ids;   /* if not NULL, index in the input file of each qh.first_point (qh_new_qhull_outofcore) */
   char  qhull_command[256];/* command line that invoked this program */
   int   qhull_commandsiz2; /*    size of qhull_command at qh_clear_outputflags */
   char  rbox_command[256]; /* command line that produced the input points */
@@ -715,8 +721,20 @@ struct qhT {
 */
   unsigned long hulltime; /* ignore time to set up input and randomize */
                           /*   use 'unsigned long' to avoid wrap-around errors */
+  double profile_time[qh_PHASEend]; /* 'Tj' wall-clock seconds for each qh_PHASE, see qh_profilephase */
+  double profile_start;   /* 'Tj' wall-clock time when qh.profile_phase started */
+  int   profile_phase;    /* current qh_PHASE for 'Tj' */
+  double *profile_addtime; /* 'Tj' wall-clock seconds for each qh_addpoint by qh_buildhull, qh_malloc */
+  int   profile_addcount; /* number of qh.profile_addtime */
+  int   profile_addsize;  /* allocated size of qh.profile_addtime */
+  bool  PERFactive;       /* true if qh_perfstart opened the hardware counters of qh_PERFCOUNTERS */
+  int   perf_fd[qh_PERFend]; /* perf_event_open file descriptor for each qh_PERF, or -1.  perf_fd[qh_PERFcycles] leads the group */
+  long long perf_last[qh_PERFend]; /* counter values at the last qh_profilephase */
+  long long perf_count[qh_PHASEend][qh_PERFend]; /* hardware counts for each qh_PHASE, see qh_printperfcounters */
   bool ALLOWrestart;     /* true if qh_joggle_restart can use qh.restartexit */
   int   build_cnt;        /* number of calls to qh_initbuild */
+  double build_start;     /* qh_wallclock() at the start of the current build, for Wretrytime */
+  setT *restart_simplex;  /* 'Q16' points of the last initial simplex, see qh_initialvertices */
   qh_CENTER CENTERtype;   /* current type of facet->center, qh_CENTER */
   int   furthest_id;      /* pointid of furthest point, for tracing */
   int   last_errcode;     /* last errcode from qh_fprintf, reset in qh_build_withrestart */
@@ -724,6 +742,7 @@ struct qhT {
   pointT *coplanar_apex;  /* last apex declared a coplanar point by qh_getpinchedmerges, prevents infinite loop */
   bool hasAreaVolume;    /* true if totarea, totvol was defined by qh_getarea */
   bool hasTriangulation; /* true if triangulation created by qh_triangulate */
+  bool hasVolume;        /* true if totvol was defined by qh_getarea or qh_getvolume */
   bool isRenameVertex;   /* true during qh_merge_pinchedvertices, disables duplicate ridge vertices in qh_checkfacet */
   realT JOGGLEmax;        /* set 'QJn' if randomly joggle input. 'QJ'/'QJ0.0' sets default (qh_detjoggle) */
   bool maxoutdone;       /* set qh_check_maxout(), cleared by qh_addpoint() */
@@ -788,6 +807,21 @@ struct qhT {
   coordT *half_space;     /* malloc'd input array for halfspace (qh.normal_size+coordT) */
   coordT *temp_malloc;    /* malloc'd input array for points */
 
+/*-<a                             href="qh-globa_r.htm#TOC"
+  >--------------------------------</a><a name="qh-locate">-</a>
+
+  qh point-location grid
+    start facets for qh_locatefacet, built by qh_locate_build
+    stale if qh.facet_id changes, e.g., after qh_addpoint or qh_triangulate
+*/
+  facetT **locate_grid;   /* qh_memalloc'd start facet for each grid cell, or NULL */
+  int   locate_cells;     /* number of cells in locate_grid */
+  int   locate_dim;       /* number of indexed coordinates, at most qh_LOCATEdim */
+  int   locate_size[qh_LOCATEdim];  /* number of cells for each coordinate */
+  realT locate_low[qh_LOCATEdim];   /* low bound of each coordinate */
+  realT locate_scale[qh_LOCATEdim]; /* cells per unit of each coordinate, 0 if one cell */
+  unsigned int locate_facetid; /* qh.facet_id for locate_grid, 0 if not built */
+
 /*-<a                             href="qh-globa_r.htm#TOC"
   >--------------------------------</a><a name="qh-static">-</a>
 
@@ -829,6 +863,11 @@ struct qhT {
   char    jmpXtra3[40];   /* extra bytes in case jmp_buf is defined wrong by compiler */
   int     rbox_isinteger;
   double  rbox_out_offset;
+  bool    rbox_isbuffer;  /* true if qh_rboxbuffer.  qh_out1.. store coordinates at rbox_outbuf instead of printing them */
+  coordT *rbox_outbuf;    /*   next coordinate for qh_rboxbuffer, NULL if only counting points */
+  coordT *rbox_outend;    /*   end of rbox_outbuf */
+  int     rbox_outdim;    /*   dimension of points for qh_rboxbuffer */
+  countT  rbox_outcount;  /*   number of points for qh_rboxbuffer */
   void *  cpp_object;     /* C++ pointer.  Currently used by RboxPoints.qh_fprintf_rbox */
   void *  cpp_other;      /* C++ pointer.  Reserved for other users */
   void *  cpp_user;       /* C++ pointer.  Currently used by QhullUser.qh_fprintf */
@@ -1100,6 +1139,13 @@ void    qh_errexit(qhT *qh, int exitcode, facetT *facet, ridgeT *ridge);
 void    qh_errprint(qhT *qh, const char* string, facetT *atfacet, facetT *otherfacet, ridgeT *atridge, vertexT *atvertex);
 int     qh_new_qhull(qhT *qh, int dim, int numpoints, coordT *points, bool ismalloc,
                 char *qhull_cmd, FILE *outfile, FILE *errfile);
+int     qh_new_qhull_outofcore(qhT *qh, int dim, FILE *pointfile, size_t memlimit,
+                char *qhull_cmd, FILE *outfile, FILE *errfile);
+int     qh_outofcore_checkflags(qhT *qh, char *qhull_cmd, FILE *errfile);
+int     qh_outofcore_chunk(qhT *qh, int dim, coordT *points, ptr_intT *ids, ptr_intT firstid, int count,
+                FILE *coordfile, FILE *idfile, FILE *chunkerr, FILE *errfile, int *numkept);
+void   *qh_outofcore_map(qhT *qh, FILE *fp, ptr_intT offset, ptr_intT size, void **map, size_t *length);
+void    qh_outofcore_unmap(qhT *qh, void *map, size_t length);
 void    qh_printfacetlist(qhT *qh, facetT *facetlist, setT *facets, bool printall);
 void    qh_printhelp_degenerate(qhT *qh, FILE *fp);
 void    qh_printhelp_internal(qhT *qh, FILE *fp);
@@ -1157,6 +1203,7 @@ void    qh_initqhull_start2(qhT *qh, FILE *infile, FILE *outfile, FILE *errfile)
 void    qh_initthresholds(qhT *qh, char *command);
 void    qh_lib_check(int qhullLibraryType, int qhTsize, int vertexTsize, int ridgeTsize, int facetTsize, int setTsize, int qhmemTsize);
 void    qh_option(qhT *qh, const char *option, int *i, realT *r);
+int     qh_parallelthreads(qhT *qh, int count);
 void    qh_zero(qhT *qh, FILE *errfile);
 
 /***** -io_r.c prototypes (duplicated from io_r.h) ***********************/
@@ -1184,11 +1231,13 @@ vertexT *qh_nearvertex(qhT *qh, facetT *facet, pointT *point, realT *bestdistp);
 pointT *qh_point(qhT *qh, int id);
 setT   *qh_pointfacet(qhT *qh /* qh.facet_list */);
 int     qh_pointid(qhT *qh, pointT *point);
+ptr_intT qh_pointid_input(qhT *qh, pointT *point);
 setT   *qh_pointvertex(qhT *qh /* qh.facet_list */);
 void    qh_setvoronoi_all(qhT *qh);
 void    qh_triangulate(qhT *qh /* qh.facet_list */);
 
 /********* -rboxlib_r.c prototypes **********************/
+int     qh_rboxbuffer(qhT *qh, char* rbox_command, coordT *points, countT maxcoords, int *dimension, countT *numpoints);
 int     qh_rboxpoints(qhT *qh, char* rbox_command);
 void    qh_errexit_rbox(qhT *qh, int exitcode);
 
@@ -65,8 +65,8 @@ Code flags --
   See QhullError.h for 10000 error codes.
   Cannot use '0031' since it would be octal
 
-  def counters =  [31/32/33/38, 1067, 2113, 3079, 4097, 5006,
-     6429, 7027/7028/7035/7068/7070/7102, 8163, 9428, 10000, 11034]
+  def counters =  [31/32/33/38, 1081, 2129, 3080, 4099, 5006,
+     6460, 7027/7028/7035/7068/7070/7104, 8163, 9455, 10000, 11034]
 
   See: qh_ERR* [libqhull.h]
 */
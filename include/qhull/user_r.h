@@ -64,8 +64,8 @@ Code flags --
   See QhullError.h for 10000 error codes.
   Cannot use '0031' since it would be octal
 
-  def counters =  [31/32/33/38, 1067, 2113, 3079, 4097, 5006,
-     6429, 7027/7028/7035/7068/7070/7102, 8163, 9428, 10000, 11034]
+  def counters =  [31/32/33/38, 1081, 2129, 3080, 4099, 5006,
+     6460, 7027/7028/7035/7068/7070/7104, 8163, 9455, 10000, 11034]
 
   See: qh_ERR* [libqhull_r.h]
 */
@@ -625,6 +625,149 @@ try twice at the original value in case of bad luck the first time
   #define qh_NOtrace
 */
 
+/*-<a                             href="qh-user_r.htm#TOC"
+  >--------------------------------</a><a name="PARALLEL">-</a>
+
+  qh_PARALLEL
+    =1 to run selected loops of libqhull_r in parallel with OpenMP
+    defined by default if compiled with OpenMP (gcc/clang -fopenmp, MSVC /openmp)
+
+  notes:
+    option 'QPn' sets the maximum number of threads (qh.PARALLELthreads)
+      'QP1' is serial, 'QP0' or no option uses the OpenMP default (omp_get_max_threads)
+    qh_parallelthreads() returns 1 (serial) if tracing ('Tn') or fewer than qh_PARALLELmin items
+    parallel sections may not call qh_errexit, qh_memalloc, or qh_settemp
+    parallel results are the same as serial results
+
+  see:
+    <a href="global_r.c#parallelthreads">qh_parallelthreads</a> in global_r.c
+*/
+#ifndef qh_PARALLEL
+#ifdef _OPENMP
+#define qh_PARALLEL 1
+#else
+#define qh_PARALLEL 0
+#endif
+#endif
+
+/*-<a                             href="qh-user_r.htm#TOC"
+  >--------------------------------</a><a name="PERFCOUNTERS">-</a>
+
+  qh_PERFCOUNTERS
+    =1 to sample Linux hardware counters (perf_event_open) by qh_PHASE for 'Ts' and 'Tj'
+    default 0.  Ignored if not Linux.
+
+  notes:
+    counts cycles, instructions, last-level cache misses, and branch misses in user mode
+    counts the calling thread only.  Parallel sections of 'QPn' are not counted.
+    if the kernel does not allow the counters (e.g., perf_event_paranoid), reports warning 7103
+    qh_printstatistics ('Ts') prints a table, qh_printprofile ('Tj') adds "hardware"
+    CMake option -DWITH_PERFCOUNTERS=ON defines qh_PERFCOUNTERS=1
+
+  see:
+    <a href="stat_r.c#perfstart">qh_perfstart</a> in stat_r.c
+*/
+#ifndef qh_PERFCOUNTERS
+#define qh_PERFCOUNTERS 0
+#endif
+#if qh_PERFCOUNTERS && !defined(__linux__)
+#undef qh_PERFCOUNTERS
+#define qh_PERFCOUNTERS 0
+#endif
+
+/*-<a                             href="qh-user_r.htm#TOC"
+  >--------------------------------</a><a name="MMAP">-</a>
+
+  qh_MMAP
+    =1 if qh_new_qhull_outofcore maps its point and chunk files with mmap()
+    =0 if it reads each chunk into memory with fread()
+    defined by default for Unix and macOS
+
+  notes:
+    chunks are mapped MAP_PRIVATE, so qhull does not modify the files
+    without mmap, Windows uses 64-bit file offsets (_fseeki64/_ftelli64)
+      other systems use fseek/ftell, so files are limited to 2 GB if 'long' is 32-bits
+    files are limited to 2 GB for 32-bit code (ptr_intT)
+
+  see:
+    <a href="user_r.c#outofcore_map">qh_outofcore_map</a> in user_r.c
+*/
+#ifndef qh_MMAP
+#if defined(__unix__) || defined(__APPLE__)
+#define qh_MMAP 1
+#else
+#define qh_MMAP 0
+#endif
+#endif
+
+/*-<a                             href="qh-user_r.htm#TOC"
+  >--------------------------------</a><a name="PARALLELmin">-</a>
+
+  qh_PARALLELmin
+    minimum number of items (facets, vertices, points) for a parallel loop
+
+  notes:
+    smaller loops are run serially since thread startup dominates
+*/
+#define qh_PARALLELmin 1000
+
+/*-<a                             href="qh-user_r.htm#TOC"
+  >--------------------------------</a><a name="LOCATEdim">-</a>
+
+  qh_LOCATEdim
+    maximum number of coordinates indexed by the point-location grid (qh_locate_build)
+
+  qh_LOCATEvertices
+    average number of vertices per grid cell
+
+  notes:
+    for Delaunay triangulations, the grid indexes the input sites (hull_dim-1 coordinates)
+    higher dimensions use the first qh_LOCATEdim coordinates
+*/
+#define qh_LOCATEdim 8
+#define qh_LOCATEvertices 2
+
+/*-<a                             href="qh-user_r.htm#TOC"
+  >--------------------------------</a><a name="POINTleaf">-</a>
+
+  qh_POINTleaf
+    maximum number of points in a leaf of the bounding-box tree for 'Tv' (qh_pointtree_new)
+
+  notes:
+    qh_check_points skips a leaf or subtree if its box is below a facet
+    smaller leaves skip more points but test more boxes
+*/
+#define qh_POINTleaf 32
+
+/*-<a                             href="qh-user_r.htm#TOC"
+  >--------------------------------</a><a name="HULL3Dsliver">-</a>
+
+  qh_HULL3Dsliver
+    'Q19' defers a point if a new face is a sliver whose distance error may exceed
+    qh_HULL3Dsliver times the convexity tolerance of the half-edge hull
+
+  notes:
+    the error bound is the 3-d minnorm of qh_sethyperplane_det, 1.8 u M_a M_d M_d / norm
+    the bound is pessimistic.  Random and cospherical points have few faces above 10 times the tolerance
+    a sliver below this bound may still be non-convex for qh_setfacetplane.  If so,
+      qh_hull3d_makefacets deletes the hull, and qhull builds the hull without 'Q19'
+*/
+#define qh_HULL3Dsliver 1000.0
+
+/*-<a                             href="qh-user_r.htm#TOC"
+  >--------------------------------</a><a name="OUTOFCOREpoint">-</a>
+
+  qh_OUTOFCOREpoint
+    estimated bytes of qhull memory per point of a 2-d chunk for qh_new_qhull_outofcore
+    multiplied by 3 for each dimension above 2
+
+  notes:
+    the worst case is cospherical points.  Their short memory ('Ts') is about
+      280, 500, 1700, and 8400 bytes per point in 2-d through 5-d
+    random points in a cube use much less
+*/
+#define qh_OUTOFCOREpoint 300
+
 #if 0  /* sample code */
     exitcode= qh_new_qhull(qhT *qh, dim, numpoints, points, ismalloc,
                       flags, outfile, errfile);
@@ -75,6 +75,22 @@ qh_RIDGE;
 */
 typedef void (*printvridgeT)(qhT *qh, FILE *fp, vertexT *vertex, vertexT *vertexA, setT *centers, bool unbounded);
 
+/*-<a                             href="qh-io_r.htm#TOC"
+  >-------------------------------</a><a name="vridgeT">-</a>
+
+  vridgeT
+    an input site and a Voronoi vertex (facet) of a Delaunay edge from atvertex
+    scratch memory for qh_eachvoronoi_site
+*/
+typedef struct vridgeT vridgeT;
+
+struct vridgeT {
+  vertexT *vertex;  /* input site of a Delaunay edge from atvertex */
+  facetT  *facet;   /* selected neighbor of atvertex that contains vertex */
+  int      next;    /* next vridgeT for vertex, or -1 */
+  int      last;    /* last vridgeT for vertex, if first vridgeT for vertex */
+};
+
 /*============== -prototypes in alphabetical order =========*/
 
 #ifdef __cplusplus
@@ -95,14 +111,23 @@ setT   *qh_detvridge(qhT *qh, vertexT *vertex);
 setT   *qh_detvridge3(qhT *qh, vertexT *atvertex, vertexT *vertex);
 int     qh_eachvoronoi(qhT *qh, FILE *fp, printvridgeT printvridge, vertexT *atvertex, bool visitall, qh_RIDGE innerouter, bool inorder);
 int     qh_eachvoronoi_all(qhT *qh, FILE *fp, printvridgeT printvridge, bool isUpper, qh_RIDGE innerouter, bool inorder);
+int     qh_eachvoronoi_edges(qhT *qh, FILE *fp, printvridgeT printvridge, setT *vertices, qh_RIDGE innerouter, bool inorder);
+int     qh_eachvoronoi_site(qhT *qh, FILE *fp, printvridgeT printvridge, vertexT *atvertex, int *vertexorder,
+             vridgeT *vridges, int *sites, setT *centers, facetT **ring, qh_RIDGE innerouter, bool inorder);
+int     qh_extract_count(qhT *qh, bool printall, int *numvertexidsp, int *numneighborsp);
+void    qh_extract_delaunay(qhT *qh, int *simplices, int *neighbors, int *siteoffsets, int *sitesimplices);
+void    qh_extract_facets(qhT *qh, int *vertexoffsets, int *vertexids, int *neighboroffsets, int *neighbors, coordT *normals);
+int     qh_extract_voronoi(qhT *qh, bool printall, coordT *centers, int *regionoffsets, int *regionids, int *numcentersp, int *numregionidsp);
 void    qh_facet2point(qhT *qh, facetT *facet, pointT **point0, pointT **point1, realT *mindist);
 setT   *qh_facetvertices(qhT *qh, facetT *facetlist, setT *facets, bool allfacets);
 void    qh_geomplanes(qhT *qh, facetT *facet, realT *outerplane, realT *innerplane);
 void    qh_markkeep(qhT *qh, facetT *facetlist);
 setT   *qh_markvoronoi(qhT *qh, facetT *facetlist, setT *facets, bool printall, bool *isLowerp, int *numcentersp);
 void    qh_order_vertexneighbors(qhT *qh, vertexT *vertex);
+void    qh_ordervridge3(qhT *qh, vertexT *vertex, facetT **ring, int numring, setT *centers);
 void    qh_prepare_output(qhT *qh);
 void    qh_printafacet(qhT *qh, FILE *fp, qh_PRINT format, facetT *facet, bool printall);
+void    qh_printafacet2(qhT *qh, FILE *fp, qh_PRINT format, facetT *facet);
 void    qh_printbegin(qhT *qh, FILE *fp, qh_PRINT format, facetT *facetlist, setT *facets, bool printall);
 void    qh_printcenter(qhT *qh, FILE *fp, qh_PRINT format, const char *string, facetT *facet);
 void    qh_printcentrum(qhT *qh, FILE *fp, facetT *facet, realT radius);
@@ -128,6 +153,7 @@ void    qh_printfacetNvertex_simplicial(qhT *qh, FILE *fp, facetT *facet, qh_PRI
 void    qh_printfacetheader(qhT *qh, FILE *fp, facetT *facet);
 void    qh_printfacetridges(qhT *qh, FILE *fp, facetT *facet);
 void    qh_printfacets(qhT *qh, FILE *fp, qh_PRINT format, facetT *facetlist, setT *facets, bool printall);
+bool    qh_printfacets_parallel(qhT *qh, FILE *fp, qh_PRINT format, facetT *facetlist, setT *facets, bool printall);
 void    qh_printhyperplaneintersection(qhT *qh, FILE *fp, facetT *facet1, facetT *facet2,
                    setT *vertices, realT color[3]);
 void    qh_printline3geom(qhT *qh, FILE *fp, pointT *pointA, pointT *pointB, realT color[3]);
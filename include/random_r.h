@@ -25,6 +25,7 @@ extern "C" {
 int     qh_argv_to_command(int argc, char *argv[], char* command, int max_size);
 int     qh_argv_to_command_size(int argc, char *argv[]);
 int     qh_rand(qhT *qh);
+int     qh_randcounter(int seed, int index, int draw);
 void    qh_srand(qhT *qh, int seed);
 realT   qh_randomfactor(qhT *qh, realT scale, realT offset);
 void    qh_randommatrix(qhT *qh, realT *buffer, int dim, realT **row);
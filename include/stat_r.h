@@ -256,6 +256,8 @@ enum qh_statistics {     /* alphabetical after Z/W */
     Zrenameshare,
     Zretry,
     Wretrymax,
+    Wretrytime,
+    Zretrysimplex,
     Zretryadd,
     Zretryaddmax,
     Zretryaddtot,
@@ -489,6 +491,49 @@ enum ztypes {zdoc,zinc,zadd,zmax,zmin,ZTYPEreal,wadd,wmax,wmin,ZTYPEend};
 #define wmin_(id, val) {}
 #endif
 
+/*-<a                             href="qh-stat_r.htm#TOC"
+  >--------------------------------</a><a name="PHASE">-</a>
+
+  qh_PHASE...
+    phases of Qhull for the wall-clock profile of option 'Tj'
+
+  notes:
+    qh_profilephase charges wall-clock time to the current phase
+    qh_PHASEother is time outside of the other phases
+    remains defined if qh_KEEPstatistics=0
+*/
+enum qh_PHASE {
+  qh_PHASEother,      /* outside of the following phases */
+  qh_PHASEread,       /* qh_readpoints */
+  qh_PHASEproject,    /* qh_init_B -- project, scale, and rotate input */
+  qh_PHASEsimplex,    /* qh_initbuild -- qh_maxmin, qh_maxsimplex, qh_initialhull */
+  qh_PHASEpartition,  /* qh_partitionall */
+  qh_PHASEbuild,      /* qh_buildhull -- qh_addpoint for each point */
+  qh_PHASEmerge,      /* qh_postmerge and qh_all_vertexmerges */
+  qh_PHASEtriangulate,/* qh_triangulate */
+  qh_PHASEcheck,      /* qh_check_maxout, qh_check_output, qh_check_points */
+  qh_PHASEoutput,     /* qh_produce_output except for qh_triangulate */
+  qh_PHASEend
+};
+
+/*-<a                             href="qh-stat_r.htm#TOC"
+  >--------------------------------</a><a name="PERF">-</a>
+
+  qh_PERF...
+    hardware counters sampled by qh_PHASE if qh_PERFCOUNTERS (user_r.h)
+
+  notes:
+    qh_perfstart opens the counters for 'Ts' or 'Tj'
+    remains defined if qh_PERFCOUNTERS=0
+*/
+enum qh_PERF {
+  qh_PERFcycles,      /* cpu cycles, the group leader */
+  qh_PERFinstructions,/* instructions retired */
+  qh_PERFcachemiss,   /* last-level cache misses */
+  qh_PERFbranchmiss,  /* mispredicted branches */
+  qh_PERFend
+};
+
 /*================== stat_r.h types ==============*/
 
 
@@ -550,11 +595,18 @@ void    qh_collectstatistics(qhT *qh);
 void    qh_initstatistics(qhT *qh);
 bool   qh_newstats(qhT *qh, int idx, int *nextindex);
 bool   qh_nostatistic(qhT *qh, int i);
+void    qh_perfstart(qhT *qh);
+void    qh_perfstop(qhT *qh);
 void    qh_printallstatistics(qhT *qh, FILE *fp, const char *string);
+void    qh_printperfcounters(qhT *qh, FILE *fp);
+void    qh_printprofile(qhT *qh, FILE *fp);
 void    qh_printstatistics(qhT *qh, FILE *fp, const char *string);
 void    qh_printstatlevel(qhT *qh, FILE *fp, int id);
 void    qh_printstats(qhT *qh, FILE *fp, int idx, int *nextindex);
+void    qh_profileaddpoint(qhT *qh, double starttime);
+int     qh_profilephase(qhT *qh, int phase);
 realT   qh_stddev(qhT *qh, int num, realT tot, realT tot2, realT *ave);
+double  qh_wallclock(void);
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -42,6 +42,68 @@ coordT *qh_copypoints(qhT *qh, coordT *points, int numpoints, int dimension) {
   return newpoints;
 } /* copypoints */
 
+/*-<a                             href="qh-geom_r.htm#TOC"
+  >-------------------------------</a><a name="copypoints_strided">-</a>
+
+  qh_copypoints_strided(qh, points, numpoints, dimension, stride, isfloat, islift, newpoints )
+    copy numpoints points of dimension coordinates into newpoints
+    points[i*stride .. i*stride+dimension-1] is the i'th point
+    if isfloat, points is an array of float, otherwise an array of coordT
+    if islift, appends the Delaunay paraboloid coordinate (sum of squares) to each point
+
+  returns:
+    newpoints with dimension+islift coordinates per point
+    if newpoints is NULL, returns a qh_malloc'd array.  qh_free it to avoid a memory leak
+
+  notes:
+    converts, compacts, and lifts the points in one pass.  Same coordinates as qh_setdelaunay
+    newpoints may be points if !isfloat and stride >= dimension+islift (in-place)
+    with islift, call qh_init_B with dimension+1 and qh.PROJECTdelaunay false (see qh_readpoints)
+    'Qbb' scales the last coordinate later, in qh_scaleinput
+*/
+coordT *qh_copypoints_strided(qhT *qh, const void *points, int numpoints, int dimension, int stride, bool isfloat, bool islift, coordT *newpoints) {
+  const coordT *coordp;
+  const float *floatp;
+  coordT *newp, coord;
+  realT paraboloid;
+  int i, k, newdim= dimension + (islift ? 1 : 0);
+
+  if (stride < dimension) {
+    qh_fprintf(qh, qh->ferr, 6436, "qhull input error (qh_copypoints_strided): stride %d is less than the dimension %d of the points\n",
+        stride, dimension);
+    qh_errexit(qh, qh_ERRinput, NULL, NULL);
+  }
+  if (!newpoints && !(newpoints= (coordT *)qh_malloc((size_t)numpoints * (size_t)newdim * sizeof(coordT)))) {
+    qh_fprintf(qh, qh->ferr, 6437, "qhull error: insufficient memory to copy %d points\n",
+        numpoints);
+    qh_errexit(qh, qh_ERRmem, NULL, NULL);
+  }
+  newp= newpoints;
+  for (i=0; i < numpoints; i++) {
+    paraboloid= 0.0;
+    if (isfloat) {
+      floatp= (const float *)points + (size_t)i * (size_t)stride;
+      for (k=0; k < dimension; k++) {
+        coord= (coordT)*floatp++;
+        paraboloid += coord*coord;
+        *newp++= coord;
+      }
+    }else {
+      coordp= (const coordT *)points + (size_t)i * (size_t)stride;
+      for (k=0; k < dimension; k++) {
+        coord= *coordp++;
+        paraboloid += coord*coord;
+        *newp++= coord;
+      }
+    }
+    if (islift)
+      *newp++= paraboloid;
+  }
+  trace1((qh, qh->ferr, 1070, "qh_copypoints_strided: copied %d %s points of dimension %d and stride %d%s\n",
+      numpoints, (isfloat ? "float" : "coordT"), dimension, stride, (islift ? ", lifted to the paraboloid" : "")));
+  return newpoints;
+} /* copypoints_strided */
+
 /*-<a                             href="qh-geom_r.htm#TOC"
   >-------------------------------</a><a name="crossproduct">-</a>
 
@@ -82,35 +144,113 @@ void qh_crossproduct(int dim, realT vecA[3], realT vecB[3], realT vecC[3]){
       nearzero iff diagonal[k] < qh->NEARzero[k]
 */
 realT qh_determinant(qhT *qh, realT **rows, int dim, bool *nearzero) {
-  realT det=0;
+  realT det=0, lastpivot;
   int i;
-  bool sign= false;
+  bool sign= false, zeropivot;
 
   *nearzero= false;
   if (dim < 2) {
     qh_fprintf(qh, qh->ferr, 6005, "qhull internal error (qh_determinate): only implemented for dimension >= 2\n");
     qh_errexit(qh, qh_ERRqhull, NULL, NULL);
-  }else if (dim == 2) {
+  }else if (dim <= 3) {
+    det= qh_determinant_local(qh, rows, dim, nearzero, &zeropivot, &lastpivot);  /* thread-safe for 2-d and 3-d */
+  }else {
+    qh_gausselim(qh, rows, dim, dim, &sign, nearzero);  /* if nearzero, diagonal still ok */
+    det= 1.0;
+    for (i=dim; i--; )
+      det *= (rows[i])[i];
+    if (sign)
+      det= -det;
+  }
+  return det;
+} /* determinant */
+
+/*-<a                             href="qh-geom_r.htm#TOC"
+  >-------------------------------</a><a name="determinant_fixed">-</a>
+
+  qh_determinant_fixed( rows, dim )
+    return determinant of a 2-d, 3-d, or 4-d square matrix
+
+  notes:
+    thread-safe, rows is not changed
+    2-d and 3-d are the same as qh_determinant
+    4-d is the Laplace expansion by the 2x2 minors of rows 0-1 and rows 2-3
+    does not test for nearzero
+*/
+realT qh_determinant_fixed(realT rows[4][4], int dim) {
+  realT s0, s1, s2, s3, s4, s5, c0, c1, c2, c3, c4, c5;
+
+  if (dim == 2)
+    return det2_(rows[0][0], rows[0][1],
+                 rows[1][0], rows[1][1]);
+  if (dim == 3)
+    return det3_(rows[0][0], rows[0][1], rows[0][2],
+                 rows[1][0], rows[1][1], rows[1][2],
+                 rows[2][0], rows[2][1], rows[2][2]);
+  s0= det2_(rows[0][0], rows[0][1], rows[1][0], rows[1][1]);
+  s1= det2_(rows[0][0], rows[0][2], rows[1][0], rows[1][2]);
+  s2= det2_(rows[0][0], rows[0][3], rows[1][0], rows[1][3]);
+  s3= det2_(rows[0][1], rows[0][2], rows[1][1], rows[1][2]);
+  s4= det2_(rows[0][1], rows[0][3], rows[1][1], rows[1][3]);
+  s5= det2_(rows[0][2], rows[0][3], rows[1][2], rows[1][3]);
+  c5= det2_(rows[2][2], rows[2][3], rows[3][2], rows[3][3]);
+  c4= det2_(rows[2][1], rows[2][3], rows[3][1], rows[3][3]);
+  c3= det2_(rows[2][1], rows[2][2], rows[3][1], rows[3][2]);
+  c2= det2_(rows[2][0], rows[2][3], rows[3][0], rows[3][3]);
+  c1= det2_(rows[2][0], rows[2][2], rows[3][0], rows[3][2]);
+  c0= det2_(rows[2][0], rows[2][1], rows[3][0], rows[3][1]);
+  return s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0;
+} /* determinant_fixed */
+
+/*-<a                             href="qh-geom_r.htm#TOC"
+  >-------------------------------</a><a name="determinant_local">-</a>
+
+  qh_determinant_local(qh, rows, dim, &nearzero, &zeropivot, &lastpivot )
+    return determinant of a square matrix, the same as qh_determinant
+
+  returns:
+    nearzero if near zero, the same as qh_determinant
+    zeropivot if Gaussian elimination found a zero pivot (dim >= 4).  The determinant is undefined
+    lastpivot is the last pivot for Wmindenom (dim >= 4)
+
+  notes:
+    thread-safe, no statistics, tracing, or qh_joggle_restart
+    called by qh_determinant for 2-d and 3-d, and by qh_maxsimplex_parallel
+    uses qh_gausselim_local for dim >= 4.  Rows are modified
+    the caller repeats a zeropivot with qh_determinant for its side effects
+*/
+realT qh_determinant_local(qhT *qh, realT **rows, int dim, bool *nearzero, bool *zeropivot, realT *lastpivot) {
+  realT det;
+  int i;
+  bool sign= false;
+
+  *nearzero= *zeropivot= false;
+  *lastpivot= 0.0;
+  if (dim == 2) {
     det= det2_(rows[0][0], rows[0][1],
                  rows[1][0], rows[1][1]);
     if (fabs_(det) < 10*qh->NEARzero[1])  /* QH11031 FIX: not really correct, what should this be? */
       *nearzero= true;
+    return det;
   }else if (dim == 3) {
     det= det3_(rows[0][0], rows[0][1], rows[0][2],
                  rows[1][0], rows[1][1], rows[1][2],
                  rows[2][0], rows[2][1], rows[2][2]);
     if (fabs_(det) < 10*qh->NEARzero[2])  /* QH11031 FIX: what should this be?  det 5.5e-12 was flat for qh_maxsimplex of qdelaunay 0,0 27,27 -36,36 -9,63 */
       *nearzero= true;
-  }else {
-    qh_gausselim(qh, rows, dim, dim, &sign, nearzero);  /* if nearzero, diagonal still ok */
-    det= 1.0;
-    for (i=dim; i--; )
-      det *= (rows[i])[i];
-    if (sign)
-      det= -det;
+    return det;
   }
+  if (qh_gausselim_local(qh, rows, dim, dim, &sign, nearzero, lastpivot)) {
+    *zeropivot= true;
+    return 0.0;
+  }
+  det= 1.0;
+  for (i=dim; i--; )
+    det *= (rows[i])[i];
+  if (sign)
+    det= -det;
   return det;
-} /* determinant */
+} /* determinant_local */
 
 /*-<a                             href="qh-geom_r.htm#TOC"
   >-------------------------------</a><a name="detjoggle">-</a>
@@ -482,6 +622,7 @@ realT qh_divzero(realT numer, realT denom, realT mindenom1, bool *zerodiv) {
       computes projected area instead for last coordinate
     assumes facet->normal exists
     projecting tricoplanar facets to the hyperplane does not appear to make a difference
+    simplicial facets in 2-d, 3-d, and 4-d use qh_facetarea_fixed without qh.gm_matrix
 
   design:
     if simplicial
@@ -497,7 +638,10 @@ realT qh_facetarea(qhT *qh, facetT *facet) {
   realT area= 0.0;
   ridgeT *ridge, **ridgep;
 
-  if (facet->simplicial) {
+  if (facet->simplicial && qh->hull_dim <= 4) {
+    zinc_(Zdetfacetarea);
+    area= qh_facetarea_fixed(qh, facet);
+  }else if (facet->simplicial) {
     apex= SETfirstt_(facet->vertices, vertexT);
     area= qh_facetarea_simplex(qh, qh->hull_dim, apex->point, facet->vertices,
                     apex, facet->toporient, facet->normal, &facet->offset);
@@ -518,6 +662,111 @@ realT qh_facetarea(qhT *qh, facetT *facet) {
   return area;
 } /* facetarea */
 
+/*-<a                             href="qh-geom_r.htm#TOC"
+  >-------------------------------</a><a name="facetarea_all">-</a>
+
+  qh_facetarea_all(qh, facets, areas )
+    set areas[i] to the area of the i'th facet of facets
+    in parallel if 'QPn'
+
+  returns:
+    areas[i] is facet->f.area if facet->isarea, otherwise qh_facetarea
+    does not set facet->f.area
+
+  notes:
+    called by qh_getarea and qh_getvolume
+    the parallel section computes simplicial facets in 2-d, 3-d, and 4-d with qh_facetarea_fixed
+      other facets use qh_facetarea before the parallel section (qh.gm_matrix and qh_memalloc)
+    the areas are the same for any number of threads
+
+  design:
+    if serial or 5-d and higher
+      compute each area with qh_facetarea
+    else
+      compute the area of non-simplicial facets with qh_facetarea
+      in parallel, compute the area of each simplicial facet
+*/
+void qh_facetarea_all(qhT *qh, setT *facets, realT *areas) {
+  facetT *facet;
+  int i, facet_i, facet_n, numfacets, numthreads, numfixed= 0, chunk;
+
+  numfacets= qh_setsize(qh, facets);
+  numthreads= (qh->hull_dim <= 4 ? qh_parallelthreads(qh, numfacets) : 1);
+  FOREACHfacet_i_(qh, facets) {
+    if (facet->isarea)
+      areas[facet_i]= facet->f.area;
+    else if (numthreads == 1 || !facet->simplicial)
+      areas[facet_i]= qh_facetarea(qh, facet);
+    else
+      numfixed++;
+  }
+  if (!numfixed)
+    return;
+  chunk= (numfacets + numthreads - 1) / numthreads;
+#if qh_PARALLEL
+#pragma omp parallel for num_threads(numthreads) schedule(static, 1)
+#endif
+  for (i=0; i < numthreads; i++) {
+    facetT *facetj;
+    int j, end;
+
+    end= (i+1) * chunk;
+    minimize_(end, numfacets);
+    for (j= i * chunk; j < end; j++) {
+      facetj= SETelemt_(facets, j, facetT);
+      if (!facetj->isarea && facetj->simplicial) {
+        areas[j]= qh_facetarea_fixed(qh, facetj);
+        if (facetj->upperdelaunay && qh->DELAUNAY)
+          areas[j]= -areas[j];
+      }
+    }
+  }
+  zadd_(Zdetfacetarea, numfixed);
+  trace2((qh, qh->ferr, 2120, "qh_facetarea_all: computed %d of %d facet areas with %d threads\n",
+      numfixed, numfacets, numthreads));
+} /* facetarea_all */
+
+/*-<a                             href="qh-geom_r.htm#TOC"
+  >-------------------------------</a><a name="facetarea_fixed">-</a>
+
+  qh_facetarea_fixed(qh, facet )
+    return area for a simplicial facet in 2-d, 3-d, or 4-d
+
+  notes:
+    thread-safe, no statistics or tracing
+    same rows as qh_facetarea_simplex with the first vertex as apex
+    2-d and 3-d (triangles) are the same as qh_determinant, 4-d uses qh_determinant_fixed
+    caller negates the area of an upper Delaunay facet (qh_facetarea)
+*/
+realT qh_facetarea_fixed(qhT *qh, facetT *facet) {
+  realT rows[4][4], area;
+  vertexT *apex, *vertex, **vertexp;
+  int dim= qh->hull_dim, i= 0, k;
+
+  apex= SETfirstt_(facet->vertices, vertexT);
+  FOREACHvertex_(facet->vertices) {
+    if (vertex == apex)
+      continue;
+    for (k=0; k < dim; k++)
+      rows[i][k]= vertex->point[k] - apex->point[k];
+    i++;
+  }
+  if (qh->DELAUNAY) {
+    for (i=0; i < dim-1; i++)
+      rows[i][dim-1]= 0.0;
+    for (k=0; k < dim; k++)
+      rows[dim-1][k]= 0.0;
+    rows[dim-1][dim-1]= -1.0;
+  }else {
+    for (k=0; k < dim; k++)
+      rows[dim-1][k]= facet->normal[k];
+  }
+  area= qh_determinant_fixed(rows, dim);
+  if (facet->toporient)
+    area= -area;
+  return area * qh->AREAfactor;
+} /* facetarea_fixed */
+
 /*-<a                             href="qh-geom_r.htm#TOC"
   >-------------------------------</a><a name="facetarea_simplex">-</a>
 
@@ -809,21 +1058,30 @@ vertexT *qh_furthestvertex(qhT *qh, facetT *facetA, facetT *facetB, realT *maxdi
     sets qh->totarea/totvol to total area and volume of convex hull
     for Delaunay triangulation, computes projected area of the lower or upper hull
       ignores upper hull if qh->ATinfinity
+    sets qh.hasVolume
 
   notes:
     could compute outer volume by expanding facet area by rays from interior
     the following attempt at perpendicular projection underestimated badly:
       qh.totoutvol += (-dist + facet->maxoutside + qh->DISTround)
                             * area/ qh->hull_dim;
+    computes the facet areas in parallel with 'QPn' (qh_facetarea_all)
+    sums in list order with compensated summation (qh_sumkahan), the same for any number of threads
+    for the volume without setting facet->f.area, use qh_getvolume
+
   design:
+    collect facets with a normal
+    compute the area of each facet (qh_facetarea_all)
     for each facet on facetlist
-      compute facet->area
+      set facet->area
       update qh.totarea and qh.totvol
 */
 void qh_getarea(qhT *qh, facetT *facetlist) {
-  realT area;
-  realT dist;
-  facetT *facet;
+  realT area, *areas;
+  realT dist, areaerror= 0.0, volerror= 0.0;
+  facetT *facet, **facetp;
+  setT *facets;
+  int facet_i, facet_n, numfacets;
 
   if (qh->hasAreaVolume)
     return;
@@ -832,23 +1090,32 @@ void qh_getarea(qhT *qh, facetT *facetlist) {
   else
     trace1((qh, qh->ferr, 1001, "qh_getarea: computing area for each facet and its volume to qh.interior_point (dist*area/dim)\n"));
   qh->totarea= qh->totvol= 0.0;
+  facets= qh_settemp(qh, qh->num_facets);
   FORALLfacet_(facetlist) {
     if (!facet->normal)
       continue;
     if (facet->upperdelaunay && qh->ATinfinity)
       continue;
-    if (!facet->isarea) {
-      facet->f.area= qh_facetarea(qh, facet);
+    qh_setappend(qh, &facets, facet);
+  }
+  if ((numfacets= qh_setsize(qh, facets))) {
+    areas= (realT *)qh_memalloc(qh, numfacets * (int)sizeof(realT));
+    qh_facetarea_all(qh, facets, areas);
+    FOREACHfacet_i_(qh, facets) {
+      facet->f.area= areas[facet_i];
       facet->isarea= true;
     }
+    qh_memfree(qh, areas, numfacets * (int)sizeof(realT));
+  }
+  FOREACHfacet_(facets) {
     area= facet->f.area;
     if (qh->DELAUNAY) {
       if (facet->upperdelaunay == qh->UPPERdelaunay)
-        qh->totarea += area;
+        qh_sumkahan(&qh->totarea, &areaerror, area);
     }else {
-      qh->totarea += area;
+      qh_sumkahan(&qh->totarea, &areaerror, area);
       qh_distplane(qh, qh->interior_point, facet, &dist);
-      qh->totvol += -dist * area/ qh->hull_dim;
+      qh_sumkahan(&qh->totvol, &volerror, -dist * area/ qh->hull_dim);
     }
     if (qh->PRINTstatistics) {
       wadd_(Wareatot, area);
@@ -856,9 +1123,70 @@ void qh_getarea(qhT *qh, facetT *facetlist) {
       wmin_(Wareamin, area);
     }
   }
+  qh_settempfree(qh, &facets);
+  qh->totarea += areaerror;
+  qh->totvol += volerror;
   qh->hasAreaVolume= true;
+  qh->hasVolume= true;
 } /* getarea */
 
+/*-<a                             href="qh-geom_r.htm#TOC"
+  >-------------------------------</a><a name="getvolume">-</a>
+
+  qh_getvolume(qh, facetlist )
+    compute the volume of the convex hull without setting facet->f.area
+    nop if hasVolume
+
+  returns:
+    sets qh->totvol to the volume of the convex hull, the same as qh_getarea
+    sets qh.hasVolume
+    0.0 for a Delaunay triangulation (see qh_getarea)
+
+  notes:
+    facet->f.area shares a union with f.triowner.  qh_getvolume keeps f.triowner for
+      tricoplanar facets (QhullFacet::tricoplanarOwner)
+    uses facet->f.area if already computed
+    computes the facet areas in parallel with 'QPn' (qh_facetarea_all)
+
+  design:
+    collect facets with a normal
+    compute the area of each facet (qh_facetarea_all)
+    for each facet
+      update qh.totvol
+*/
+void qh_getvolume(qhT *qh, facetT *facetlist) {
+  realT dist, *areas, volerror= 0.0;
+  facetT *facet;
+  setT *facets;
+  int facet_i, facet_n, numfacets;
+
+  if (qh->hasVolume)
+    return;
+  trace1((qh, qh->ferr, 1072, "qh_getvolume: computing volume to qh.interior_point (dist*area/dim)\n"));
+  qh->totvol= 0.0;
+  if (qh->DELAUNAY) {
+    qh->hasVolume= true;
+    return;
+  }
+  facets= qh_settemp(qh, qh->num_facets);
+  FORALLfacet_(facetlist) {
+    if (facet->normal)
+      qh_setappend(qh, &facets, facet);
+  }
+  if ((numfacets= qh_setsize(qh, facets))) {
+    areas= (realT *)qh_memalloc(qh, numfacets * (int)sizeof(realT));
+    qh_facetarea_all(qh, facets, areas);
+    FOREACHfacet_i_(qh, facets) {
+      qh_distplane(qh, qh->interior_point, facet, &dist);
+      qh_sumkahan(&qh->totvol, &volerror, -dist * areas[facet_i]/ qh->hull_dim);
+    }
+    qh_memfree(qh, areas, numfacets * (int)sizeof(realT));
+  }
+  qh_settempfree(qh, &facets);
+  qh->totvol += volerror;
+  qh->hasVolume= true;
+} /* getvolume */
+
 /*-<a                             href="qh-geom_r.htm#TOC"
   >-------------------------------</a><a name="gram_schmidt">-</a>
 
@@ -1098,9 +1426,10 @@ realT *qh_maxabsval(realT *normal, int dim) {
       determine qh.NEARzero for Gaussian Elimination
 */
 setT *qh_maxmin(qhT *qh, pointT *points, int numpoints, int dimension) {
-  int k;
+  int k, numthreads;
   realT maxcoord, temp;
   pointT *minimum, *maximum, *point, *pointtemp;
+  pointT **minpoints= NULL, **maxpoints= NULL;
   setT *set;
 
   qh->max_outside= 0.0;
@@ -1120,19 +1449,30 @@ setT *qh_maxmin(qhT *qh, pointT *points, int numpoints, int dimension) {
     qh_errexit(qh, qh_ERRinput, NULL, NULL);
   }
   set= qh_settemp(qh, 2*dimension);
+  numthreads= qh_parallelthreads(qh, numpoints);
+  if (numthreads > 1) {
+    minpoints= (pointT **)qh_memalloc(qh, 2 * dimension * (int)sizeof(pointT *));
+    maxpoints= minpoints + dimension;
+    qh_maxmin_parallel(qh, numthreads, points, numpoints, dimension, minpoints, maxpoints);
+  }
   trace1((qh, qh->ferr, 8082, "qh_maxmin: dim             min             max           width    nearzero  min-point  max-point\n"));
   for (k=0; k < dimension; k++) {
-    if (points == qh->GOODpointp)
-      minimum= maximum= points + dimension;
-    else
-      minimum= maximum= points;
-    FORALLpoint_(qh, points, numpoints) {
-      if (point == qh->GOODpointp)
-        continue;
-      if (maximum[k] < point[k])
-        maximum= point;
-      else if (minimum[k] > point[k])
-        minimum= point;
+    if (minpoints) {
+      minimum= minpoints[k];
+      maximum= maxpoints[k];
+    }else {
+      if (points == qh->GOODpointp)
+        minimum= maximum= points + dimension;
+      else
+        minimum= maximum= points;
+      FORALLpoint_(qh, points, numpoints) {
+        if (point == qh->GOODpointp)
+          continue;
+        if (maximum[k] < point[k])
+          maximum= point;
+        else if (minimum[k] > point[k])
+          minimum= point;
+      }
     }
     if (k == dimension-1) {
       qh->MINlastcoord= minimum[k];
@@ -1164,11 +1504,86 @@ setT *qh_maxmin(qhT *qh, pointT *points, int numpoints, int dimension) {
       trace1((qh, qh->ferr, 8107, "           last coordinate scaled to (%4.4g, %4.4g), width %4.4e for option 'Qbb'\n",
             qh->MAXabs_coord - qh->MAXwidth, qh->MAXabs_coord, qh->MAXwidth));
   }
+  if (minpoints)
+    qh_memfree(qh, minpoints, 2 * dimension * (int)sizeof(pointT *));
   if (qh->IStracing >= 1)
     qh_printpoints(qh, qh->ferr, "qh_maxmin: found the max and min points (by dim):", set);
   return(set);
 } /* maxmin */
 
+/*-<a                             href="qh-geom_r.htm#TOC"
+  >-------------------------------</a><a name="maxmin_parallel">-</a>
+
+  qh_maxmin_parallel(qh, numthreads, points, numpoints, dimension, minpoints, maxpoints )
+    set minpoints[k] and maxpoints[k] to the points with the min and max k'th coordinate
+    skips qh.GOODpointp
+
+  returns:
+    the same points as qh_maxmin, the first point for a tied coordinate
+
+  notes:
+    called by qh_maxmin if numthreads > 1
+    each thread scans a contiguous range of points for all coordinates
+    ranges are combined in order with strict comparisons, so ties go to the lower point id
+
+  design:
+    for each thread in parallel
+      for each point in its range
+        update the min and max point for each coordinate
+    combine the ranges in order
+*/
+void qh_maxmin_parallel(qhT *qh, int numthreads, pointT *points, int numpoints, int dimension, pointT **minpoints, pointT **maxpoints) {
+  pointT **threadmin, **threadmax;
+  int i, k, chunk, size;
+
+  size= 2 * numthreads * dimension * (int)sizeof(pointT *);
+  threadmin= (pointT **)qh_memalloc(qh, size);
+  threadmax= threadmin + numthreads * dimension;
+  chunk= (numpoints + numthreads - 1) / numthreads;
+#if qh_PARALLEL
+#pragma omp parallel for num_threads(numthreads) schedule(static, 1)
+#endif
+  for (i=0; i < numthreads; i++) {
+    pointT **minp= threadmin + i * dimension, **maxp= threadmax + i * dimension;
+    pointT *pointj, *endpoint;
+    int kj;
+
+    endpoint= points + (size_t)dimension * (size_t)((i+1) * chunk < numpoints ? (i+1) * chunk : numpoints);
+    pointj= points + (size_t)dimension * (size_t)(i * chunk);
+    if (pointj == qh->GOODpointp)
+      pointj += dimension;
+    if (pointj >= endpoint) {
+      minp[0]= NULL;
+      continue;
+    }
+    for (kj=0; kj < dimension; kj++)
+      minp[kj]= maxp[kj]= pointj;
+    for (pointj += dimension; pointj < endpoint; pointj += dimension) {
+      if (pointj == qh->GOODpointp)
+        continue;
+      for (kj=0; kj < dimension; kj++) {
+        if (maxp[kj][kj] < pointj[kj])
+          maxp[kj]= pointj;
+        else if (minp[kj][kj] > pointj[kj])
+          minp[kj]= pointj;
+      }
+    }
+  }
+  for (k=0; k < dimension; k++)
+    minpoints[k]= maxpoints[k]= NULL;
+  for (i=0; i < numthreads; i++) {
+    if (!threadmin[i * dimension])
+      continue;
+    for (k=0; k < dimension; k++) {
+      if (!minpoints[k] || minpoints[k][k] > threadmin[i * dimension + k][k])
+        minpoints[k]= threadmin[i * dimension + k];
+      if (!maxpoints[k] || maxpoints[k][k] < threadmax[i * dimension + k][k])
+        maxpoints[k]= threadmax[i * dimension + k];
+    }
+  }
+  qh_memfree(qh, threadmin, size);
+} /* maxmin_parallel */
+
 /*-<a                             href="qh-geom_r.htm#TOC"
   >-------------------------------</a><a name="maxouter">-</a>
 
@@ -1217,6 +1632,7 @@ realT qh_maxouter(qhT *qh) {
     assumes at least needed points in points
     maximizes determinate for x,y,z,w, etc.
     uses maxpoints as long as determinate is clearly non-zero
+    searches all points in parallel with 'QPn' (qh_maxsimplex_parallel).  It selects the same simplex
 
   design:
     initialize simplex with at least two points
@@ -1232,7 +1648,7 @@ realT qh_maxouter(qhT *qh) {
 void qh_maxsimplex(qhT *qh, int dim, setT *maxpoints, pointT *points, int numpoints, setT **simplex) {
   pointT *point, **pointp, *pointtemp, *maxpoint, *minx=NULL, *maxx=NULL;
   bool nearzero, maxnearzero= false, maybe_falsenarrow;
-  int i, sizinit;
+  int i, sizinit, numthreads, firstpoint;
   realT maxdet= -1.0, prevdet= -1.0, det, mincoord= REALmax, maxcoord= -REALmax, mindet, ratio, targetdet;
 
   if (qh->MAXwidth <= 0.0) {
@@ -1324,7 +1740,11 @@ void qh_maxsimplex(qhT *qh, int dim, setT *maxpoints, pointT *points, int numpoi
         trace0((qh, qh->ferr, 8, "qh_maxsimplex: searching all points for %d-th initial vertex, better than p%d det %2.2g and mindet %4.4g, targetdet %4.4g\n",
                 i+1, qh_pointid(qh, maxpoint), maxdet, mindet, targetdet));
       }
-      FORALLpoint_(qh, points, numpoints) {
+      firstpoint= 0;
+      numthreads= qh_parallelthreads(qh, numpoints);
+      if (numthreads > 1)
+        firstpoint= qh_maxsimplex_parallel(qh, numthreads, i, maxpoints, points, numpoints, *simplex, mindet, &maxpoint, &maxdet, &maxnearzero);
+      FORALLpoint_(qh, points + (size_t)firstpoint * (size_t)qh->hull_dim, numpoints - firstpoint) {
         if (point == qh->GOODpointp)
           continue;
         if (!qh_setin(maxpoints, point) && !qh_setin(*simplex, point)) {
@@ -1349,6 +1769,120 @@ void qh_maxsimplex(qhT *qh, int dim, setT *maxpoints, pointT *points, int numpoi
   } /* i */
 } /* maxsimplex */
 
+/*-<a                             href="qh-geom_r.htm#TOC"
+  >-------------------------------</a><a name="maxsimplex_parallel">-</a>
+
+  qh_maxsimplex_parallel(qh, numthreads, dim, maxpoints, points, numpoints, simplex, mindet, &maxpoint, &maxdet, &maxnearzero )
+    search points for the point that maximizes the determinate with the dim points of simplex
+    skips qh.GOODpointp, maxpoints, and simplex
+    stops at the first new maxpoint that is not nearzero and above mindet, unless qh.ALLpoints
+
+  returns:
+    updates maxpoint, maxdet, and maxnearzero
+    index of the next point for the serial search of qh_maxsimplex
+      numpoints if done
+      the index of a point with a zero pivot.  qh_detsimplex repeats it for qh_joggle_restart
+
+  notes:
+    called by qh_maxsimplex if numthreads > 1
+    computes the determinates of a block of points in parallel with qh_determinant_local,
+      then scans the block in order with the same tests as qh_maxsimplex
+    selects the same point as the serial search, with the same Zdetsimplex and Wmindenom
+    a block has qh_PARALLELmin points per thread, so an early exit wastes at most one block
+
+  design:
+    allocate a matrix for each thread and arrays for a block of points
+    for each block of points
+      for each thread in parallel
+        compute the determinate of each point in its range
+      for each point of the block in order
+        if a zero pivot, return its index
+        update maxpoint if a larger determinate
+        return numpoints if an early exit
+*/
+int qh_maxsimplex_parallel(qhT *qh, int numthreads, int dim, setT *maxpoints, pointT *points, int numpoints, setT *simplex,
+                          realT mindet, pointT **maxpoint, realT *maxdet, bool *maxnearzero) {
+  realT *matrix, **rows, *dets, *pivots, det;
+  signed char *flags;
+  pointT *point;
+  int i, j, start, end, blocksize, chunk, rowsize, rowssize, blocksizes, result= numpoints;
+
+  blocksize= numthreads * qh_PARALLELmin;
+  chunk= qh_PARALLELmin;
+  rowsize= numthreads * dim * dim * (int)sizeof(realT);
+  rowssize= numthreads * dim * (int)sizeof(realT *);
+  blocksizes= blocksize * (2 * (int)sizeof(realT) + (int)sizeof(signed char));
+  matrix= (realT *)qh_memalloc(qh, rowsize);
+  rows= (realT **)qh_memalloc(qh, rowssize);
+  dets= (realT *)qh_memalloc(qh, blocksizes);
+  pivots= dets + blocksize;
+  flags= (signed char *)(pivots + blocksize);
+  for (start=0; start < numpoints; start += blocksize) {
+    end= (numpoints - start < blocksize ? numpoints : start + blocksize);
+#if qh_PARALLEL
+#pragma omp parallel for num_threads(numthreads) schedule(static, 1)
+#endif
+    for (i=0; i < numthreads; i++) {
+      realT *gmcoord, *coordp, *coorda, **rowsj= rows + i * dim, **rowp, detj;
+      pointT *pointj, *vertexpoint, **vertexpointp;
+      int j2, k, r, endj;
+      bool nearzero, zeropivot;
+
+      endj= start + (i+1) * chunk;
+      minimize_(endj, end);
+      for (j2= start + i * chunk; j2 < endj; j2++) {
+        pointj= points + (size_t)j2 * (size_t)qh->hull_dim;
+        if (pointj == qh->GOODpointp || qh_setin(maxpoints, pointj) || qh_setin(simplex, pointj)) {
+          flags[j2 - start]= 0;
+          continue;
+        }
+        gmcoord= matrix + i * dim * dim;
+        rowp= rowsj;
+        r= 0;
+        FOREACHsetelement_(pointT, simplex, vertexpoint) {
+          if (r++ == dim)
+            break;
+          *(rowp++)= gmcoord;
+          coordp= vertexpoint;
+          coorda= pointj;
+          for (k=dim; k--; )
+            *(gmcoord++)= *coordp++ - *coorda++;
+        }
+        detj= qh_determinant_local(qh, rowsj, dim, &nearzero, &zeropivot, &pivots[j2 - start]);
+        dets[j2 - start]= fabs_(detj);
+        flags[j2 - start]= (signed char)(zeropivot ? 3 : (nearzero ? 2 : 1));
+      }
+    }
+    for (j=start; j < end; j++) {
+      if (!flags[j - start])
+        continue;
+      if (flags[j - start] == 3) {
+        result= j;
+        break;
+      }
+      zinc_(Zdetsimplex);
+      if (dim >= 4)
+        wmin_(Wmindenom, pivots[j - start]);
+      if ((det= dets[j - start]) > *maxdet) {
+        point= points + (size_t)j * (size_t)qh->hull_dim;
+        *maxdet= det;
+        *maxpoint= point;
+        *maxnearzero= (flags[j - start] == 2);
+        if (!*maxnearzero && !qh->ALLpoints && *maxdet > mindet)
+          break;
+      }
+    }
+    if (j < end)
+      break;
+  }
+  qh_memfree(qh, matrix, rowsize);
+  qh_memfree(qh, rows, rowssize);
+  qh_memfree(qh, dets, blocksizes);
+  trace2((qh, qh->ferr, 2121, "qh_maxsimplex_parallel: %d-th initial vertex with %d threads, maxpoint p%d det %4.4g, next point %d\n",
+      dim+1, numthreads, qh_pointid(qh, *maxpoint), *maxdet, result));
+  return result;
+} /* maxsimplex_parallel */
+
 /*-<a                             href="qh-geom_r.htm#TOC"
   >-------------------------------</a><a name="minabsval">-</a>
 
@@ -1992,6 +2526,168 @@ void qh_setdelaunay(qhT *qh, int dim, int count, pointT *points) {
 } /* setdelaunay */
 
 
+/*-<a                             href="qh-geom_r.htm#TOC"
+  >-------------------------------</a><a name="setfacetplane_all">-</a>
+
+  qh_setfacetplane_all(qh, facets, numthreads )
+    set the hyperplanes for a set of new facets with numthreads threads
+
+  returns:
+    each facet has a hyperplane, the same as qh_setfacetplane in facet order
+    updates Zsetplane, Wmindenom, and the statistics of qh_setfacetplane_finish
+
+  notes:
+    called by qh_makenewplanes for a cone of at least qh_PARALLELmin new facets
+    the parallel section computes each hyperplane with qh_setfacetplane_local
+      per-thread buffers replace qh.gm_matrix/gm_row
+      allocates facet->normal before the parallel section (qh_memalloc)
+    qh_setfacetplane recomputes a hyperplane if qh_setfacetplane_local fails
+      e.g., nearzero determinant or pivot, or qh.tracefacet
+    not used for qh.RANDOMdist ('Rn') since qh_randomfactor is serial
+    the hyperplanes are the same for any number of threads
+
+  design:
+    allocate facet->normal and per-thread buffers
+    in parallel, compute the hyperplane of each facet
+    for each facet in order
+      if computed
+        update statistics and finish with qh_setfacetplane_finish
+      else
+        recompute with qh_setfacetplane
+*/
+void qh_setfacetplane_all(qhT *qh, setT *facets, int numthreads) {
+  facetT *facet, **facetp;
+  realT *mindenoms;
+  coordT *buffers, **rowbuffers;
+  unsigned char *isdone;
+  int normsize= qh->normal_size;
+  int i, dim= qh->hull_dim, facet_i, facet_n, numfacets, numlocal= 0, chunk;
+  void **freelistp; /* used if !qh_NOmem by qh_memalloc_() */
+
+  numfacets= qh_setsize(qh, facets);
+  FOREACHfacet_(facets) {
+    if (!facet->normal)
+      qh_memalloc_(qh, normsize, freelistp, facet->normal, coordT);
+  }
+  mindenoms= (realT *)qh_memalloc(qh, numfacets * (int)sizeof(realT));
+  isdone= (unsigned char *)qh_memalloc(qh, numfacets * (int)sizeof(unsigned char));
+  buffers= (coordT *)qh_memalloc(qh, numthreads * dim * dim * (int)sizeof(coordT));
+  rowbuffers= (coordT **)qh_memalloc(qh, numthreads * dim * (int)sizeof(coordT *));
+  chunk= (numfacets + numthreads - 1) / numthreads;
+#if qh_PARALLEL
+#pragma omp parallel for num_threads(numthreads) schedule(static, 1)
+#endif
+  for (i=0; i < numthreads; i++) {
+    facetT *facetj;
+    int j, end;
+
+    end= (i+1) * chunk;
+    minimize_(end, numfacets);
+    for (j= i * chunk; j < end; j++) {
+      facetj= SETelemt_(facets, j, facetT);
+      isdone[j]= (unsigned char)qh_setfacetplane_local(qh, facetj, rowbuffers + i * dim, buffers + i * dim * dim, &mindenoms[j]);
+    }
+  }
+  FOREACHfacet_i_(qh, facets) {
+    if (isdone[facet_i]) {
+      numlocal++;
+      zzinc_(Zsetplane);
+      wmin_(Wmindenom, mindenoms[facet_i]);
+      qh_setfacetplane_finish(qh, facet);
+    }else
+      qh_setfacetplane(qh, facet);
+  }
+  qh_memfree(qh, rowbuffers, numthreads * dim * (int)sizeof(coordT *));
+  qh_memfree(qh, buffers, numthreads * dim * dim * (int)sizeof(coordT));
+  qh_memfree(qh, isdone, numfacets * (int)sizeof(unsigned char));
+  qh_memfree(qh, mindenoms, numfacets * (int)sizeof(realT));
+  trace2((qh, qh->ferr, 2122, "qh_setfacetplane_all: computed %d of %d hyperplanes with %d threads\n",
+      numlocal, numfacets, numthreads));
+} /* setfacetplane_all */
+
+/*-<a                             href="qh-geom_r.htm#TOC"
+  >-------------------------------</a><a name="setfacetplane_local">-</a>
+
+  qh_setfacetplane_local(qh, facet, rows, buffer, mindenom )
+    set the hyperplane of a new facet without side effects
+    rows is dim pointers and buffer is dim*dim coordinates for 5-d and higher
+
+  returns:
+    true if facet->normal and facet->offset are the same as qh_setfacetplane
+      mindenom is the minimum denominator for Wmindenom
+    false if the caller should recompute with qh_setfacetplane
+      nearzero determinant, pivot, back substitution, or norm, qh.tracefacet, or qh.RANDOMdist
+      i.e., qh_setfacetplane would update a statistic other than Wmindenom
+      facet->normal and facet->offset are undefined
+
+  notes:
+    thread-safe, no statistics, tracing, qh_joggle_restart, or qh_memalloc
+    facet->normal is allocated by the caller
+    the same steps as qh_sethyperplane_det (2-d to 4-d) and qh_sethyperplane_gauss,
+      with the _local routines of qh_gausselim, qh_backnormal, and qh_normalize2
+    does not set facet->upperdelaunay (qh_setfacetplane_finish)
+
+  design:
+    if 2-d, 3-d, or 4-d
+      compute the normal with qh_detnormal and qh_normalize2_local
+      compute the offset with qh_detoffset
+    else
+      copy V_i-V_0 to the buffer
+      compute the normal with qh_gausselim_local, qh_backnormal_local, and qh_normalize2_local
+      compute the offset
+    fail if nearzero
+*/
+bool qh_setfacetplane_local(qhT *qh, facetT *facet, coordT **rows, coordT *buffer, realT *mindenom) {
+  vertexT *vertex, **vertexp;
+  pointT *point0= SETfirstt_(facet->vertices, vertexT)->point;
+  coordT *normal= facet->normal, *coord, *point, *gmcoord, *normalp;
+  realT norm, lastpivot;
+  int dim= qh->hull_dim, i, k;
+  bool sign, nearzero;
+
+  if (facet == qh->tracefacet || qh->RANDOMdist)
+    return false;
+  i= 0;
+  if (dim <= 4) {
+    FOREACHvertex_(facet->vertices)
+      rows[i++]= vertex->point;
+    qh_detnormal(dim, rows, normal);
+    if (qh_normalize2_local(qh, normal, dim, facet->toporient, &norm))
+      return false;
+    *mindenom= norm;
+    return !qh_detoffset(qh, dim, rows, point0, normal, &facet->offset);
+  }
+  gmcoord= buffer;
+  FOREACHvertex_(facet->vertices) {
+    if (vertex->point != point0) {
+      rows[i++]= gmcoord;
+      coord= vertex->point;
+      point= point0;
+      for (k=dim; k--; )
+        *(gmcoord++)= *coord++ - *point++;
+    }
+  }
+  sign= facet->toporient;  /* qh_sethyperplane_gauss */
+  if (qh_gausselim_local(qh, rows, dim-1, dim, &sign, &nearzero, &lastpivot) || nearzero)
+    return false;
+  for (k=dim-1; k--; ) {
+    if ((rows[k])[k] < 0)
+      sign ^= 1;
+  }
+  if (qh_backnormal_local(qh, rows, dim-1, dim, sign, normal) != -1)
+    return false;
+  if (qh_normalize2_local(qh, normal, dim, true, &norm))
+    return false;
+  *mindenom= fmin_(lastpivot, norm);
+  coord= point0;
+  normalp= normal;
+  facet->offset= -(*coord++ * *normalp++);
+  for (k=dim-1; k--; )
+    facet->offset -= *coord++ * *normalp++;
+  return true;
+} /* setfacetplane_local */
+
+
 /*-<a                             href="qh-geom_r.htm#TOC"
   >-------------------------------</a><a name="sethalfspace">-</a>
 
@@ -2154,6 +2850,29 @@ bool qh_sharpnewfacets(qhT *qh) {
   return issharp;
 } /* sharpnewfacets */
 
+/*-<a                             href="qh-geom_r.htm#TOC"
+  >-------------------------------</a><a name="sumkahan">-</a>
+
+  qh_sumkahan( sum, error, value )
+    add value to sum with compensated (Kahan-Babuska-Neumaier) summation
+
+  returns:
+    updates sum and the accumulated round-off error.  The total is sum+error
+
+  notes:
+    the error term is exact if no overflow, even if |value| > |sum|
+    the total depends on the order of the values.  Callers add in list order
+*/
+void qh_sumkahan(realT *sum, realT *error, realT value) {
+  realT total= *sum + value;
+
+  if (fabs_(*sum) >= fabs_(value))
+    *error += (*sum - total) + value;
+  else
+    *error += (value - total) + *sum;
+  *sum= total;
+} /* sumkahan */
+
 /*-<a                             href="qh-geom_r.htm#TOC"
   >-------------------------------</a><a name="vertex_bestdist">-</a>
 
@@ -2208,14 +2927,18 @@ coordT qh_vertex_bestdist2(qhT *qh, setT *vertices, vertexT **vertexp/*= NULL*/,
   notes:
     only called by qh_facetcenter
     from Bowyer & Woodwark, A Programmer's Geometry, 1983, p. 65
+    for 2-d, 3-d, and 4-d, qh_voronoi_center_fixed computes the same determinants without qh.gm_matrix
 
   design:
     if non-simplicial
       determine max simplex for points
-    translate point0 of simplex to origin
-    compute sum of squares of diagonal
-    compute determinate
-    compute Voronoi center (see Bowyer & Woodwark)
+    if 2-d, 3-d, or 4-d
+      compute center with qh_voronoi_center_fixed
+    else
+      translate point0 of simplex to origin
+      compute sum of squares of diagonal
+      compute determinate
+      compute Voronoi center (see Bowyer & Woodwark)
 */
 pointT *qh_voronoi_center(qhT *qh, int dim, setT *points) {
   pointT *point, **pointp, *point0;
@@ -2239,48 +2962,56 @@ pointT *qh_voronoi_center(qhT *qh, int dim, setT *points) {
     qh_maxsimplex(qh, dim, points, NULL, 0, &simplex);
   }
   point0= SETfirstt_(simplex, pointT);
-  gmcoord= qh->gm_matrix;
-  for (k=0; k < dim; k++) {
-    qh->gm_row[k]= gmcoord;
-    FOREACHpoint_(simplex) {
-      if (point != point0)
-        *(gmcoord++)= point[k] - point0[k];
-    }
-  }
-  sum2row= gmcoord;
-  for (i=0; i < dim; i++) {
-    sum2= 0.0;
+  if (dim >= 2 && dim <= 4) {
+    det= qh_voronoi_center_fixed(qh, dim, SETaddr_(simplex, pointT), center);
+    factor= qh_divzero(0.5, det, qh->MINdenom, &infinite);
+  }else {
+    gmcoord= qh->gm_matrix;
     for (k=0; k < dim; k++) {
-      diffp= qh->gm_row[k] + i;
-      sum2 += *diffp * *diffp;
+      qh->gm_row[k]= gmcoord;
+      FOREACHpoint_(simplex) {
+        if (point != point0)
+          *(gmcoord++)= point[k] - point0[k];
+      }
     }
-    *(gmcoord++)= sum2;
-  }
-  det= qh_determinant(qh, qh->gm_row, dim, &nearzero);
-  factor= qh_divzero(0.5, det, qh->MINdenom, &infinite);
-  if (infinite) {
-    for (k=dim; k--; )
-      center[k]= qh_INFINITE;
-    if (qh->IStracing)
-      qh_printpoints(qh, qh->ferr, "qh_voronoi_center: at infinity for ", simplex);
-  }else {
+    sum2row= gmcoord;
     for (i=0; i < dim; i++) {
-      gmcoord= qh->gm_matrix;
-      sum2p= sum2row;
+      sum2= 0.0;
       for (k=0; k < dim; k++) {
-        qh->gm_row[k]= gmcoord;
-        if (k == i) {
-          for (j=dim; j--; )
-            *(gmcoord++)= *sum2p++;
-        }else {
-          FOREACHpoint_(simplex) {
-            if (point != point0)
-              *(gmcoord++)= point[k] - point0[k];
+        diffp= qh->gm_row[k] + i;
+        sum2 += *diffp * *diffp;
+      }
+      *(gmcoord++)= sum2;
+    }
+    det= qh_determinant(qh, qh->gm_row, dim, &nearzero);
+    factor= qh_divzero(0.5, det, qh->MINdenom, &infinite);
+    if (infinite) {
+      for (k=dim; k--; )
+        center[k]= qh_INFINITE;
+    }else {
+      for (i=0; i < dim; i++) {
+        gmcoord= qh->gm_matrix;
+        sum2p= sum2row;
+        for (k=0; k < dim; k++) {
+          qh->gm_row[k]= gmcoord;
+          if (k == i) {
+            for (j=dim; j--; )
+              *(gmcoord++)= *sum2p++;
+          }else {
+            FOREACHpoint_(simplex) {
+              if (point != point0)
+                *(gmcoord++)= point[k] - point0[k];
+            }
           }
         }
+        center[i]= qh_determinant(qh, qh->gm_row, dim, &nearzero)*factor + point0[i];
       }
-      center[i]= qh_determinant(qh, qh->gm_row, dim, &nearzero)*factor + point0[i];
     }
+  }
+  if (infinite) {
+    if (qh->IStracing)
+      qh_printpoints(qh, qh->ferr, "qh_voronoi_center: at infinity for ", simplex);
+  }else {
 #ifndef qh_NOtrace
     if (qh->IStracing >= 3) {
       qh_fprintf(qh, qh->ferr, 3061, "qh_voronoi_center: det %2.2g factor %2.2g ", det, factor);
@@ -2300,3 +3031,64 @@ pointT *qh_voronoi_center(qhT *qh, int dim, setT *points) {
   return center;
 } /* voronoi_center */
 
+/*-<a                             href="qh-geom_r.htm#TOC"
+  >-------------------------------</a><a name="voronoi_center_fixed">-</a>
+
+  qh_voronoi_center_fixed(qh, dim, simplex, center )
+    set center to the Voronoi center of a simplex in 2-d, 3-d, or 4-d
+    simplex is an array of dim+1 points, simplex[0] is the origin for the determinants
+    center is preallocated with at least dim coordinates
+
+  returns:
+    determinant of the translated simplex
+    center, or qh_INFINITE coordinates if the determinant is too small (qh_divzero)
+
+  notes:
+    called by qh_voronoi_center and by qh_setvoronoi_parallel for each thread
+    thread-safe.  Does not use qh.gm_matrix, qh_memalloc, trace, or statistics
+    same determinants as qh_voronoi_center with a fixed-size matrix on the stack
+      2-d and 3-d use det2_ and det3_ as in qh_determinant
+      4-d expands by the 2x2 minors of the first two rows instead of qh_gausselim
+    unrolled by the compiler for dim 2, 3, and 4
+
+  design:
+    translate simplex[0] to origin
+    compute sum of squares for each translated point
+    compute determinant
+    compute each coordinate of center by Cramer's rule (see Bowyer & Woodwark)
+*/
+realT qh_voronoi_center_fixed(qhT *qh, int dim, pointT **simplex, pointT *center) {
+  pointT *point0= simplex[0];
+  realT rows[4][4], sum2[4], saverow[4], det, factor;
+  int i, j, k;
+  bool infinite;
+
+  for (k=0; k < dim; k++) {
+    for (j=0; j < dim; j++)
+      rows[k][j]= simplex[j+1][k] - point0[k];
+  }
+  for (j=0; j < dim; j++) {
+    sum2[j]= 0.0;
+    for (k=0; k < dim; k++)
+      sum2[j] += rows[k][j] * rows[k][j];
+  }
+  det= qh_determinant_fixed(rows, dim);
+  factor= qh_divzero(0.5, det, qh->MINdenom, &infinite);
+  if (infinite) {
+    for (k=dim; k--; )
+      center[k]= qh_INFINITE;
+    return det;
+  }
+  for (i=0; i < dim; i++) {
+    for (j=0; j < dim; j++) {
+      saverow[j]= rows[i][j];
+      rows[i][j]= sum2[j];
+    }
+    center[i]= qh_determinant_fixed(rows, dim)*factor + point0[i];
+    for (j=0; j < dim; j++)
+      rows[i][j]= saverow[j];
+  }
+  return det;
+} /* voronoi_center_fixed */
+
+
@@ -281,6 +281,7 @@ LABELreturn_best:
     called by qh_findbestnew if point is not outside a new facet
     called by qh_check_maxout for each point in hull
     called by qh_check_bestdist for each point in hull (rarely used)
+    calls qh_query_findhorizon without a query.  With a query, the same search is read-only
 
     no early out -- use qh_findbest() or qh_findbestnew()
     Searches coplanar or better horizon facets
@@ -304,100 +305,8 @@ LABELreturn_best:
          update best facet
 */
 facetT *qh_findbesthorizon(qhT *qh, bool ischeckmax, pointT* point, facetT *startfacet, bool noupper, realT *bestdist, int *numpart) {
-  facetT *bestfacet= startfacet;
-  realT dist;
-  facetT *neighbor, **neighborp, *facet;
-  facetT *nextfacet= NULL; /* optimize last facet of coplanarfacetset */
-  int numpartinit= *numpart, coplanarfacetset_size, numcoplanar= 0, numfacet= 0;
-  unsigned int visitid= ++qh->visit_id;
-  bool newbest= false; /* for tracing */
-  realT minsearch, searchdist;  /* skip facets that are too far from point */
-  bool is_5x_minsearch;
 
-  if (!ischeckmax) {
-    zinc_(Zfindhorizon);
-  }else {
-#if qh_MAXoutside
-    if ((!qh->ONLYgood || startfacet->good) && *bestdist > startfacet->maxoutside)
-      startfacet->maxoutside= *bestdist;
-#endif
-  }
-  searchdist= qh_SEARCHdist; /* an expression, a multiple of qh.max_outside and precision constants */
-  minsearch= *bestdist - searchdist;
-  if (ischeckmax) {
-    /* Always check coplanar facets.  Needed for RBOX 1000 s Z1 G1e-13 t996564279 | QHULL Tv */
-    minimize_(minsearch, -searchdist);
-  }
-  coplanarfacetset_size= 0;
-  startfacet->visitid= visitid;
-  facet= startfacet;
-  while (true) {
-    numfacet++;
-    is_5x_minsearch= (ischeckmax && facet->nummerge > 10 && qh_setsize(qh, facet->neighbors) > 100);  /* QH11033 FIX: qh_findbesthorizon: many tests for facets with many merges and neighbors.  Can hide coplanar facets, e.g., 'rbox 1000 s Z1 G1e-13' with 4400+ neighbors */
-    trace4((qh, qh->ferr, 4002, "qh_findbesthorizon: test neighbors of f%d bestdist %2.2g f%d ischeckmax? %d noupper? %d minsearch %2.2g is_5x? %d searchdist %2.2g\n",
-                facet->id, *bestdist, getid_(bestfacet), ischeckmax, noupper,
-                minsearch, is_5x_minsearch, searchdist));
-    FOREACHneighbor_(facet) {
-      if (neighbor->visitid == visitid)
-        continue;
-      neighbor->visitid= visitid;
-      if (!neighbor->flipped) {  /* neighbors of flipped facets always searched via nextfacet */
-        qh_distplane(qh, point, neighbor, &dist); /* duplicate qh_distpane for new facets, they may be coplanar */
-        (*numpart)++;
-        if (dist > *bestdist) {
-          if (!neighbor->upperdelaunay || ischeckmax || (!noupper && dist >= qh->MINoutside)) {
-            if (!ischeckmax) {
-              minsearch= dist - searchdist;
-              if (dist > *bestdist + searchdist) {
-                zinc_(Zfindjump);  /* everything in qh.coplanarfacetset at least searchdist below */
-                coplanarfacetset_size= 0;
-              }
-            }
-            bestfacet= neighbor;
-            *bestdist= dist;
-            newbest= true;
-          }
-        }else if (is_5x_minsearch) {
-          if (dist < 5 * minsearch)
-            continue; /* skip this neighbor, do not set nextfacet.  dist is negative */
-        }else if (dist < minsearch)
-          continue;  /* skip this neighbor, do not set nextfacet.  If ischeckmax, dist can't be positive */
-#if qh_MAXoutside
-        if (ischeckmax && dist > neighbor->maxoutside)
-          neighbor->maxoutside= dist;
-#endif
-      } /* end of !flipped, need to search neighbor */
-      if (nextfacet) {
-        numcoplanar++;
-        if (!coplanarfacetset_size++) {
-          SETfirst_(qh->coplanarfacetset)= nextfacet;
-          SETtruncate_(qh->coplanarfacetset, 1);
-        }else
-          qh_setappend(qh, &qh->coplanarfacetset, nextfacet); /* Was needed for RBOX 1000 s W1e-13 P0 t996547055 | QHULL d Qbb Qc Tv
-                                                 and RBOX 1000 s Z1 G1e-13 t996564279 | qhull Tv  */
-      }
-      nextfacet= neighbor;
-    } /* end of EACHneighbor */
-    facet= nextfacet;
-    if (facet)
-      nextfacet= NULL;
-    else if (!coplanarfacetset_size)
-      break;
-    else if (!--coplanarfacetset_size) {
-      facet= SETfirstt_(qh->coplanarfacetset, facetT);
-      SETtruncate_(qh->coplanarfacetset, 0);
-    }else
-      facet= (facetT *)qh_setdellast(qh->coplanarfacetset);
-  } /* while true, i.e., "for each facet in qh.coplanarfacetset" */
-  if (!ischeckmax) {
-    zadd_(Zfindhorizontot, *numpart - numpartinit);
-    zmax_(Zfindhorizonmax, *numpart - numpartinit);
-    if (newbest)
-      zinc_(Znewbesthorizon);
-  }
-  trace4((qh, qh->ferr, 4003, "qh_findbesthorizon: p%d, newbest? %d, bestfacet f%d, bestdist %2.2g, numfacet %d, coplanarfacets %d, numdist %d\n",
-    qh_pointid(qh, point), newbest, getid_(bestfacet), *bestdist, numfacet, numcoplanar, *numpart - numpartinit));
-  return bestfacet;
+  return qh_query_findhorizon(qh, NULL, ischeckmax, point, startfacet, noupper, bestdist, numpart, NULL);
 }  /* findbesthorizon */
 
 /*-<a                             href="qh-geom_r.htm#TOC"
@@ -540,6 +449,7 @@ LABELreturn_bestnew:
 
   notes:
      assumes numrow == numcol-1
+     qh_backnormal_local does the back substitution
 
      see Golub & van Loan, 1983, Eq. 4.4-9 for "Gaussian elimination with complete pivoting"
 
@@ -559,6 +469,32 @@ LABELreturn_bestnew:
 */
 void qh_backnormal(qhT *qh, realT **rows, int numrow, int numcol, bool sign,
         coordT *normal, bool *nearzero) {
+  int zerocol;
+
+  zerocol= qh_backnormal_local(qh, rows, numrow, numcol, sign, normal);
+  if (zerocol != -1) {
+    *nearzero= true;
+    trace4((qh, qh->ferr, 4005, "qh_backnormal: zero diagonal at column %d.\n", zerocol));
+    zzinc_(Zback0);
+    qh_joggle_restart(qh, "zero diagonal on back substitution");
+  }
+} /* backnormal */
+
+/*-<a                             href="qh-geom_r.htm#TOC"
+  >-------------------------------</a><a name="backnormal_local">-</a>
+
+  qh_backnormal_local(qh, rows, numrow, numcol, sign, normal )
+    back substitution for qh_backnormal, without side effects
+
+  returns:
+    normal, the same as qh_backnormal
+    the first column with a zero diagonal, or -1 if none
+
+  notes:
+    thread-safe, no statistics, tracing, or qh_joggle_restart
+    called by qh_backnormal and qh_setfacetplane_local
+*/
+int qh_backnormal_local(qhT *qh, realT **rows, int numrow, int numcol, bool sign, coordT *normal) {
   int i, j;
   coordT *normalp, *normal_tail, *ai, *ak;
   realT diagonal;
@@ -588,13 +524,93 @@ void qh_backnormal(qhT *qh, realT **rows, int numrow, int numcol, bool sign,
         normalp--;
     }
   }
-  if (zerocol != -1) {
-    *nearzero= true;
-    trace4((qh, qh->ferr, 4005, "qh_backnormal: zero diagonal at column %d.\n", i));
-    zzinc_(Zback0);
-    qh_joggle_restart(qh, "zero diagonal on back substitution");
+  return zerocol;
+} /* backnormal_local */
+
+/*-<a                             href="qh-geom_r.htm#TOC"
+  >-------------------------------</a><a name="detnormal">-</a>
+
+  qh_detnormal( dim, rows, normal )
+    set the unnormalized normal of a 2-d, 3-d, or 4-d simplex from its determinants
+    rows[] is one row per point
+
+  notes:
+    thread-safe, rows[] is not modified
+    called by qh_sethyperplane_det and qh_setfacetplane_local
+*/
+void qh_detnormal(int dim, coordT **rows, coordT *normal) {
+
+  if (dim == 2) {
+    normal[0]= dY(1,0);
+    normal[1]= dX(0,1);
+  }else if (dim == 3) {
+    normal[0]= det2_(dY(2,0), dZ(2,0),
+                     dY(1,0), dZ(1,0));
+    normal[1]= det2_(dX(1,0), dZ(1,0),
+                     dX(2,0), dZ(2,0));
+    normal[2]= det2_(dX(2,0), dY(2,0),
+                     dX(1,0), dY(1,0));
+  }else if (dim == 4) {
+    normal[0]= - det3_(dY(2,0), dZ(2,0), dW(2,0),
+                        dY(1,0), dZ(1,0), dW(1,0),
+                        dY(3,0), dZ(3,0), dW(3,0));
+    normal[1]=   det3_(dX(2,0), dZ(2,0), dW(2,0),
+                        dX(1,0), dZ(1,0), dW(1,0),
+                        dX(3,0), dZ(3,0), dW(3,0));
+    normal[2]= - det3_(dX(2,0), dY(2,0), dW(2,0),
+                        dX(1,0), dY(1,0), dW(1,0),
+                        dX(3,0), dY(3,0), dW(3,0));
+    normal[3]=   det3_(dX(2,0), dY(2,0), dZ(2,0),
+                        dX(1,0), dY(1,0), dZ(1,0),
+                        dX(3,0), dY(3,0), dZ(3,0));
   }
-} /* backnormal */
+} /* detnormal */
+
+/*-<a                             href="qh-geom_r.htm#TOC"
+  >-------------------------------</a><a name="detoffset">-</a>
+
+  qh_detoffset(qh, dim, rows, point0, normal, offset )
+    set the offset of a normalized 2-d, 3-d, or 4-d hyperplane through point0
+
+  returns:
+    offset
+    true if a 3-d or 4-d point of rows[] is more than qh.DISTround from the hyperplane
+
+  notes:
+    thread-safe
+    called by qh_sethyperplane_det and qh_setfacetplane_local
+*/
+bool qh_detoffset(qhT *qh, int dim, coordT **rows, coordT *point0, coordT *normal, realT *offset) {
+  realT maxround, dist;
+  int i;
+  pointT *point;
+
+  if (dim == 2) {
+    *offset= -(point0[0]*normal[0]+point0[1]*normal[1]);
+    return false;
+  }else if (dim == 3) {
+    *offset= -(point0[0]*normal[0] + point0[1]*normal[1]
+               + point0[2]*normal[2]);
+  }else {
+    *offset= -(point0[0]*normal[0] + point0[1]*normal[1]
+               + point0[2]*normal[2] + point0[3]*normal[3]);
+  }
+  maxround= qh->DISTround;
+  for (i=dim; i--; ) {
+    point= rows[i];
+    if (point != point0) {
+      if (dim == 3)
+        dist= *offset + (point[0]*normal[0] + point[1]*normal[1]
+               + point[2]*normal[2]);
+      else
+        dist= *offset + (point[0]*normal[0] + point[1]*normal[1]
+               + point[2]*normal[2] + point[3]*normal[3]);
+      if (dist > maxround || dist < -maxround)
+        return true;
+    }
+  }
+  return false;
+} /* detoffset */
 
 /*-<a                             href="qh-geom_r.htm#TOC"
   >-------------------------------</a><a name="gausselim">-</a>
@@ -610,6 +626,51 @@ void qh_backnormal(qhT *qh, realT **rows, int numrow, int numcol, bool sign,
   notes:
     if nearzero, the determinant's sign may be incorrect.
     assumes numrow <= numcol
+    qh_gausselim_local does the elimination
+
+  design:
+    eliminate rows with qh_gausselim_local
+    if a zero pivot
+      update Zgauss0 and restart if joggle
+    update Wmindenom with the last pivot
+*/
+void qh_gausselim(qhT *qh, realT **rows, int numrow, int numcol, bool *sign, bool *nearzero) {
+  realT lastpivot;
+  int zeropivots;
+
+  zeropivots= qh_gausselim_local(qh, rows, numrow, numcol, sign, nearzero, &lastpivot);
+  if (zeropivots) {
+#ifndef qh_NOtrace
+    if (qh->IStracing >= 4) {
+      qh_fprintf(qh, qh->ferr, 8011, "qh_gausselim: %d zero pivots. (%2.2g)\n", zeropivots, qh->DISTround);
+      qh_printmatrix(qh, qh->ferr, "Matrix:", rows, numrow, numcol);
+    }
+#endif
+    zzadd_(Zgauss0, zeropivots);
+    qh_joggle_restart(qh, "zero pivot for Gaussian elimination");
+  }
+  wmin_(Wmindenom, lastpivot);  /* last pivot element */
+  if (qh->IStracing >= 5)
+    qh_printmatrix(qh, qh->ferr, "qh_gausselem: result", rows, numrow, numcol);
+} /* gausselim */
+
+/*-<a                             href="qh-geom_r.htm#TOC"
+  >-------------------------------</a><a name="gausselim_local">-</a>
+
+  qh_gausselim_local(qh, rows, numrow, numcol, sign, nearzero, &lastpivot )
+    Gaussian elimination with partial pivoting, without side effects
+
+  returns:
+    number of zero pivots.  Their columns are skipped
+    rows is upper triangular (includes row exchanges)
+    flips sign for each row exchange
+    sets nearzero if pivot[k] < qh.NEARzero[k], else clears it
+    lastpivot is the absolute value of the last pivot element
+
+  notes:
+    thread-safe, no statistics, tracing, or qh_joggle_restart
+    called by qh_gausselim and qh_determinant_local
+    assumes numrow <= numcol
 
   design:
     for each row
@@ -617,10 +678,10 @@ void qh_backnormal(qhT *qh, realT **rows, int numrow, int numcol, bool sign,
       test for near zero
       perform gaussian elimination step
 */
-void qh_gausselim(qhT *qh, realT **rows, int numrow, int numcol, bool *sign, bool *nearzero) {
+int qh_gausselim_local(qhT *qh, realT **rows, int numrow, int numcol, bool *sign, bool *nearzero, realT *lastpivot) {
   realT *ai, *ak, *rowp, *pivotrow;
   realT n, pivot, pivot_abs= 0.0, temp;
-  int i, j, k, pivoti, flip=0;
+  int i, j, k, pivoti, zeropivots= 0;
 
   *nearzero= false;
   for (k=0; k < numrow; k++) {
@@ -637,20 +698,12 @@ void qh_gausselim(qhT *qh, realT **rows, int numrow, int numcol, bool *sign, boo
       rows[pivoti]= rows[k];
       rows[k]= rowp;
       *sign ^= 1;
-      flip ^= 1;
     }
     if (pivot_abs <= qh->NEARzero[k]) {
       *nearzero= true;
       if (pivot_abs == 0.0) {   /* remainder of column == 0 */
-#ifndef qh_NOtrace
-        if (qh->IStracing >= 4) {
-          qh_fprintf(qh, qh->ferr, 8011, "qh_gausselim: 0 pivot at column %d. (%2.2g < %2.2g)\n", k, pivot_abs, qh->DISTround);
-          qh_printmatrix(qh, qh->ferr, "Matrix:", rows, numrow, numcol);
-        }
-#endif
-        zzinc_(Zgauss0);
-        qh_joggle_restart(qh, "zero pivot for Gaussian elimination");
-        goto LABELnextcol;
+        zeropivots++;
+        continue;
       }
     }
     pivotrow= rows[k] + k;
@@ -662,13 +715,10 @@ void qh_gausselim(qhT *qh, realT **rows, int numrow, int numcol, bool *sign, boo
       for (j= numcol - (k+1); j--; )
         *ai++ -= n * *ak++;
     }
-  LABELnextcol:
-    ;
   }
-  wmin_(Wmindenom, pivot_abs);  /* last pivot element */
-  if (qh->IStracing >= 5)
-    qh_printmatrix(qh, qh->ferr, "qh_gausselem: result", rows, numrow, numcol);
-} /* gausselim */
+  *lastpivot= pivot_abs;
+  return zeropivots;
+} /* gausselim_local */
 
 
 /*-<a                             href="qh-geom_r.htm#TOC"
@@ -831,19 +881,52 @@ void qh_normalize(qhT *qh, coordT *normal, int dim, bool toporient) {
        bumps Znearlysingular
 
   design:
-    computes norm
+    normalize with qh_normalize2_local
+      if not near zero
+        normalizes normal
+      else if zero norm
+        sets normal to standard value
+      else
+        uses qh_divzero to normalize
+        if nearzero
+          sets norm to direction of maximum value
     test for minnorm
-    if not near zero
-      normalizes normal
-    else if zero norm
-      sets normal to standard value
-    else
-      uses qh_divzero to normalize
-      if nearzero
-        sets norm to direction of maximum value
 */
 void qh_normalize2(qhT *qh, coordT *normal, int dim, bool toporient,
             realT *minnorm, bool *ismin) {
+  realT norm;
+
+  if (qh_normalize2_local(qh, normal, dim, toporient, &norm)) {
+    zzinc_(Znearlysingular);
+    /* qh_joggle_restart ignored for Znearlysingular, normal part of qh_sethyperplane_gauss */
+    trace0((qh, qh->ferr, 1, "qh_normalize: norm=%2.2g too small during p%d\n",
+           norm, qh->furthest_id));
+  }
+  if (minnorm) {
+    if (norm < *minnorm)
+      *ismin= true;
+    else
+      *ismin= false;
+  }
+  wmin_(Wmindenom, norm);
+} /* normalize */
+
+/*-<a                             href="qh-geom_r.htm#TOC"
+  >-------------------------------</a><a name="normalize2_local">-</a>
+
+  qh_normalize2_local(qh, normal, dim, toporient, &norm )
+    normalize a vector for qh_normalize2, without side effects
+
+  returns:
+    normalized vector, the same as qh_normalize2
+    norm of the vector
+    true if nearly singular (divide by zero).  Sets the largest element to +/-1
+
+  notes:
+    thread-safe, no statistics or tracing
+    called by qh_normalize2 and qh_setfacetplane_local
+*/
+bool qh_normalize2_local(qhT *qh, coordT *normal, int dim, bool toporient, realT *normp) {
   int k;
   realT *colp, *maxp, norm= 0, temp, *norm1, *norm2, *norm3;
   bool zerodiv;
@@ -865,13 +948,7 @@ void qh_normalize2(qhT *qh, coordT *normal, int dim, bool toporient,
       norm += (*colp) * (*colp);
     norm= sqrt(norm);
   }
-  if (minnorm) {
-    if (norm < *minnorm)
-      *ismin= true;
-    else
-      *ismin= false;
-  }
-  wmin_(Wmindenom, norm);
+  *normp= norm;
   if (norm > qh->MINdenom) {
     if (!toporient)
       norm= -norm;
@@ -907,15 +984,12 @@ void qh_normalize2(qhT *qh, coordT *normal, int dim, bool toporient,
         for (k=dim, colp=normal; k--; colp++)
           *colp= 0.0;
         *maxp= temp;
-        zzinc_(Znearlysingular);
-        /* qh_joggle_restart ignored for Znearlysingular, normal part of qh_sethyperplane_gauss */
-        trace0((qh, qh->ferr, 1, "qh_normalize: norm=%2.2g too small during p%d\n",
-               norm, qh->furthest_id));
-        return;
+        return true;
       }
     }
   }
-} /* normalize */
+  return false;
+} /* normalize2_local */
 
 
 /*-<a                             href="qh-geom_r.htm#TOC"
@@ -967,13 +1041,13 @@ pointT *qh_projectpoint(qhT *qh, pointT *point, facetT *facet, realT dist) {
       recompute determinate with gaussian elimination
       if nearzero
         force outside orientation by testing interior point
+    finish with qh_setfacetplane_finish
 */
 void qh_setfacetplane(qhT *qh, facetT *facet) {
   pointT *point;
   vertexT *vertex, **vertexp;
   int normsize= qh->normal_size;
   int k,i, oldtrace= 0;
-  realT dist;
   void **freelistp; /* used if !qh_NOmem by qh_memalloc_() */
   coordT *coord, *gmcoord;
   pointT *point0= SETfirstt_(facet->vertices, vertexT)->point;
@@ -1049,6 +1123,34 @@ void qh_setfacetplane(qhT *qh, facetT *facet) {
       }
     }
   }
+  qh_setfacetplane_finish(qh, facet);
+  if (facet == qh->tracefacet) {
+    qh->IStracing= oldtrace;
+    qh_printfacet(qh, qh->ferr, facet);
+  }
+} /* setfacetplane */
+
+
+/*-<a                             href="qh-geom_r.htm#TOC"
+  >-------------------------------</a><a name="setfacetplane_finish">-</a>
+
+  qh_setfacetplane_finish(qh, facet )
+    finish a new hyperplane for a facet from qh_setfacetplane or qh_setfacetplane_all
+
+  returns:
+    sets facet->upperdelaunay if upper envelope of Delaunay triangulation
+    updates Wnewvertex, Wnewvertexmax, and qh.max_outside if PRINTstatistics, tracing, or joggle
+    facet->flipped if qh_checkflipped
+
+  notes:
+    does not update Zsetplane
+*/
+void qh_setfacetplane_finish(qhT *qh, facetT *facet) {
+  vertexT *vertex, **vertexp;
+  pointT *point0= SETfirstt_(facet->vertices, vertexT)->point;
+  realT dist;
+  int k;
+
   facet->upperdelaunay= false;
   if (qh->DELAUNAY) {
     if (qh->UPPERdelaunay) {     /* matches qh_triangulate_facet and qh.lower_threshold in qh_initbuild */
@@ -1098,11 +1200,7 @@ void qh_setfacetplane(qhT *qh, facetT *facet) {
   }
 #endif
   qh_checkflipped(qh, facet, NULL, qh_ALL);
-  if (facet == qh->tracefacet) {
-    qh->IStracing= oldtrace;
-    qh_printfacet(qh, qh->ferr, facet);
-  }
-} /* setfacetplane */
+} /* setfacetplane_finish */
 
 
 /*-<a                             href="qh-geom_r.htm#TOC"
@@ -1123,6 +1221,7 @@ void qh_setfacetplane(qhT *qh, facetT *facet) {
     only defined for dim == 2..4
     rows[] is not modified
     solves det(P-V_0, V_n-V_0, ..., V_1-V_0)=0, i.e. every point is on hyperplane
+    qh_detnormal, qh_normalize2, and qh_detoffset compute the hyperplane
     see Bower & Woodworth, A programmer's geometry, Butterworths 1983.
 
   derivation of 3-d minnorm
@@ -1151,68 +1250,13 @@ void qh_setfacetplane(qhT *qh, facetT *facet) {
 */
 void qh_sethyperplane_det(qhT *qh, int dim, coordT **rows, coordT *point0,
           bool toporient, coordT *normal, realT *offset, bool *nearzero) {
-  realT maxround, dist;
-  int i;
-  pointT *point;
 
-
-  if (dim == 2) {
-    normal[0]= dY(1,0);
-    normal[1]= dX(0,1);
-    qh_normalize2(qh, normal, dim, toporient, NULL, NULL);
-    *offset= -(point0[0]*normal[0]+point0[1]*normal[1]);
+  qh_detnormal(dim, rows, normal);
+  qh_normalize2(qh, normal, dim, toporient, NULL, NULL);
+  if (qh_detoffset(qh, dim, rows, point0, normal, offset))
+    *nearzero= true;
+  else if (dim == 2)
     *nearzero= false;  /* since nearzero norm => incident points */
-  }else if (dim == 3) {
-    normal[0]= det2_(dY(2,0), dZ(2,0),
-                     dY(1,0), dZ(1,0));
-    normal[1]= det2_(dX(1,0), dZ(1,0),
-                     dX(2,0), dZ(2,0));
-    normal[2]= det2_(dX(2,0), dY(2,0),
-                     dX(1,0), dY(1,0));
-    qh_normalize2(qh, normal, dim, toporient, NULL, NULL);
-    *offset= -(point0[0]*normal[0] + point0[1]*normal[1]
-               + point0[2]*normal[2]);
-    maxround= qh->DISTround;
-    for (i=dim; i--; ) {
-      point= rows[i];
-      if (point != point0) {
-        dist= *offset + (point[0]*normal[0] + point[1]*normal[1]
-               + point[2]*normal[2]);
-        if (dist > maxround || dist < -maxround) {
-          *nearzero= true;
-          break;
-        }
-      }
-    }
-  }else if (dim == 4) {
-    normal[0]= - det3_(dY(2,0), dZ(2,0), dW(2,0),
-                        dY(1,0), dZ(1,0), dW(1,0),
-                        dY(3,0), dZ(3,0), dW(3,0));
-    normal[1]=   det3_(dX(2,0), dZ(2,0), dW(2,0),
-                        dX(1,0), dZ(1,0), dW(1,0),
-                        dX(3,0), dZ(3,0), dW(3,0));
-    normal[2]= - det3_(dX(2,0), dY(2,0), dW(2,0),
-                        dX(1,0), dY(1,0), dW(1,0),
-                        dX(3,0), dY(3,0), dW(3,0));
-    normal[3]=   det3_(dX(2,0), dY(2,0), dZ(2,0),
-                        dX(1,0), dY(1,0), dZ(1,0),
-                        dX(3,0), dY(3,0), dZ(3,0));
-    qh_normalize2(qh, normal, dim, toporient, NULL, NULL);
-    *offset= -(point0[0]*normal[0] + point0[1]*normal[1]
-               + point0[2]*normal[2] + point0[3]*normal[3]);
-    maxround= qh->DISTround;
-    for (i=dim; i--; ) {
-      point= rows[i];
-      if (point != point0) {
-        dist= *offset + (point[0]*normal[0] + point[1]*normal[1]
-               + point[2]*normal[2] + point[3]*normal[3]);
-        if (dist > maxround || dist < -maxround) {
-          *nearzero= true;
-          break;
-        }
-      }
-    }
-  }
   if (*nearzero) {
     zzinc_(Zminnorm);
     /* qh_joggle_restart not needed, will call qh_sethyperplane_gauss instead */
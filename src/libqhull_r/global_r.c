@@ -18,6 +18,10 @@
 
 #include <qhull/qhull_ra.h>
 
+#if qh_PARALLEL
+#include <omp.h>
+#endif
+
 /*========= qh->definition -- globals defined in libqhull_r.h =======================*/
 
 /*-<a                             href  ="qh-globa_r.htm#TOC"
@@ -278,6 +282,7 @@ void qh_freebuffers(qhT *qh) {
   /* allocated by qh_initqhull_buffers */
   qh_setfree(qh, &qh->other_points);
   qh_setfree(qh, &qh->del_vertices);
+  qh_setfree(qh, &qh->restart_simplex);  /* allocated by qh_initialvertices for 'Q16' */
   qh_setfree(qh, &qh->coplanarfacetset);
   qh_memfree(qh, qh->NEARzero, qh->hull_dim * (int)sizeof(realT));
   qh_memfree(qh, qh->lower_threshold, (qh->input_dim+1) * (int)sizeof(realT));
@@ -312,6 +317,16 @@ void qh_freebuffers(qhT *qh) {
     qh_free(qh->input_points);
     qh->input_points= NULL;
   }
+  if (qh->input_ids) {         /* set by qh_new_qhull_outofcore */
+    qh_free(qh->input_ids);
+    qh->input_ids= NULL;
+  }
+  qh_perfstop(qh);             /* opened by qh_perfstart */
+  if (qh->profile_addtime) {   /* allocated by qh_profileaddpoint */
+    qh_free(qh->profile_addtime);
+    qh->profile_addtime= NULL;
+    qh->profile_addcount= qh->profile_addsize= 0;
+  }
   trace5((qh, qh->ferr, 5002, "qh_freebuffers: finished\n"));
 } /* freebuffers */
 
@@ -331,7 +346,7 @@ void qh_freebuffers(qhT *qh) {
       free ridges
       free outside set, coplanar set, neighbor set, ridge set, vertex set
       free facet
-    free hash table
+    free hash table and point-location grid
     free interior point
     free merge sets
     free temporary sets
@@ -356,6 +371,7 @@ void qh_freebuild(qhT *qh, bool allmem) {
   qh->degen_mergeset= NULL;  /* temp set freed by qh_settempfree_all */
   qh->vertex_mergeset= NULL;  /* temp set freed by qh_settempfree_all */
   qh_setfree(qh, &(qh->hash_table));
+  qh_locate_free(qh);
   trace5((qh, qh->ferr, 5003, "qh_freebuild: free temporary sets (qh_settempfree_all)\n"));
   qh_settempfree_all(qh);
   trace1((qh, qh->ferr, 1005, "qh_freebuild: free memory from qh_inithull and qh_buildhull\n"));
@@ -526,8 +542,11 @@ void qh_init_A(qhT *qh, FILE *infile, FILE *outfile, FILE *errfile, int argc, ch
   notes:
     called after points are defined
     qh_errexit() may be used
+    if 'Tj', charges the time to qh_PHASEproject
 */
 void qh_init_B(qhT *qh, coordT *points, int numpoints, int dim, bool ismalloc) {
+  int prevphase= qh_profilephase(qh, qh_PHASEproject);
+
   qh_initqhull_globals(qh, points, numpoints, dim, ismalloc);
   if (qh->qhmem.LASTsize == 0)
     qh_initqhull_mem(qh);
@@ -551,6 +570,7 @@ void qh_init_B(qhT *qh, coordT *points, int numpoints, int dim, bool ismalloc) {
     qh_gram_schmidt(qh, qh->hull_dim, qh->gm_row);
     qh_rotateinput(qh, qh->gm_row);
   }
+  qh_profilephase(qh, prevphase);
 } /* init_B */
 
 /*-<a                             href="qh-globa_r.htm#TOC"
@@ -607,6 +627,7 @@ void qh_init_qhull_command(qhT *qh, int argc, char *argv[]) {
           check syntax
           append appropriate option to option string
           set appropriate global variable or append printFormat to print options
+    if 'Ts' or 'Tj', start the hardware counters of qh_PERFCOUNTERS
 */
 void qh_initflags(qhT *qh, char *command) {
   int k, i, lastproject;
@@ -1200,6 +1221,18 @@ void qh_initflags(qhT *qh, char *command) {
             qh_option(qh, "Q15-check-duplicates", NULL, NULL);
             qh->CHECKduplicates= true;
             break;
+          case '6':
+            qh_option(qh, "Q16-reuse-simplex", NULL, NULL);
+            qh->REUSEsimplex= true;
+            break;
+          case '8':
+            qh_option(qh, "Q18-build-2d", NULL, NULL);
+            qh->BUILD2d= true;
+            break;
+          case '9':
+            qh_option(qh, "Q19-build-3d", NULL, NULL);
+            qh->BUILD3d= true;
+            break;
           default:
             s--;
             qh_fprintf(qh, qh->ferr, 7016, "qhull option warning: unknown 'Q' qhull option 'Q1%c', skip to next space\n", (int)s[0]);
@@ -1272,6 +1305,15 @@ void qh_initflags(qhT *qh, char *command) {
             qh_option(qh, "QJoggle", NULL, &qh->JOGGLEmax);
           }
           break;
+        case 'P':
+          if (!isdigit(*s)) {
+            qh_fprintf(qh, qh->ferr, 7102, "qhull option warning: missing number of threads for option 'QPn'\n");
+            lastwarning= s-2;
+          }else {
+            qh->PARALLELthreads= qh_strtol(s, &s);
+            qh_option(qh, "QParallel-threads", &qh->PARALLELthreads, NULL);
+          }
+          break;
         case 'R':
           if (!isdigit(*s) && *s != '-') {
             qh_fprintf(qh, qh->ferr, 7020, "qhull option warning: missing random seed for option 'QRn'\n");
@@ -1331,6 +1373,12 @@ void qh_initflags(qhT *qh, char *command) {
           qh_option(qh, "Tflush", NULL, NULL);
           qh->FLUSHprint= true;
           break;
+        case 'j':
+          qh_option(qh, "Tjson-profile", NULL, NULL);
+          qh->PRINTprofile= true;
+          qh->profile_phase= qh_PHASEother;
+          qh->profile_start= qh_wallclock();
+          break;
         case 's':
           qh_option(qh, "Tstatistics", NULL, NULL);
           qh->PRINTstatistics= true;
@@ -1521,6 +1569,8 @@ void qh_initflags(qhT *qh, char *command) {
           command, (int)(lastwarning-command));
     qh_errexit(qh, qh_ERRinput, NULL, NULL);
   }
+  if (qh->PRINTstatistics || qh->PRINTprofile)
+    qh_perfstart(qh);  /* nop unless qh_PERFCOUNTERS */
   trace4((qh, qh->ferr, 4093, "qh_initflags: option flags initialized\n"));
   /* set derived values in qh_initqhull_globals */
 } /* initflags */
@@ -2251,6 +2301,41 @@ void qh_option(qhT *qh, const char *option, int *i, realT *r) {
   strncat(qh->qhull_options, buf, (unsigned int)remainder);
 } /* option */
 
+/*-<a                             href="qh-globa_r.htm#TOC"
+  >-------------------------------</a><a name="parallelthreads">-</a>
+
+  qh_parallelthreads(qh, count )
+    return number of threads for a parallel loop over count items
+
+  returns:
+    1 if serial (!qh_PARALLEL, 'QP1', 'Tn', or count < qh_PARALLELmin)
+    otherwise qh.PARALLELthreads ('QPn') or the OpenMP default
+
+  notes:
+    the caller divides the items into contiguous ranges, one per thread
+    parallel sections may not call qh_errexit, qh_memalloc, or qh_settemp
+*/
+int qh_parallelthreads(qhT *qh, int count) {
+#if qh_PARALLEL
+  int numthreads;
+
+  if (qh->PARALLELthreads == 1 || qh->IStracing || count < qh_PARALLELmin)
+    return 1;
+  if (qh->PARALLELthreads > 1)
+    numthreads= qh->PARALLELthreads;
+  else
+    numthreads= omp_get_max_threads();
+  minimize_(numthreads, count);
+  maximize_(numthreads, 1);
+  return numthreads;
+#else
+  QHULL_UNUSED(count)
+  QHULL_UNUSED(qh)
+
+  return 1;
+#endif
+} /* parallelthreads */
+
 /*-<a                             href="qh-globa_r.htm#TOC"
   >-------------------------------</a><a name="zero">-</a>
 
@@ -40,6 +40,7 @@
 */
 void qh_produce_output(qhT *qh) {
     int tempsize= qh_setsize(qh, qh->qhmem.tempstack);
+    int prevphase= qh_profilephase(qh, qh_PHASEoutput);
 
     qh_prepare_output(qh);
     qh_produce_output2(qh);
@@ -48,11 +49,13 @@ void qh_produce_output(qhT *qh) {
             qh_setsize(qh, qh->qhmem.tempstack));
         qh_errexit(qh, qh_ERRqhull, NULL, NULL);
     }
+    qh_profilephase(qh, prevphase);
 } /* produce_output */
 
 
 void qh_produce_output2(qhT *qh) {
   int i, tempsize= qh_setsize(qh, qh->qhmem.tempstack), d_1;
+  int prevphase= qh_profilephase(qh, qh_PHASEoutput);
 
   fflush(NULL);
   if (qh->PRINTsummary)
@@ -84,6 +87,7 @@ void qh_produce_output2(qhT *qh) {
              qh_setsize(qh, qh->qhmem.tempstack));
     qh_errexit(qh, qh_ERRqhull, NULL, NULL);
   }
+  qh_profilephase(qh, prevphase);
 } /* produce_output2 */
 
 /*-<a                             href="qh-io_r.htm#TOC"
@@ -712,10 +716,12 @@ int qh_eachvoronoi(qhT *qh, FILE *fp, printvridgeT printvridge, vertexT *atverte
   notes:
     Not used for qhull.exe
     same effect as qh_printvdiagram but ridges not sorted by point id
+    uses qh_eachvoronoi_edges, in parallel if 'QPn' or OpenMP and printvridge is NULL or qh_printvridge
 */
 int qh_eachvoronoi_all(qhT *qh, FILE *fp, printvridgeT printvridge, bool isUpper, qh_RIDGE innerouter, bool inorder) {
   facetT *facet;
   vertexT *vertex;
+  setT *vertices;
   int numcenters= 1;  /* vertex 0 is vertex-at-infinity */
   int totridges= 0;
 
@@ -731,17 +737,714 @@ int qh_eachvoronoi_all(qhT *qh, FILE *fp, printvridgeT printvridge, bool isUpper
     if (facet->upperdelaunay == isUpper)
       facet->visitid= (unsigned int)(numcenters++);
   }
-  FORALLvertices
-    vertex->seen= false;
+  vertices= qh_settemp(qh, qh->num_vertices);
   FORALLvertices {
-    if (qh->GOODvertex > 0 && qh_pointid(qh, vertex->point)+1 != qh->GOODvertex)
-      continue;
-    totridges += qh_eachvoronoi(qh, fp, printvridge, vertex,
-                   !qh_ALL, innerouter, inorder);
+    vertex->seen= false;
+    qh_setappend(qh, &vertices, vertex);
   }
+  totridges= qh_eachvoronoi_edges(qh, fp, printvridge, vertices, innerouter, inorder);
+  qh_settempfree(qh, &vertices);
   return totridges;
 } /* eachvoronoi_all */
 
+/*-<a                             href="qh-io_r.htm#TOC"
+  >-------------------------------</a><a name="eachvoronoi_edges">-</a>
+
+  qh_eachvoronoi_edges(qh, fp, printvridge, vertices, innerouter, inorder )
+    visit all unvisited Voronoi ridges for each vertex in vertices (i.e., input sites)
+    same ridges in the same order as qh_eachvoronoi(...,!qh_ALL,...) for each vertex in turn
+    vertices may include NULLs
+    if qh.GOODvertex ('QVn'), only visits ridges for that vertex
+
+  assumes:
+    qh_vertexneighbors
+    all facet->visitid == 0 if vertex_at_infinity
+                       == index of Voronoi vertex
+                       >= qh.num_facets if ignored
+
+  returns:
+    total number of Voronoi ridges
+    if printvridge,
+      calls printvridge( fp, vertex, vertexA, centers, unbounded) for each ridge
+      [see qh_eachvoronoi]
+
+  notes:
+    called by qh_printvdiagram2 and qh_eachvoronoi_all
+    does not use facet->seen, facet->seen2, vertex->seen, or qh.vertex_visit
+    Voronoi ridges are the Delaunay edges from each vertex to a later vertex
+      qh_eachvoronoi_site links the edges of a vertex instead of testing each pair of input sites
+    if 'QPn' or OpenMP, each thread visits a contiguous range of vertices
+      only if printvridge is NULL (count only), or qh_printvridge ('Fv') to a FILE
+      each thread prints to a temporary file, then copied to fp in vertex order
+      not for the C++ interface (qh.ISqhullQh) or 'Tf' (qh.FLUSHprint)
+      other printvridge callbacks are called serially (e.g., qh_printvnorm uses qh.gm_matrix)
+
+  design:
+    order the vertices and skip vertices that are not 'QVn'
+    determine the maximum number of Delaunay edges and neighbors for a vertex
+    allocate scratch memory for each thread
+    for each vertex (in parallel if possible)
+      visit its Voronoi ridges with qh_eachvoronoi_site
+    copy the temporary files to fp
+*/
+int qh_eachvoronoi_edges(qhT *qh, FILE *fp, printvridgeT printvridge, setT *vertices, qh_RIDGE innerouter, bool inorder) {
+  vertexT *vertex, *atvertex, **atvertexp;
+  facetT *neighbor, **neighborp;
+  setT *atvertices, **threadcenters;
+  vridgeT **threadvridges;
+  facetT ***threadrings;
+  int **threadsites;
+  FILE **tempfiles= NULL;
+  int *vertexorder, *threadcounts;
+  int vertex_i, vertex_n, i, numatvertices, numvridges, maxvridges= 1, maxneighbors= 1;
+  int numthreads, chunk, totridges= 0;
+  size_t size;
+  char buf[8192];
+
+  atvertices= qh_settemp(qh, qh->num_vertices);
+  vertexorder= (int *)qh_memalloc(qh, (int)qh->vertex_id * (int)sizeof(int));
+  for (i= (int)qh->vertex_id; i--; )
+    vertexorder[i]= INT_MAX;
+  FOREACHvertex_i_(qh, vertices) {
+    if (vertex) {
+      if (qh->GOODvertex > 0 && qh_pointid(qh, vertex->point)+1 != qh->GOODvertex)
+        continue;
+      vertexorder[vertex->id]= qh_setsize(qh, atvertices);
+      qh_setappend(qh, &atvertices, vertex);
+      numvridges= 0;
+      FOREACHneighbor_(vertex)
+        numvridges += (neighbor->simplicial ? qh->hull_dim : qh_setsize(qh, neighbor->vertices));
+      maximize_(maxvridges, numvridges);
+      maximize_(maxneighbors, qh_setsize(qh, vertex->neighbors));
+    }
+  }
+  numatvertices= qh_setsize(qh, atvertices);
+  numthreads= qh_parallelthreads(qh, numatvertices);
+  if (printvridge && (printvridge != qh_printvridge || !fp || qh->ISqhullQh || qh->FLUSHprint))
+    numthreads= 1;
+  if (numthreads > 1 && printvridge) {
+    tempfiles= (FILE **)qh_memalloc(qh, numthreads * (int)sizeof(FILE *));
+    for (i=0; i < numthreads; i++) {
+      if (!(tempfiles[i]= tmpfile())) {
+        trace1((qh, qh->ferr, 1068, "qh_eachvoronoi_edges: tmpfile() failed for thread %d.  Visit Voronoi ridges serially\n", i));
+        while (--i >= 0)
+          fclose(tempfiles[i]);
+        qh_memfree(qh, tempfiles, numthreads * (int)sizeof(FILE *));
+        tempfiles= NULL;
+        numthreads= 1;
+        break;
+      }
+    }
+  }
+  threadvridges= (vridgeT **)qh_memalloc(qh, numthreads * (int)sizeof(vridgeT *));
+  threadrings= (facetT ***)qh_memalloc(qh, numthreads * (int)sizeof(facetT **));
+  threadsites= (int **)qh_memalloc(qh, numthreads * (int)sizeof(int *));
+  threadcenters= (setT **)qh_memalloc(qh, numthreads * (int)sizeof(setT *));
+  threadcounts= (int *)qh_memalloc(qh, numthreads * (int)sizeof(int));
+  for (i=0; i < numthreads; i++) {
+    threadvridges[i]= (vridgeT *)qh_memalloc(qh, maxvridges * (int)sizeof(vridgeT));
+    threadsites[i]= (int *)qh_memalloc(qh, maxvridges * (int)sizeof(int));
+    threadrings[i]= (facetT **)qh_memalloc(qh, maxneighbors * (int)sizeof(facetT *));
+    threadcenters[i]= qh_setnew(qh, maxneighbors);  /* qh_setappend does not reallocate */
+    threadcounts[i]= 0;
+  }
+  if (numthreads == 1) {
+    FOREACHsetelement_(vertexT, atvertices, atvertex)
+      totridges += qh_eachvoronoi_site(qh, fp, printvridge, atvertex, vertexorder,
+                     threadvridges[0], threadsites[0], threadcenters[0], threadrings[0], innerouter, inorder);
+  }else {
+    chunk= (numatvertices + numthreads - 1) / numthreads;
+#if qh_PARALLEL
+#pragma omp parallel for num_threads(numthreads) schedule(static, 1)
+#endif
+    for (i=0; i < numthreads; i++) {
+      int j, end;
+
+      end= (i+1) * chunk;
+      minimize_(end, numatvertices);
+      for (j= i * chunk; j < end; j++)
+        threadcounts[i] += qh_eachvoronoi_site(qh, (tempfiles ? tempfiles[i] : fp), printvridge,
+                     SETelemt_(atvertices, j, vertexT), vertexorder,
+                     threadvridges[i], threadsites[i], threadcenters[i], threadrings[i], innerouter, inorder);
+    }
+    for (i=0; i < numthreads; i++) {
+      totridges += threadcounts[i];
+      if (tempfiles) {
+        rewind(tempfiles[i]);
+        while ((size= fread(buf, 1, sizeof(buf), tempfiles[i])) > 0)
+          fwrite(buf, 1, size, fp);
+        fclose(tempfiles[i]);
+      }
+    }
+    trace2((qh, qh->ferr, 2115, "qh_eachvoronoi_edges: visited %d Voronoi ridges for %d input sites with %d threads\n",
+        totridges, numatvertices, numthreads));
+  }
+  for (i=0; i < numthreads; i++) {
+    qh_setfree(qh, &threadcenters[i]);
+    qh_memfree(qh, threadrings[i], maxneighbors * (int)sizeof(facetT *));
+    qh_memfree(qh, threadsites[i], maxvridges * (int)sizeof(int));
+    qh_memfree(qh, threadvridges[i], maxvridges * (int)sizeof(vridgeT));
+  }
+  qh_memfree(qh, threadcounts, numthreads * (int)sizeof(int));
+  qh_memfree(qh, threadcenters, numthreads * (int)sizeof(setT *));
+  qh_memfree(qh, threadsites, numthreads * (int)sizeof(int *));
+  qh_memfree(qh, threadrings, numthreads * (int)sizeof(facetT **));
+  qh_memfree(qh, threadvridges, numthreads * (int)sizeof(vridgeT *));
+  if (tempfiles)
+    qh_memfree(qh, tempfiles, numthreads * (int)sizeof(FILE *));
+  qh_memfree(qh, vertexorder, (int)qh->vertex_id * (int)sizeof(int));
+  qh_settempfree(qh, &atvertices);
+  return totridges;
+} /* eachvoronoi_edges */
+
+/*-<a                             href="qh-io_r.htm#TOC"
+  >-------------------------------</a><a name="eachvoronoi_site">-</a>
+
+  qh_eachvoronoi_site(qh, fp, printvridge, atvertex, vertexorder, vridges, sites, centers, ring, innerouter, inorder )
+    visit the Voronoi ridges between atvertex and each later vertex
+    vertexorder[vertex->id] is the order of vertex in qh_eachvoronoi_edges, or INT_MAX
+    vridges, sites, centers, and ring are scratch memory for the Delaunay edges,
+      the first edge to each site, the Voronoi vertices, and a 3-d Voronoi ridge
+
+  returns:
+    number of Voronoi ridges between atvertex and a vertex with a larger vertexorder
+    if printvridge,
+      calls printvridge( fp, atvertex, vertex, centers, unbounded) for each ridge
+      centers are the same as qh_detvridge or, if inorder for a 3-d Voronoi diagram, qh_detvridge3
+
+  notes:
+    called by qh_eachvoronoi_edges for each input site
+    thread-safe if printvridge is NULL or thread-safe
+      does not change qh, facets, or vertices, and does not allocate memory
+    a facet is selected (i.e., facet->seen for qh_eachvoronoi) if facet->visitid < qh.num_facets
+    vridges and sites have room for the vertices of the neighbors of atvertex
+    centers and ring have room for the neighbors of atvertex
+    sites are searched linearly, most recent first.  There are few sites per input site
+
+  design:
+    list each Delaunay edge from atvertex to a later vertex through a selected neighbor
+      link the edges for each vertex, in order of discovery (the same as qh_eachvoronoi)
+    if inorder for a 3-d Voronoi diagram
+      link the edges through unselected neighbors (for qh_ordervridge3)
+    for each vertex
+      count the Voronoi vertices, including one vertex-at-infinity and unique tricoplanar centers
+      if at least qh.hull_dim-1 Voronoi vertices, it is a Voronoi ridge
+        if printvridge, determine its centers and call printvridge
+*/
+int qh_eachvoronoi_site(qhT *qh, FILE *fp, printvridgeT printvridge, vertexT *atvertex, int *vertexorder,
+             vridgeT *vridges, int *sites, setT *centers, facetT **ring, qh_RIDGE innerouter, bool inorder) {
+  facetT *neighbor, **neighborp, *facet, *infinite, *center, **centerp;
+  vertexT *vertex, **vertexp;
+  unsigned int numfacets= (unsigned int)qh->num_facets;
+  int atorder= vertexorder[atvertex->id];
+  int numvridges= 0, numsites= 0, numinfinite, numring, site_i, i, j, count, totridges= 0;
+  bool isridge3= (printvridge && inorder && qh->hull_dim == 3+1); /* 3-d Voronoi diagram */
+  bool istricoplanar, isunique, unbounded, firstinf;
+
+  FOREACHneighbor_(atvertex) {
+    if (neighbor->visitid < numfacets) {
+      FOREACHvertex_(neighbor->vertices) {
+        if (vertexorder[vertex->id] > atorder) {
+          vridges[numvridges].vertex= vertex;
+          vridges[numvridges].facet= neighbor;
+          vridges[numvridges].next= -1;
+          for (i=numsites; i--; ) {
+            if (vridges[sites[i]].vertex == vertex)
+              break;
+          }
+          if (i < 0) {
+            sites[numsites++]= numvridges;
+            vridges[numvridges].last= numvridges;
+          }else {
+            j= sites[i];
+            vridges[vridges[j].last].next= numvridges;
+            vridges[j].last= numvridges;
+          }
+          numvridges++;
+        }
+      }
+    }
+  }
+  if (isridge3) {
+    FOREACHneighbor_(atvertex) {
+      if (neighbor->visitid >= numfacets) {
+        FOREACHvertex_(neighbor->vertices) {
+          if (vertexorder[vertex->id] > atorder) {
+            for (i=numsites; i--; ) {
+              if (vridges[sites[i]].vertex == vertex)
+                break;
+            }
+            if (i >= 0) {
+              vridges[numvridges].vertex= vertex;
+              vridges[numvridges].facet= neighbor;
+              vridges[numvridges].next= -1;
+              j= sites[i];
+              vridges[vridges[j].last].next= numvridges;
+              vridges[j].last= numvridges;
+              numvridges++;
+            }
+          }
+        }
+      }
+    }
+  }
+  for (site_i=0; site_i < numsites; site_i++) {
+    vertex= vridges[sites[site_i]].vertex;
+    count= 0;
+    numinfinite= 0;
+    istricoplanar= false;
+    infinite= NULL;
+    for (i= sites[site_i]; i >= 0; i= vridges[i].next) {
+      facet= vridges[i].facet;
+      if (facet->visitid >= numfacets)
+        continue;
+      if (!facet->visitid) {
+        numinfinite++;
+        infinite= facet;
+      }else if (!facet->tricoplanar)
+        count++;
+      else {
+        istricoplanar= true;
+        count++;
+        for (j= sites[site_i]; j != i; j= vridges[j].next) {
+          center= vridges[j].facet;
+          if (center->visitid && center->tricoplanar && center->center == facet->center) {
+            count--;
+            break;
+          }
+        }
+      }
+    }
+    if (numinfinite)
+      count++;
+    if (count < qh->hull_dim - 1)  /* e.g., 3 for 3-d Voronoi */
+      continue;
+    if (!numinfinite) {
+      if (innerouter == qh_RIDGEouter)
+        continue;
+      unbounded= false;
+    }else {
+      if (innerouter == qh_RIDGEinner)
+        continue;
+      unbounded= true;
+    }
+    totridges++;
+    trace4((qh, qh->ferr, 4097, "qh_eachvoronoi_site: Voronoi ridge of %d vertices between sites %d and %d\n",
+          count, qh_pointid(qh, atvertex->point), qh_pointid(qh, vertex->point)));
+    if (!printvridge)
+      continue;
+    qh_settruncate(qh, centers, 0);
+    if (isridge3) {
+      numring= 0;
+      for (i= sites[site_i]; i >= 0; i= vridges[i].next)
+        ring[numring++]= vridges[i].facet;
+      qh_ordervridge3(qh, vertex, ring, numring, centers);
+    }else {
+      if (!istricoplanar && numinfinite <= 1) {
+        for (i= sites[site_i]; i >= 0; i= vridges[i].next) {
+          if (vridges[i].facet->visitid)
+            qh_setappend(qh, &centers, vridges[i].facet);
+        }
+        qh_setappend(qh, &centers, infinite);  /* nop if NULL */
+      }else {
+        firstinf= true;
+        FOREACHneighbor_(vertex) {  /* same representatives as qh_detvridge */
+          if (neighbor->visitid >= numfacets || !qh_setin(neighbor->vertices, atvertex))
+            continue;
+          if (neighbor->visitid) {
+            isunique= true;
+            if (neighbor->tricoplanar) {
+              FOREACHsetelement_(facetT, centers, center) {
+                if (center->visitid && center->tricoplanar && center->center == neighbor->center) {
+                  isunique= false;
+                  break;
+                }
+              }
+            }
+            if (isunique)
+              qh_setappend(qh, &centers, neighbor);
+          }else if (firstinf) {
+            firstinf= false;
+            qh_setappend(qh, &centers, neighbor);
+          }
+        }
+      }
+      qsort(SETaddr_(centers, facetT), (size_t)qh_setsize(qh, centers),
+             sizeof(facetT *), qh_compare_facetvisit);
+    }
+    (*printvridge)(qh, fp, atvertex, vertex, centers, unbounded);
+  }
+  return totridges;
+} /* eachvoronoi_site */
+
+/*-<a                             href="qh-io_r.htm#TOC"
+  >-------------------------------</a><a name="extract_count">-</a>
+
+  qh_extract_count(qh, printall, numvertexids, numneighbors )
+    count facets of qh.facet_list for qh_extract_facets and set visitid
+    if printall, ignores qh_skipfacet()
+
+  returns:
+    number of extracted facets
+    numvertexids= total number of facet vertices
+    numneighbors= total number of facet neighbors
+    each facet with ->visitid indicating 1-relative position
+      ->visitid==0 indicates not extracted
+    bumps qh.visit_id
+
+  notes:
+    same facets as qh_countfacets for qh.facet_list (e.g., 'i', 'n', 'Fn')
+    for Delaunay triangulations, qh_skipfacet skips upper Delaunay facets and, with 'QGn' or 'QVn', facets that are not good
+    numvertexids == numfacets * hull_dim if all extracted facets are simplicial (e.g., 'Qt')
+*/
+int qh_extract_count(qhT *qh, bool printall, int *numvertexidsp, int *numneighborsp) {
+  facetT *facet;
+  int numfacets= 0, numvertexids= 0, numneighbors= 0;
+
+  FORALLfacets {
+    if ((facet->visible && qh->NEWfacets)
+    || (!printall && qh_skipfacet(qh, facet)))
+      facet->visitid= 0;
+    else {
+      facet->visitid= (unsigned int)(++numfacets);
+      numvertexids += qh_setsize(qh, facet->vertices);
+      numneighbors += qh_setsize(qh, facet->neighbors);
+    }
+  }
+  qh->visit_id += (unsigned int)numfacets + 1;
+  *numvertexidsp= numvertexids;
+  *numneighborsp= numneighbors;
+  return numfacets;
+} /* extract_count */
+
+/*-<a                             href="qh-io_r.htm#TOC"
+  >-------------------------------</a><a name="extract_delaunay">-</a>
+
+  qh_extract_delaunay(qh, simplices, neighbors, siteoffsets, sitesimplices )
+    extract the Delaunay simplices marked by qh_extract_count into caller arrays (compressed sparse row)
+    skips NULL arrays
+    if 'QPn' or OpenMP, fills the arrays in parallel
+
+  returns:
+    simplices[numfacets*hull_dim] -- point ids of each simplex, oriented as option 'i'
+    neighbors[numfacets*hull_dim] -- the k'th neighbor of a simplex is opposite its k'th point
+      each neighbor is a simplex index, or -1 if outside the triangulation (upper Delaunay or not good)
+    siteoffsets[numsites+1] and sitesimplices[numfacets*hull_dim] -- the simplices of each input site
+      the simplices of site p are sitesimplices[siteoffsets[p] .. siteoffsets[p+1]-1], in increasing order
+      numsites is qh.num_points plus the size of qh.other_points (as qh_pointvertex)
+
+  notes:
+    call qh_extract_count first with the same selection of facets (qh_skipfacet)
+    error if an extracted facet is not simplicial (use 'Qt' or 'QJ')
+    siteoffsets and sitesimplices require simplices
+    same simplices and neighbors as qh_extract_facets without the offsets
+    the site arrays transpose the simplices array by a counting sort.  They do not need vertex->neighbors
+    the arrays are the same for any number of threads
+    parallel sections read facets and write disjoint array elements.  They do not call qh_memalloc or qh_errexit
+
+  design:
+    collect the extracted facets into a temporary set, in visitid order
+    in parallel, fill the point ids and neighbors of each simplex
+    if siteoffsets
+      in parallel, count the sites of each thread's simplices
+      accumulate the counts by site and thread into offsets
+      in parallel, append each simplex to its sites at its thread's offsets
+*/
+void qh_extract_delaunay(qhT *qh, int *simplices, int *neighbors, int *siteoffsets, int *sitesimplices) {
+  facetT *facet;
+  setT *facets;
+  int i, k, total, numfacets= 0, numsites= 0, numthreads, chunk, dim= qh->hull_dim, *counts;
+
+  facets= qh_settemp(qh, qh->num_facets);
+  FORALLfacets {
+    if (!facet->visitid)
+      continue;
+    if (!facet->simplicial) {
+      qh_fprintf(qh, qh->ferr, 6439, "qhull input error (qh_extract_delaunay): Delaunay region f%d is not simplicial.  It has %d vertices and %d neighbors.  Use option 'Qt' or 'QJ' to triangulate the output\n",
+        facet->id, qh_setsize(qh, facet->vertices), qh_setsize(qh, facet->neighbors));
+      qh_errexit(qh, qh_ERRinput, facet, NULL);
+    }
+    qh_setappend(qh, &facets, facet);
+  }
+  numfacets= qh_setsize(qh, facets);
+  if (simplices || neighbors) {
+    numthreads= qh_parallelthreads(qh, numfacets);
+    chunk= (numfacets + numthreads - 1) / numthreads;
+#if qh_PARALLEL
+#pragma omp parallel for num_threads(numthreads) schedule(static, 1)
+#endif
+    for (i=0; i < numthreads; i++) {
+      facetT *simplex, *neighbor, **neighborp;
+      vertexT *vertex, **vertexp;
+      int j, swap, end, *ids, *nbrs;
+      bool swap12;
+
+      end= (i+1) * chunk;
+      minimize_(end, numfacets);
+      for (j= i * chunk; j < end; j++) {
+        simplex= SETelemt_(facets, j, facetT);
+        swap12= !(simplex->toporient ^ qh_ORIENTclock);
+        if (simplices) {
+          ids= simplices + j * dim;
+          FOREACHvertex_(simplex->vertices)
+            *(ids++)= qh_pointid(qh, vertex->point);
+          if (swap12) {
+            swap= simplices[j*dim];
+            simplices[j*dim]= simplices[j*dim+1];
+            simplices[j*dim+1]= swap;
+          }
+        }
+        if (neighbors) {
+          nbrs= neighbors + j * dim;
+          FOREACHneighbor_(simplex)
+            *(nbrs++)= (neighbor->visitid ? (int)neighbor->visitid - 1 : -1);
+          if (swap12) {
+            swap= neighbors[j*dim];
+            neighbors[j*dim]= neighbors[j*dim+1];
+            neighbors[j*dim+1]= swap;
+          }
+        }
+      }
+    }
+  }
+  if (siteoffsets) {
+    if (!simplices && numfacets) {
+      qh_fprintf(qh, qh->ferr, 6440, "qhull internal error (qh_extract_delaunay): siteoffsets requires the simplices array\n");
+      qh_errexit(qh, qh_ERRqhull, NULL, NULL);
+    }
+    numsites= qh->num_points + qh_setsize(qh, qh->other_points);
+    numthreads= qh_parallelthreads(qh, numfacets);
+    chunk= (numfacets + numthreads - 1) / numthreads;
+    if (!(counts= (int *)qh_malloc((size_t)numthreads * (size_t)numsites * sizeof(int)))) {
+      qh_fprintf(qh, qh->ferr, 6441, "qhull error (qh_extract_delaunay): insufficient memory for the site counts of %d threads and %d sites\n",
+        numthreads, numsites);
+      qh_errexit(qh, qh_ERRmem, NULL, NULL);
+    }
+    memset((char *)counts, 0, (size_t)numthreads * (size_t)numsites * sizeof(int));
+#if qh_PARALLEL
+#pragma omp parallel for num_threads(numthreads) schedule(static, 1)
+#endif
+    for (i=0; i < numthreads; i++) {
+      int j, end, *count= counts + (size_t)i * (size_t)numsites;
+
+      end= (i+1) * chunk;
+      minimize_(end, numfacets);
+      for (j= i * chunk * dim; j < end * dim; j++)
+        count[simplices[j]]++;
+    }
+    total= 0;
+    for (k=0; k < numsites; k++) {
+      siteoffsets[k]= total;
+      for (i=0; i < numthreads; i++) {
+        int *count= counts + (size_t)i * (size_t)numsites + k;
+        int n= *count;
+
+        *count= total;  /* first position of site k for thread i */
+        total += n;
+      }
+    }
+    siteoffsets[numsites]= total;
+    if (sitesimplices) {
+#if qh_PARALLEL
+#pragma omp parallel for num_threads(numthreads) schedule(static, 1)
+#endif
+      for (i=0; i < numthreads; i++) {
+        int j, end, *next= counts + (size_t)i * (size_t)numsites;
+
+        end= (i+1) * chunk;
+        minimize_(end, numfacets);
+        for (j= i * chunk * dim; j < end * dim; j++)
+          sitesimplices[next[simplices[j]]++]= j / dim;
+      }
+    }
+    qh_free(counts);
+  }
+  trace2((qh, qh->ferr, 2117, "qh_extract_delaunay: extracted %d simplices and %d sites with %d threads\n",
+      numfacets, numsites, qh_parallelthreads(qh, numfacets)));
+  qh_settempfree(qh, &facets);
+} /* extract_delaunay */
+
+/*-<a                             href="qh-io_r.htm#TOC"
+  >-------------------------------</a><a name="extract_facets">-</a>
+
+  qh_extract_facets(qh, vertexoffsets, vertexids, neighboroffsets, neighbors, normals )
+    extract the facets marked by qh_extract_count into caller arrays, one pass over qh.facet_list
+    skips NULL arrays.  The offsets may be NULL if all facets are simplicial (e.g., 'd Qt')
+
+  returns:
+    facets in qh.facet_list order, indexed by visitid-1
+    vertexoffsets[numfacets+1] and vertexids[numvertexids]
+      the point ids of facet i are vertexids[vertexoffsets[i] .. vertexoffsets[i+1]-1]
+    neighboroffsets[numfacets+1] and neighbors[numneighbors]
+      the neighbors of facet i are neighbors[neighboroffsets[i] .. neighboroffsets[i+1]-1]
+      each neighbor is a facet index, or -1 if the neighbor was not extracted (e.g., an upper Delaunay facet)
+    normals[numfacets*(hull_dim+1)]
+      hull_dim coordinates of facet->normal followed by facet->offset (same as 'n')
+
+  notes:
+    call qh_extract_count first.  Its counts size the arrays
+    simplicial facets are oriented as option 'i'.  The k'th neighbor is opposite the k'th vertex
+    non-simplicial facets list facet->vertices and facet->neighbors (unordered)
+    does not call qh_fprintf (cf. qh_printfacets with qh_PRINTincidences and qh_PRINTneighbors)
+
+  design:
+    for each facet with visitid
+      append point ids of its vertices, swapping the first two if needed for orientation
+      append visitid-1 of its neighbors in the same order
+      copy normal and offset
+*/
+void qh_extract_facets(qhT *qh, int *vertexoffsets, int *vertexids, int *neighboroffsets, int *neighbors, coordT *normals) {
+  facetT *facet, *neighbor, **neighborp;
+  vertexT *vertex, **vertexp;
+  coordT *normal;
+  int k, i= 0, numvertexids= 0, numneighbors= 0, *ids, *nbrs;
+  bool swap12;
+
+  FORALLfacets {
+    if (!facet->visitid)
+      continue;
+    swap12= !(facet->toporient ^ qh_ORIENTclock) && (qh->hull_dim <= 2 || facet->simplicial);
+    if (vertexids) {
+      if (vertexoffsets)
+        vertexoffsets[i]= numvertexids;
+      ids= vertexids + numvertexids;
+      FOREACHvertex_(facet->vertices)
+        *(ids++)= qh_pointid(qh, vertex->point);
+      if (swap12 && ids - (vertexids + numvertexids) >= 2) {
+        k= vertexids[numvertexids];
+        vertexids[numvertexids]= vertexids[numvertexids+1];
+        vertexids[numvertexids+1]= k;
+      }
+      numvertexids= (int)(ids - vertexids);
+    }
+    if (neighbors) {
+      if (neighboroffsets)
+        neighboroffsets[i]= numneighbors;
+      nbrs= neighbors + numneighbors;
+      FOREACHneighbor_(facet)
+        *(nbrs++)= (neighbor->visitid ? (int)neighbor->visitid - 1 : -1);
+      if (swap12 && facet->simplicial && nbrs - (neighbors + numneighbors) >= 2) {
+        k= neighbors[numneighbors];
+        neighbors[numneighbors]= neighbors[numneighbors+1];
+        neighbors[numneighbors+1]= k;
+      }
+      numneighbors= (int)(nbrs - neighbors);
+    }
+    if (normals) {
+      normal= normals + i * (qh->hull_dim + 1);
+      if (facet->normal) {
+        for (k=0; k < qh->hull_dim; k++)
+          normal[k]= facet->normal[k];
+        normal[k]= facet->offset;
+      }else {
+        for (k=0; k <= qh->hull_dim; k++)
+          normal[k]= 0.0;
+      }
+    }
+    i++;
+  }
+  if (vertexoffsets)
+    vertexoffsets[i]= numvertexids;
+  if (neighboroffsets)
+    neighboroffsets[i]= numneighbors;
+} /* extract_facets */
+
+/*-<a                             href="qh-io_r.htm#TOC"
+  >-------------------------------</a><a name="extract_voronoi">-</a>
+
+  qh_extract_voronoi(qh, printall, centers, regionoffsets, regionids, numcenters, numregionids )
+    extract the Voronoi vertices and Voronoi regions of a Delaunay triangulation into caller arrays
+    if printall, ignores qh_skipfacet()
+    if centers is NULL, only counts
+
+  returns:
+    number of input sites (qh.num_points)
+    numcenters= number of Voronoi vertices (excludes the vertex-at-infinity)
+    numregionids= total number of Voronoi vertices over all regions
+    centers[numcenters*(hull_dim-1)] -- Voronoi vertices in qh.facet_list order
+    regionoffsets[numsites+1] and regionids[numregionids]
+      the Voronoi region of site i is regionids[regionoffsets[i] .. regionoffsets[i+1]-1]
+      each region id is an index into centers, or -1 for the vertex-at-infinity
+      the region is empty if site i is coplanar, isolated, or only adjacent to the vertex-at-infinity
+    same as 'o' with 0-relative ids (i.e., 'o' id - 1)
+
+  notes:
+    uses qh_markvoronoi for facet->visitid and facet->center
+    orders 3-d regions by adjacency (qh_order_vertexneighbors)
+      as for 'o', a second call may start each 3-d region at a different Voronoi vertex
+    a count call followed by a fill call computes the Voronoi vertices once (qh.CENTERtype)
+
+  design:
+    mark Voronoi vertices (qh_markvoronoi)
+    for each Delaunay facet selected as a Voronoi vertex
+      copy facet->center
+    for each input site
+      order its Delaunay neighbors
+      append visitid-1 of each selected neighbor and -1 once for upper Delaunay neighbors
+*/
+int qh_extract_voronoi(qhT *qh, bool printall, coordT *centers, int *regionoffsets, int *regionids, int *numcentersp, int *numregionidsp) {
+  int k, numcenters, numsites, numneighbors, numinf, numregionids= 0, vertex_i, vertex_n;
+  facetT *facet, *neighbor, **neighborp;
+  setT *vertices;
+  vertexT *vertex;
+  coordT *center;
+  bool isLower;
+  unsigned int numfacets= (unsigned int)qh->num_facets;
+
+  if (!qh->DELAUNAY) {
+    qh_fprintf(qh, qh->ferr, 6438, "qhull input error (qh_extract_voronoi): the Voronoi diagram requires a Delaunay triangulation ('d' or 'v')\n");
+    qh_errexit(qh, qh_ERRinput, NULL, NULL);
+  }
+  vertices= qh_markvoronoi(qh, qh->facet_list, NULL, printall, &isLower, &numcenters);
+  numsites= qh_setsize(qh, vertices);
+  if (centers) {
+    FORALLfacets {
+      if (facet->visitid && facet->visitid < numfacets) {
+        if (!facet->center)
+          facet->center= qh_facetcenter(qh, facet->vertices);
+        center= centers + (facet->visitid - 1) * (unsigned int)(qh->hull_dim - 1);
+        for (k=0; k < qh->hull_dim-1; k++)
+          center[k]= facet->center[k];
+      }
+    }
+  }
+  FOREACHvertex_i_(qh, vertices) {
+    if (centers)
+      regionoffsets[vertex_i]= numregionids;
+    if (!vertex)
+      continue;
+    numneighbors= numinf= 0;
+    FOREACHneighbor_(vertex) {
+      if (neighbor->visitid == 0)
+        numinf= 1;
+      else if (neighbor->visitid < numfacets)
+        numneighbors++;
+    }
+    if (!numneighbors)
+      continue;
+    if (!centers) {
+      numregionids += numneighbors + numinf;
+      continue;
+    }
+    qh_order_vertexneighbors(qh, vertex);
+    FOREACHneighbor_(vertex) {
+      if (neighbor->visitid == 0) {
+        if (numinf) {
+          numinf= 0;
+          regionids[numregionids++]= -1;
+        }
+      }else if (neighbor->visitid < numfacets)
+        regionids[numregionids++]= (int)neighbor->visitid - 1;
+    }
+  }
+  if (centers)
+    regionoffsets[numsites]= numregionids;
+  qh_settempfree(qh, &vertices);
+  *numcentersp= numcenters - 1;
+  *numregionidsp= numregionids;
+  return numsites;
+} /* extract_voronoi */
+
 /*-<a                             href="qh-io_r.htm#TOC"
   >-------------------------------</a><a name="facet2point">-</a>
 
@@ -960,6 +1663,7 @@ void qh_markkeep(qhT *qh, facetT *facetlist) {
 
   notes:
     ignores qh.ATinfinity, if defined
+    if 'QPn' or OpenMP, computes Voronoi centers in parallel (qh_setvoronoi_parallel)
 */
 setT *qh_markvoronoi(qhT *qh, facetT *facetlist, setT *facets, bool printall, bool *isLowerp, int *numcentersp) {
   int numcenters=0;
@@ -970,6 +1674,7 @@ setT *qh_markvoronoi(qhT *qh, facetT *facetlist, setT *facets, bool printall, bo
   qh->printoutnum++;
   qh_clearcenters(qh, qh_ASvoronoi);  /* in case, qh_printvdiagram2 called by user */
   qh_vertexneighbors(qh);
+  qh_setvoronoi_parallel(qh);  /* nop if serial */
   vertices= qh_pointvertex(qh);
   if (qh->ATinfinity)
     SETelem_(vertices, qh->num_points-1)= NULL;
@@ -1089,6 +1794,79 @@ void qh_order_vertexneighbors(qhT *qh, vertexT *vertex) {
   }
 } /* order_vertexneighbors */
 
+/*-<a                             href="qh-io_r.htm#TOC"
+  >-------------------------------</a><a name="ordervridge3">-</a>
+
+  qh_ordervridge3(qh, vertex, ring, numring, centers )
+    append the Voronoi vertices of a 3-d Voronoi ridge to centers, in order
+    ring is the numring facets that contain vertex and atvertex (i.e., the Delaunay edge)
+    same centers in the same order as qh_detvridge3(qh, atvertex, vertex)
+    include one vertex-at-infinite for !facet->visitid
+    centers is empty with room for numring facets
+
+  returns:
+    ring in the order visited
+
+  notes:
+    called by qh_eachvoronoi_site
+    thread-safe.  Moves visited facets to the front of ring instead of setting facet->seen2
+    a facet is selected (i.e., facet->seen for qh_detvridge3) if facet->visitid < qh.num_facets
+
+  design:
+    start at the first neighbor of vertex in ring
+    repeat
+      append the facet if selected (once for vertex-at-infinity and tricoplanar centers)
+      walk to the first neighbor of the facet in the unvisited part of ring
+*/
+void qh_ordervridge3(qhT *qh, vertexT *vertex, facetT **ring, int numring, setT *centers) {
+  facetT *facet= NULL, *neighbor, **neighborp, *center, **centerp;
+  unsigned int numfacets= (unsigned int)qh->num_facets;
+  int i, numvisited= 0;
+  bool firstinf= true, isunique;
+
+  FOREACHneighbor_(vertex) {
+    for (i=numring; i-- > 0; ) {
+      if (ring[i] == neighbor)
+        break;
+    }
+    if (i >= 0) {
+      facet= neighbor;
+      break;
+    }
+  }
+  while (facet) {
+    ring[i]= ring[numvisited];
+    ring[numvisited++]= facet;
+    if (facet->visitid < numfacets) {
+      if (facet->visitid) {
+        isunique= true;
+        if (facet->tricoplanar) {
+          FOREACHsetelement_(facetT, centers, center) {
+            if (center->visitid && center->tricoplanar && center->center == facet->center) {
+              isunique= false;
+              break;
+            }
+          }
+        }
+        if (isunique)
+          qh_setappend(qh, &centers, facet);
+      }else if (firstinf) {
+        firstinf= false;
+        qh_setappend(qh, &centers, facet);
+      }
+    }
+    FOREACHneighbor_(facet) {
+      for (i=numring; i-- > numvisited; ) {
+        if (ring[i] == neighbor)
+          break;
+      }
+      if (i >= numvisited)
+        break;
+    }
+    facet= neighbor;
+  }
+} /* ordervridge3 */
+
 /*-<a                             href="qh-io_r.htm#TOC"
   >-------------------------------</a><a name="prepare_output">-</a>
 
@@ -1102,14 +1880,19 @@ void qh_order_vertexneighbors(qhT *qh, vertexT *vertex) {
     except for PRINTstatistics, no-op if previously called with same options
 */
 void qh_prepare_output(qhT *qh) {
+  int prevphase;
+
   if (qh->VORONOI) {
     qh_clearcenters(qh, qh_ASvoronoi);  /* must be before qh_triangulate */
     qh_vertexneighbors(qh);
   }
   if (qh->TRIangulate && !qh->hasTriangulation) {
+    prevphase= qh_profilephase(qh, qh_PHASEtriangulate);
     qh_triangulate(qh);
+    qh_profilephase(qh, qh_PHASEcheck);
     if (qh->VERIFYoutput && !qh->CHECKfrequently)
       qh_checkpolygon(qh, qh->facet_list);
+    qh_profilephase(qh, prevphase);
   }
   qh_findgood_all(qh, qh->facet_list);
   if (qh->GETarea)
@@ -1140,10 +1923,33 @@ void qh_prepare_output(qhT *qh) {
 
   design:
     test for printing facet
+    print facet with qh_printafacet2
+*/
+void qh_printafacet(qhT *qh, FILE *fp, qh_PRINT format, facetT *facet, bool printall) {
+
+  if (!printall && qh_skipfacet(qh, facet))
+    return;
+  if (facet->visible && qh->NEWfacets && format != qh_PRINTfacets)
+    return;
+  qh->printoutnum++;
+  qh_printafacet2(qh, fp, format, facet);
+} /* printafacet */
+
+/*-<a                             href="qh-io_r.htm#TOC"
+  >-------------------------------</a><a name="printafacet2">-</a>
+
+  qh_printafacet2(qh, fp, format, facet )
+    print facet to fp in given output format without testing or counting it
+
+  notes
+    called by qh_printafacet and qh_printfacets_parallel
+    see qh_printfacets_parallel for the formats that do not change qh or the facets
+
+  design:
     call appropriate routine for format
     or output results directly
 */
-void qh_printafacet(qhT *qh, FILE *fp, qh_PRINT format, facetT *facet, bool printall) {
+void qh_printafacet2(qhT *qh, FILE *fp, qh_PRINT format, facetT *facet) {
   realT color[4], offset, dist, outerplane, innerplane;
   bool zerodiv;
   coordT *point, *normp, *coordp, **pointp, *feasiblep;
@@ -1151,11 +1957,6 @@ void qh_printafacet(qhT *qh, FILE *fp, qh_PRINT format, facetT *facet, bool prin
   vertexT *vertex, **vertexp;
   facetT *neighbor, **neighborp;
 
-  if (!printall && qh_skipfacet(qh, facet))
-    return;
-  if (facet->visible && qh->NEWfacets && format != qh_PRINTfacets)
-    return;
-  qh->printoutnum++;
   switch (format) {
   case qh_PRINTarea:
     if (facet->isarea) {
@@ -1316,7 +2117,7 @@ void qh_printafacet(qhT *qh, FILE *fp, qh_PRINT format, facetT *facet, bool prin
   default:
     break;
   }
-} /* printafacet */
+} /* printafacet2 */
 
 /*-<a                             href="qh-io_r.htm#TOC"
   >-------------------------------</a><a name="printbegin">-</a>
@@ -2750,15 +3551,145 @@ void qh_printfacets(qhT *qh, FILE *fp, qh_PRINT format, facetT *facetlist, setT
     qh_printvdiagram(qh, fp, format, facetlist, facets, printall);
   else {
     qh_printbegin(qh, fp, format, facetlist, facets, printall);
-    FORALLfacet_(facetlist)
-      qh_printafacet(qh, fp, format, facet, printall);
-    FOREACHfacet_(facets)
-      qh_printafacet(qh, fp, format, facet, printall);
+    if (!qh_printfacets_parallel(qh, fp, format, facetlist, facets, printall)) {
+      FORALLfacet_(facetlist)
+        qh_printafacet(qh, fp, format, facet, printall);
+      FOREACHfacet_(facets)
+        qh_printafacet(qh, fp, format, facet, printall);
+    }
     qh_printend(qh, fp, format, facetlist, facets, printall);
   }
   qh->RANDOMdist= qh->old_randomdist;
 } /* printfacets */
 
+/*-<a                             href="qh-io_r.htm#TOC"
+  >-------------------------------</a><a name="printfacets_parallel">-</a>
+
+  qh_printfacets_parallel(qh, fp, format, facetlist, facets, printall )
+    print facetlist and facet set in output format with qh_parallelthreads() threads
+    each thread prints a contiguous range of facets to its own temporary file
+
+  returns:
+    false if not printed (e.g., serial, unsupported format, or no tmpfile)
+    otherwise copies the temporary files to fp in facet order and updates qh.printoutnum
+    output is the same as qh_printafacet for each facet
+
+  notes:
+    called by qh_printfacets between qh_printbegin and qh_printend
+    only for formats where qh_printafacet2 does not change qh, the facets, or qh.qhmem
+      'FI', 'Fa', 'Fc', 'Fm', 'Fn', 'Fv', 'n', 'o' (except 3-d), and simplicial 'i' and 'Ft'
+      Geomview, centrums, and 3-d 'i' and 'o' use qh.visit_id or qh_settemp
+    not for the C++ interface (qh.ISqhullQh).  Its qh_fprintf does not write to fp
+    not for 'Tf' (qh.FLUSHprint)
+
+  design:
+    check that the format can be printed in parallel
+    collect the facets in facet order
+    open a temporary file for each thread
+    in parallel, print each range of facets to its temporary file
+    copy the temporary files to fp
+*/
+bool qh_printfacets_parallel(qhT *qh, FILE *fp, qh_PRINT format, facetT *facetlist, setT *facets, bool printall) {
+  facetT *facet, **facetp;
+  setT *printfacets;
+  FILE **tempfiles;
+  int *printcounts;
+  int i, numfacets, numthreads, chunk;
+  size_t size;
+  char buf[8192];
+
+  if (!fp || qh->ISqhullQh || qh->FLUSHprint)
+    return false;
+  switch (format) {
+  case qh_PRINTarea:
+  case qh_PRINTcoplanars:
+  case qh_PRINTids:
+  case qh_PRINTmerges:
+  case qh_PRINTneighbors:
+  case qh_PRINTnormals:
+  case qh_PRINTouter:
+  case qh_PRINTvertices:
+    break;
+  case qh_PRINToff:
+  case qh_PRINTincidences:
+  case qh_PRINTtriangles:
+    if (qh->hull_dim == 3 && format != qh_PRINTtriangles)
+      return false;  /* qh_printfacet3vertex */
+    break;
+  default:
+    return false;
+  }
+  numfacets= qh_setsize(qh, facets);
+  FORALLfacet_(facetlist)
+    numfacets++;
+  if ((numthreads= qh_parallelthreads(qh, numfacets)) <= 1)
+    return false;
+  printfacets= qh_settemp(qh, numfacets);
+  FORALLfacet_(facetlist) {
+    if (format != qh_PRINToff && qh->hull_dim > 2 && !facet->simplicial
+    && (format == qh_PRINTincidences || format == qh_PRINTtriangles)) {
+      qh_settempfree(qh, &printfacets);  /* qh_printfacetNvertex_nonsimplicial uses qh.printoutvar */
+      return false;
+    }
+    qh_setappend(qh, &printfacets, facet);
+  }
+  FOREACHfacet_(facets) {
+    if (format != qh_PRINToff && qh->hull_dim > 2 && !facet->simplicial
+    && (format == qh_PRINTincidences || format == qh_PRINTtriangles)) {
+      qh_settempfree(qh, &printfacets);
+      return false;
+    }
+    qh_setappend(qh, &printfacets, facet);
+  }
+  tempfiles= (FILE **)qh_memalloc(qh, numthreads * (int)sizeof(FILE *));
+  printcounts= (int *)qh_memalloc(qh, numthreads * (int)sizeof(int));
+  for (i=0; i < numthreads; i++) {
+    printcounts[i]= 0;
+    if (!(tempfiles[i]= tmpfile())) {
+      trace1((qh, qh->ferr, 1067, "qh_printfacets_parallel: tmpfile() failed for thread %d.  Print facets serially\n", i));
+      while (--i >= 0)
+        fclose(tempfiles[i]);
+      qh_memfree(qh, printcounts, numthreads * (int)sizeof(int));
+      qh_memfree(qh, tempfiles, numthreads * (int)sizeof(FILE *));
+      qh_settempfree(qh, &printfacets);
+      return false;
+    }
+  }
+  chunk= (numfacets + numthreads - 1) / numthreads;
+#if qh_PARALLEL
+#pragma omp parallel for num_threads(numthreads) schedule(static, 1)
+#endif
+  for (i=0; i < numthreads; i++) {
+    facetT *printfacet;
+    int j, end;
+
+    end= (i+1) * chunk;
+    minimize_(end, numfacets);
+    for (j= i * chunk; j < end; j++) {
+      printfacet= SETelemt_(printfacets, j, facetT);
+      if (!printall && qh_skipfacet(qh, printfacet))
+        continue;
+      if (printfacet->visible && qh->NEWfacets && format != qh_PRINTfacets)
+        continue;
+      printcounts[i]++;
+      qh_printafacet2(qh, tempfiles[i], format, printfacet);
+    }
+  }
+  for (i=0; i < numthreads; i++) {
+    qh->printoutnum += printcounts[i];
+    rewind(tempfiles[i]);
+    while ((size= fread(buf, 1, sizeof(buf), tempfiles[i])) > 0)
+      fwrite(buf, 1, size, fp);
+    fclose(tempfiles[i]);
+  }
+  trace2((qh, qh->ferr, 2113, "qh_printfacets_parallel: printed %d facets in format %d with %d threads\n",
+      numfacets, format, numthreads));
+  qh_memfree(qh, printcounts, numthreads * (int)sizeof(int));
+  qh_memfree(qh, tempfiles, numthreads * (int)sizeof(FILE *));
+  qh_settempfree(qh, &printfacets);
+  return true;
+} /* printfacets_parallel */
+
 
 /*-<a                             href="qh-io_r.htm#TOC"
   >-------------------------------</a><a name="printhyperplaneintersection">-</a>
@@ -3248,24 +4179,16 @@ void qh_printvdiagram(qhT *qh, FILE *fp, qh_PRINT format, facetT *facetlist, set
       calls printvridge( fp, vertex, vertexA, centers) for each ridge
       [see qh_eachvoronoi()]
 
+  notes:
+    same as qh_eachvoronoi for each vertex, using qh_eachvoronoi_edges
+    if 'QPn' or OpenMP, counts and prints 'Fv' in parallel
+
   see:
     qh_eachvoronoi_all()
 */
 int qh_printvdiagram2(qhT *qh, FILE *fp, printvridgeT printvridge, setT *vertices, qh_RIDGE innerouter, bool inorder) {
-  int totcount= 0;
-  int vertex_i, vertex_n;
-  vertexT *vertex;
 
-  FORALLvertices
-    vertex->seen= false;
-  FOREACHvertex_i_(qh, vertices) {
-    if (vertex) {
-      if (qh->GOODvertex > 0 && qh_pointid(qh, vertex->point)+1 != qh->GOODvertex)
-        continue;
-      totcount += qh_eachvoronoi(qh, fp, printvridge, vertex, !qh_ALL, innerouter, inorder);
-    }
-  }
-  return totcount;
+  return qh_eachvoronoi_edges(qh, fp, printvridge, vertices, innerouter, inorder);
 } /* printvdiagram2 */
 
 /*-<a                             href="qh-io_r.htm#TOC"
@@ -3731,6 +4654,7 @@ coordT *qh_readpoints(qhT *qh, int *numpoints, int *dimension, bool *ismalloc) {
   int tokcount= 0, linecount=0, maxcount, coordcount=0;
   bool islong, isfirst= true, wasbegin= false;
   bool isdelaunay= qh->DELAUNAY && !qh->PROJECTinput;
+  int prevphase= qh_profilephase(qh, qh_PHASEread);
 
   if (qh->CDDinput) {
     while ((s= fgets(firstline, qh_MAXfirst, qh->fin))) {
@@ -4018,6 +4942,7 @@ Type 'qhull' for a short list of options.\n");
   qh->temp_malloc= NULL;
   trace1((qh, qh->ferr, 1008,"qh_readpoints: read in %d %d-dimensional points\n",
           numinput, diminput));
+  qh_profilephase(qh, prevphase);
   return(points);
 } /* readpoints */
 
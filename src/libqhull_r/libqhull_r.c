@@ -58,9 +58,10 @@
 */
 
 void qh_qhull(qhT *qh) {
-  int numoutside;
+  int numoutside, prevphase;
 
   qh->hulltime= qh_CPUclock;
+  prevphase= qh_profilephase(qh, qh_PHASEbuild);
   if (qh->RERUN || qh->JOGGLEmax < REALmax/2)
     qh_build_withrestart(qh);
   else {
@@ -68,6 +69,7 @@ void qh_qhull(qhT *qh) {
     qh_buildhull(qh);
   }
   if (!qh->STOPadd && !qh->STOPcone && !qh->STOPpoint) {
+    qh_profilephase(qh, qh_PHASEmerge);
     if (qh->ZEROall_ok && !qh->TESTvneighbors && qh->MERGEexact)
       qh_checkzero(qh, qh_ALL);
     if (qh->ZEROall_ok && !qh->TESTvneighbors && !qh->WAScoplanar) {
@@ -98,6 +100,7 @@ void qh_qhull(qhT *qh) {
       qh->IStracing= qh->TRACElevel;
       qh_fprintf(qh, qh->ferr, 2112, "qh_qhull: finished qh_buildhull and qh_postmerge, start tracing (TP-1)\n");
     }
+    qh_profilephase(qh, qh_PHASEcheck);
     if (qh->DOcheckmax){
       if (qh->REPORTfreq) {
         qh_buildtracing(qh, NULL, NULL);
@@ -113,6 +116,7 @@ void qh_qhull(qhT *qh) {
              qh_setsize(qh, qh->qhmem.tempstack));
     qh_errexit(qh, qh_ERRqhull, NULL, NULL);
   }
+  qh_profilephase(qh, prevphase);
   qh->hulltime= qh_CPUclock - qh->hulltime;
   qh->QHULLfinished= true;
   trace1((qh, qh->ferr, 1036, "Qhull: algorithm completed\n"));
@@ -306,6 +310,11 @@ bool qh_addpoint(qhT *qh, pointT *furthest, facetT *facet, bool checkdist) {
        qh_errexit always undoes qh_build_withrestart()
     qh.FIRSTpoint/qh.NUMpoints is point array
        it may be moved by qh_joggleinput
+
+  notes:
+    a restart keeps the input points (qh.input_points) and the memory freelists of qh_freebuild
+    with 'Q16', qh_initialvertices reuses the previous initial simplex (qh.restart_simplex)
+    Wretrytime is the wall-clock time of the builds that were restarted
 */
 void qh_build_withrestart(qhT *qh) {
   int restart;
@@ -318,6 +327,7 @@ void qh_build_withrestart(qhT *qh) {
       qh->last_errcode= qh_ERRnone;
       zzinc_(Zretry);
       wmax_(Wretrymax, qh->JOGGLEmax);
+      wadd_(Wretrytime, qh_wallclock() - qh->build_start);
       /* QH7078 warns about using 'TCn' with 'QJn' */
       qh->STOPcone= qh_IDunknown; /* if break from joggle, prevents normal output */
       FOREACHvertex_(qh->del_vertices) {
@@ -353,8 +363,10 @@ void qh_build_withrestart(qhT *qh) {
       }
       qh->qhmem.IStracing= qh->IStracing;
     }
+    qh->build_start= qh_wallclock();
     if (qh->JOGGLEmax < REALmax/2)
       qh_joggleinput(qh);
+    qh_profilephase(qh, qh_PHASEbuild);  /* after a restart, qh.profile_phase is the interrupted phase */
     qh_initbuild(qh);
     qh_buildhull(qh);
     if (qh->JOGGLEmax < REALmax/2 && !qh->MERGING)
@@ -576,6 +588,7 @@ bool qh_buildcone_onlygood(qhT *qh, vertexT *apex, int goodhorizon) {
     may be called multiple times
     checks facet and vertex lists for incorrect flags
     to recover from STOPcone, call qh_deletevisible and qh_resetlists
+    if 'Tj', records the wall-clock time of each qh_addpoint (qh_profileaddpoint)
 
   design:
     check visible facet and newfacet flags
@@ -591,6 +604,8 @@ void qh_buildhull(qhT *qh) {
   pointT *furthest;
   vertexT *vertex;
   int id;
+  double starttime;
+  bool isadded;
 
   trace1((qh, qh->ferr, 1037, "qh_buildhull: start build hull\n"));
   FORALLfacets {
@@ -622,7 +637,11 @@ void qh_buildhull(qhT *qh) {
       trace1((qh, qh->ferr, 1059, "qh_buildhull: stop after adding %d vertices\n", qh->STOPadd-1));
       return;
     }
-    if (!qh_addpoint(qh, furthest, facet, qh->ONLYmax))
+    starttime= (qh->PRINTprofile ? qh_wallclock() : 0.0);
+    isadded= qh_addpoint(qh, furthest, facet, qh->ONLYmax);
+    if (qh->PRINTprofile)
+      qh_profileaddpoint(qh, starttime);
+    if (!isadded)
       break;
   }
   if (qh->NARROWhull) /* move points from outsideset to coplanarset */
@@ -771,11 +771,15 @@ void qh_checkdelridge(qhT *qh /* qh.visible_facets, vertex_mergeset */) {
     called by qh_premerge (qh.CHECKzero, 'C-0') and qh_qhull ('Qx')
     uses qh.vertex_visit
     horizon facets may define multiple new facets
+    for a cone of at least qh_PARALLELmin new facets,
+      qh_checkzero_parallel skips the new facets that are clearly convex
 
   design:
     for all facets in qh.newfacet_list or qh.facet_list
       check for flagged faults (flipped, etc.)
-    for all facets in qh.newfacet_list or qh.facet_list
+    if 'QPn' and many new facets
+      test new facets in parallel up to the first facet that is not clearly convex
+    for all remaining facets in qh.newfacet_list or qh.facet_list
       for each neighbor of facet
         skip horizon facets for qh.newfacet_list
         test the opposite vertex
@@ -785,7 +789,8 @@ void qh_checkdelridge(qhT *qh /* qh.visible_facets, vertex_mergeset */) {
 bool qh_checkzero(qhT *qh, bool testall) {
   facetT *facet, *neighbor;
   facetT *horizon, *facetlist;
-  int neighbor_i, neighbor_n;
+  setT *newfacets;
+  int neighbor_i, neighbor_n, numnew= 0, numthreads;
   vertexT *vertex, **vertexp;
   realT dist;
 
@@ -799,11 +804,22 @@ bool qh_checkzero(qhT *qh, bool testall) {
         goto LABELproblem;
       if (facet->flipped || facet->dupridge || !facet->normal)
         goto LABELproblem;
+      numnew++;
     }
     if (qh->MERGEexact && qh->ZEROall_ok) {
       trace2((qh, qh->ferr, 2011, "qh_checkzero: skip convexity check until first pre-merge\n"));
       return true;
     }
+    numthreads= (qh->RANDOMdist ? 1 : qh_parallelthreads(qh, numnew));
+    if (numthreads > 1) {
+      newfacets= qh_settemp(qh, numnew);
+      FORALLfacet_(facetlist)
+        qh_setappend(qh, &newfacets, facet);
+      facetlist= qh_checkzero_parallel(qh, newfacets, numthreads);
+      qh_settempfree(qh, &newfacets);
+      if (!facetlist)
+        facetlist= qh->facet_tail;
+    }
   }
   FORALLfacet_(facetlist) {
     qh->vertex_visit++;
@@ -860,6 +876,111 @@ bool qh_checkzero(qhT *qh, bool testall) {
   return false;
 } /* checkzero */
 
+/*-<a                             href="qh-merge_r.htm#TOC"
+  >-------------------------------</a><a name="checkzero_parallel">-</a>
+
+  qh_checkzero_parallel(qh, newfacets, numthreads )
+    test a set of new, simplicial facets in parallel for qh_checkzero
+
+  returns:
+    the first new facet that is not clearly convex, or NULL if all are clearly convex
+    updates Zdistzero and Zdistplane for the clearly convex facets before it
+
+  notes:
+    called by qh_checkzero for a cone of at least qh_PARALLELmin new facets
+    the first neighbor of each new facet is its horizon facet
+    qh_checkzero repeats the returned facet with qh_distplane for its tracing and qh.ZEROall_ok
+    the parallel section uses qh_distnorm instead of qh_distplane (not 'Rn')
+      and tests membership in facet->vertices instead of qh.vertex_visit
+    the result is the same for any number of threads
+
+  design:
+    in parallel for each new facet
+      test the opposite vertex of each non-horizon neighbor
+      test the first vertex of the horizon facet that is not a vertex of the facet
+      stop at a distance above -2*qh.DISTround
+    find the first facet that stopped
+*/
+facetT *qh_checkzero_parallel(qhT *qh, setT *newfacets, int numthreads) {
+  facetT *facet, *firstfacet= NULL;
+  int *numdists;
+  int i, facet_i, facet_n, numfacets, chunk, totdist= 0;
+  unsigned char *isconvex;
+
+  numfacets= qh_setsize(qh, newfacets);
+  numdists= (int *)qh_memalloc(qh, numfacets * (int)sizeof(int));
+  isconvex= (unsigned char *)qh_memalloc(qh, numfacets * (int)sizeof(unsigned char));
+  chunk= (numfacets + numthreads - 1) / numthreads;
+#if qh_PARALLEL
+#pragma omp parallel for num_threads(numthreads) schedule(static, 1)
+#endif
+  for (i=0; i < numthreads; i++) {
+    facetT *facetj, *neighbor, *horizon;
+    vertexT *vertex, **vertexp;
+    realT dist, mindist= -2 * qh->DISTround;
+    int j, k, end, neighbor_i, neighbor_n, numdist, numvertices;
+    bool isin, isconvexj;
+
+    end= (i+1) * chunk;
+    minimize_(end, numfacets);
+    for (j= i * chunk; j < end; j++) {
+      facetj= SETelemt_(newfacets, j, facetT);
+      isconvex[j]= 0;
+      numdist= 0;
+      horizon= NULL;
+      FOREACHneighbor_i_(qh, facetj) {
+        if (!neighbor_i) {
+          horizon= neighbor;
+          continue;
+        }
+        vertex= SETelemt_(facetj->vertices, neighbor_i, vertexT);
+        numdist++;
+        dist= qh_distnorm(qh->hull_dim, vertex->point, neighbor->normal, &neighbor->offset);
+        if (dist >= mindist)
+          break;
+      }
+      if (neighbor)
+        continue;
+      isconvexj= true;
+      numvertices= qh_setsize(qh, facetj->neighbors);
+      FOREACHvertex_(horizon->vertices) {
+        isin= false;
+        for (k=1; k < numvertices; k++) {  /* the vertices of facetj visited by qh_checkzero */
+          if (SETelemt_(facetj->vertices, k, vertexT) == vertex) {
+            isin= true;
+            break;
+          }
+        }
+        if (!isin) {
+          numdist++;
+          dist= qh_distnorm(qh->hull_dim, vertex->point, facetj->normal, &facetj->offset);
+          if (dist >= mindist)
+            isconvexj= false;
+          break;
+        }
+      }
+      if (!isconvexj)
+        continue;
+      numdists[j]= numdist;
+      isconvex[j]= 1;
+    }
+  }
+  FOREACHfacet_i_(qh, newfacets) {
+    if (!isconvex[facet_i]) {
+      firstfacet= facet;
+      break;
+    }
+    totdist += numdists[facet_i];
+  }
+  zzadd_(Zdistzero, totdist);
+  zzadd_(Zdistplane, totdist);
+  qh_memfree(qh, isconvex, numfacets * (int)sizeof(unsigned char));
+  qh_memfree(qh, numdists, numfacets * (int)sizeof(int));
+  trace2((qh, qh->ferr, 2123, "qh_checkzero_parallel: %d of %d new facets are clearly convex with %d threads.  %d distance tests\n",
+      (firstfacet ? facet_i : numfacets), numfacets, numthreads, totdist));
+  return firstfacet;
+} /* checkzero_parallel */
+
 /*-<a                             href="qh-merge_r.htm#TOC"
   >-------------------------------</a><a name="compare_anglemerge">-</a>
 
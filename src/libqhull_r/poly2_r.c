@@ -68,6 +68,300 @@ void qh_addhash(void *newelem, setT *hashtable, int hashsize, int hash) {
     SETelem_(hashtable, scan)= newelem;
 } /* addhash */
 
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="buildhull2d">-</a>
+
+  qh_buildhull2d(qh, points, numpoints )
+    for 'Q18', construct a 2-d convex hull directly instead of qh_initialhull and qh_partitionall
+
+  returns:
+    false if not a 2-d convex hull with 'Q18', or if the hull is nearly flat
+      the caller builds the hull with qh_initialvertices, qh_initialhull, and qh_buildhull
+    true if qh.facet_list is the hull polygon (new facets and new vertices) and sets qh.interior_point
+      the remaining points near the hull are in outside sets or coplanar sets as for qh_partitionall
+
+  notes:
+    called by qh_initbuild after qh_detroundoff and the sentinels for qh.facet_tail and qh.vertex_tail
+    not for Delaunay triangulations or options 'Qg', 'TAn', 'TCn', and 'TVn'
+    facets are in counter-clockwise order.  Each facet's vertices are inverse sorted by vertex->id
+      as for qh_createsimplex, and f.neighbors[i] is opposite f.vertices[i]
+    a dropped point is within qh.MINoutside of a chord between two vertices, but it
+      may be further from the final hull.  qh_partitionpoint assigns it to an outside set
+      for qh_buildhull or a coplanar set for qh_check_maxout
+    a point more than qh.MAXcoplanar inside the extreme octagon is inside the hull ('Qi' tests all points)
+
+  design:
+    find the extreme points for x, y, x+y, and x-y (Akl-Toussaint octagon)
+    collect the points that are not clearly inside the octagon and sort them by x and y
+    build the lower and upper hulls by Andrew's monotone chain
+      drop a point if it is a right turn or within qh.MINoutside of the chord
+    return false if the hull is nearly flat
+    set qh.interior_point to the centroid of a large inscribed triangle
+    create a vertex for each hull point and a facet for each edge
+    set the hyperplane of each facet and test for a narrow hull
+    partition the dropped points starting from the facet below or above the point
+*/
+bool qh_buildhull2d(qhT *qh, pointT *points, int numpoints) {
+  pointT *point, *pointA, *pointO, *extremes[8], **sorted;
+  vertexT **hullvertices;
+  facetT **hullfacets, *facet, *lowerfacet, *upperfacet;
+  realT octagon[8][3], cross, tol2, margin, dist, distB, len, area, maxarea= 0.0, perimeter= 0.0;
+  realT angle, minangle= REALmax;
+  int *chain, i, j, k, numedges= 0, numsorted= 0, numlower, numvertices, farthest= 0, numpart= 0;
+
+  if (qh->hull_dim != 2 || qh->DELAUNAY || qh->ONLYgood || qh->STOPadd || qh->STOPcone || qh->STOPpoint || numpoints < qh->hull_dim+1)
+    return false;
+  for (k=0; k < 8; k++)
+    extremes[k]= points;
+  for (i=0, point=points; i < numpoints; i++, point += 2) {
+    if (point[1] < extremes[0][1])
+      extremes[0]= point;  /* bottom */
+    if (point[0] - point[1] > extremes[1][0] - extremes[1][1])
+      extremes[1]= point;  /* bottom right */
+    if (point[0] > extremes[2][0])
+      extremes[2]= point;  /* right */
+    if (point[0] + point[1] > extremes[3][0] + extremes[3][1])
+      extremes[3]= point;  /* top right */
+    if (point[1] > extremes[4][1])
+      extremes[4]= point;  /* top */
+    if (point[0] - point[1] < extremes[5][0] - extremes[5][1])
+      extremes[5]= point;  /* top left */
+    if (point[0] < extremes[6][0])
+      extremes[6]= point;  /* left */
+    if (point[0] + point[1] < extremes[7][0] + extremes[7][1])
+      extremes[7]= point;  /* bottom left */
+  }
+  if (!qh->KEEPinside) {
+    for (k=0; k < 8; k++) {  /* the extreme points are in counter-clockwise order */
+      pointO= extremes[k];
+      pointA= extremes[(k+1)%8];
+      octagon[numedges][0]= pointA[1] - pointO[1];  /* outer normal */
+      octagon[numedges][1]= pointO[0] - pointA[0];
+      len= sqrt(octagon[numedges][0] * octagon[numedges][0] + octagon[numedges][1] * octagon[numedges][1]);
+      if (len > 0.0) {
+        octagon[numedges][0] /= len;
+        octagon[numedges][1] /= len;
+        octagon[numedges][2]= -(octagon[numedges][0] * pointO[0] + octagon[numedges][1] * pointO[1]);
+        numedges++;
+      }
+    }
+  }
+  margin= qh->MAXcoplanar;
+  if (qh->KEEPnearinside)
+    maximize_(margin, qh->NEARinside);
+  margin += 2 * qh->DISTround;
+  sorted= (pointT **)qh_memalloc(qh, numpoints * (int)sizeof(pointT *));
+  for (i=0, point=points; i < numpoints; i++, point += 2) {
+    for (k=0; k < numedges; k++) {
+      if (octagon[k][0] * point[0] + octagon[k][1] * point[1] + octagon[k][2] >= -margin)
+        break;
+    }
+    if (k < numedges || numedges == 0)
+      sorted[numsorted++]= point;
+  }
+  qsort(sorted, (size_t)numsorted, sizeof(pointT *), qh_compare_point2d);
+  chain= (int *)qh_memalloc(qh, (2 * numsorted + 1) * (int)sizeof(int));
+  tol2= qh->MINoutside * qh->MINoutside;
+  k= 0;
+  for (i=0; i < numsorted; i++) {  /* lower hull from left to right */
+    point= sorted[i];
+    while (k >= 2) {
+      pointO= sorted[chain[k-2]];
+      pointA= sorted[chain[k-1]];
+      cross= (pointA[0] - pointO[0]) * (point[1] - pointO[1]) - (pointA[1] - pointO[1]) * (point[0] - pointO[0]);
+      if (cross > 0.0 && cross * cross > tol2 * ((point[0] - pointO[0]) * (point[0] - pointO[0]) + (point[1] - pointO[1]) * (point[1] - pointO[1])))
+        break;
+      k--;
+    }
+    chain[k++]= i;
+  }
+  numlower= k;
+  for (i=numsorted-2; i >= 0; i--) {  /* upper hull from right to left */
+    point= sorted[i];
+    while (k > numlower) {
+      pointO= sorted[chain[k-2]];
+      pointA= sorted[chain[k-1]];
+      cross= (pointA[0] - pointO[0]) * (point[1] - pointO[1]) - (pointA[1] - pointO[1]) * (point[0] - pointO[0]);
+      if (cross > 0.0 && cross * cross > tol2 * ((point[0] - pointO[0]) * (point[0] - pointO[0]) + (point[1] - pointO[1]) * (point[1] - pointO[1])))
+        break;
+      k--;
+    }
+    chain[k++]= i;
+  }
+  numvertices= k-1;  /* chain[numvertices] is chain[0] */
+  if (numvertices >= 3) {  /* inscribed triangle from the leftmost and rightmost points */
+    pointO= sorted[chain[0]];
+    pointA= sorted[chain[numlower-1]];
+    maxarea= 0.0;
+    for (j=1; j < numvertices; j++) {
+      point= sorted[chain[j]];
+      area= fabs_((pointA[0] - pointO[0]) * (point[1] - pointO[1]) - (pointA[1] - pointO[1]) * (point[0] - pointO[0]));
+      if (area > maxarea) {
+        maxarea= area;
+        farthest= j;
+      }
+    }
+    point= sorted[chain[farthest]];
+    perimeter= qh_pointdist(pointO, pointA, 2) + qh_pointdist(pointA, point, 2) + qh_pointdist(point, pointO, 2);
+  }
+  if (numvertices < 3 || maxarea <= perimeter * (qh->WIDEfacet + 2 * qh->DISTround)) {  /* inradius is 2*area/perimeter */
+    trace1((qh, qh->ferr, 1074, "qh_buildhull2d: the hull of %d points is nearly flat with %d vertices.  Use qh_initialhull\n",
+      numsorted, numvertices));
+    qh_memfree(qh, chain, (2 * numsorted + 1) * (int)sizeof(int));
+    qh_memfree(qh, sorted, numpoints * (int)sizeof(pointT *));
+    return false;
+  }
+  qh->interior_point= (pointT *)qh_memalloc(qh, qh->normal_size);
+  for (k=0; k < 2; k++)
+    qh->interior_point[k]= (pointO[k] + pointA[k] + point[k]) / 3.0;
+  hullvertices= (vertexT **)qh_memalloc(qh, numvertices * (int)sizeof(vertexT *));
+  hullfacets= (facetT **)qh_memalloc(qh, numvertices * (int)sizeof(facetT *));
+  for (j=0; j < numvertices; j++) {
+    hullvertices[j]= qh_newvertex(qh, sorted[chain[j]]);
+    qh_appendvertex(qh, hullvertices[j]);
+    hullfacets[j]= qh_newfacet(qh);
+    qh_appendfacet(qh, hullfacets[j]);
+  }
+  for (j=0; j < numvertices; j++) {  /* facet j is the edge from vertex j to vertex j+1 */
+    facet= hullfacets[j];
+    facet->vertices= qh_setnew(qh, qh->hull_dim);
+    lowerfacet= hullfacets[(j+numvertices-1)%numvertices];
+    upperfacet= hullfacets[(j+1)%numvertices];
+    if (hullvertices[j]->id > hullvertices[(j+1)%numvertices]->id) {
+      facet->toporient= true;
+      qh_setappend(qh, &facet->vertices, hullvertices[j]);
+      qh_setappend(qh, &facet->vertices, hullvertices[(j+1)%numvertices]);
+      qh_setappend(qh, &facet->neighbors, upperfacet);
+      qh_setappend(qh, &facet->neighbors, lowerfacet);
+    }else {
+      qh_setappend(qh, &facet->vertices, hullvertices[(j+1)%numvertices]);
+      qh_setappend(qh, &facet->vertices, hullvertices[j]);
+      qh_setappend(qh, &facet->neighbors, lowerfacet);
+      qh_setappend(qh, &facet->neighbors, upperfacet);
+    }
+  }
+  for (j=0; j < numvertices; j++) {
+    facet= hullfacets[j];
+    qh_setfacetplane(qh, facet);
+    if (facet->flipped) {
+      qh_fprintf(qh, qh->ferr, 6445, "qhull internal error (qh_buildhull2d): facet f%d of the 2-d hull is flipped.  qh.interior_point is above its hyperplane\n",
+        facet->id);
+      qh_errexit(qh, qh_ERRqhull, facet, NULL);
+    }
+    if (j > 0) {
+      angle= qh_getangle(qh, facet->normal, hullfacets[j-1]->normal);
+      minimize_(minangle, angle);
+    }
+  }
+  if (minangle < qh_MAXnarrow && !qh->NOnarrow) {  /* as for qh_initialhull */
+    realT diff= 1.0 + minangle;
+
+    qh->NARROWhull= true;
+    qh_option(qh, "_narrow-hull", NULL, &diff);
+    if (minangle < qh_WARNnarrow && !qh->RERUN && qh->PRINTprecision)
+      qh_printhelp_narrowhull(qh, qh->ferr, minangle);
+  }
+  zzval_(Zprocessed)= numvertices;
+  qh->facet_next= qh->facet_list;  /* as for qh_initialhull */
+  for (j=0; j < numvertices; j++)
+    sorted[chain[j]]= NULL;
+  qh->findbest_notsharp= true;  /* a polygon is not a cone of new facets, qh_findbest's directed search suffices */
+  j= 0;
+  k= numvertices-1;
+  for (i=0; i < numsorted; i++) {
+    if (!(point= sorted[i]))
+      continue;
+    while (j < numlower-2 && hullvertices[j+1]->point[0] <= point[0])
+      j++;
+    while (k > numlower-1 && hullvertices[k]->point[0] < point[0])
+      k--;
+    lowerfacet= hullfacets[j];
+    upperfacet= hullfacets[k];
+    qh_distplane(qh, point, lowerfacet, &dist);
+    qh_distplane(qh, point, upperfacet, &distB);
+    qh_partitionpoint(qh, point, (dist >= distB ? lowerfacet : upperfacet));
+    numpart++;
+  }
+  qh->findbest_notsharp= false;
+  zzadd_(Zpartitionall, zzval_(Zpartition));
+  zzval_(Zpartition)= 0;
+  trace1((qh, qh->ferr, 1075, "qh_buildhull2d: constructed a hull of %d vertices from %d of %d points.  Partitioned %d points with %d outside\n",
+    numvertices, numsorted, numpoints, numpart, qh->num_outside));
+  qh_memfree(qh, hullfacets, numvertices * (int)sizeof(facetT *));
+  qh_memfree(qh, hullvertices, numvertices * (int)sizeof(vertexT *));
+  qh_memfree(qh, chain, (2 * numsorted + 1) * (int)sizeof(int));
+  qh_memfree(qh, sorted, numpoints * (int)sizeof(pointT *));
+  return true;
+} /* buildhull2d */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="buildhull3d">-</a>
+
+  qh_buildhull3d(qh, points, numpoints )
+    for 'Q19', construct a 3-d convex hull with a half-edge triangulation instead of qh_initialhull and qh_partitionall
+
+  returns:
+    false if not a 3-d convex hull with 'Q19', if the initial simplex is nearly flat, or
+      if qhull's hyperplanes do not confirm a convex hull (qh_hull3d_makefacets)
+      the caller builds the hull with qh_initialvertices, qh_initialhull, and qh_buildhull
+    true if qh.facet_list is the simplicial hull (new facets and new vertices) and sets qh.interior_point
+      the remaining points are in outside sets or coplanar sets as for qh_partitionall
+
+  notes:
+    called by qh_initbuild after qh_detroundoff and the sentinels for qh.facet_tail and qh.vertex_tail
+    not for Delaunay triangulations or options 'Qg', 'Qi', 'QGn', 'A-n', 'TAn', 'TCn', and 'TVn'
+    hull3dT replaces facetT, vertexT, and setT with arrays of faces, half-edges, and point ids
+    every edge of the triangulation is clearly convex by hull->tolconvex.  There is nothing to merge
+      the face normals are cross products.  qh_hull3d_makefacets retests the edges with qh_setfacetplane
+    if a point is nearly coplanar with a face or would create an edge that is not clearly convex
+      it stays outside.  qh_buildhull adds it with merging after qh_hull3d_makefacets
+      this is typical for cospherical, cocircular, or coplanar points (e.g., 'rbox c', 'rbox W0')
+    if another point deletes the face of a deferred point, the point is partitioned and tried again
+
+  design:
+    create the initial simplex and partition the points into its faces
+    while a face has outside points
+      add its furthest point by qh_hull3d_addpoint
+      if the hull is unchanged, defer the point to qh_buildhull
+    create the vertices and facets of the hull and partition the remaining points by qh_hull3d_makefacets
+      return false if an edge is not clearly convex for qhull's hyperplanes
+*/
+bool qh_buildhull3d(qhT *qh, pointT *points, int numpoints) {
+  hull3dT *hull;
+  int face, numdeferred= 0;
+
+  if (qh->hull_dim != 3 || qh->DELAUNAY || qh->ONLYgood || qh->KEEPinside || qh->GOODpointp || qh->STOPadd || qh->STOPcone || qh->STOPpoint
+  || qh->premerge_cos < REALmax/2 || numpoints < qh->hull_dim+1)
+    return false;
+  hull= qh_hull3d_new(qh, points, numpoints);
+  hull->tolout= qh->MINoutside;
+  hull->tolconvex= (qh->PREmerge ? qh->premerge_centrum : 0.0) + 2 * qh->DISTround;
+  hull->keepnear= (qh->KEEPcoplanar || qh->KEEPnearinside);
+  hull->margin= qh->MAXcoplanar;
+  if (qh->KEEPnearinside)
+    maximize_(hull->margin, qh->NEARinside);
+  hull->margin += 2 * qh->DISTround;
+  if (!qh_hull3d_simplex(qh, hull, numpoints)) {
+    qh_hull3d_free(qh, hull);
+    return false;
+  }
+  while (hull->numpending) {
+    face= hull->pending[--hull->numpending];
+    if (!hull->faces[face].deleted && hull->faces[face].numoutside) {
+      if (!qh_hull3d_addpoint(qh, hull, face))
+        numdeferred++;
+    }
+  }
+  trace1((qh, qh->ferr, 1077, "qh_buildhull3d: added %d points to the half-edge hull.  Deferred %d points to qh_buildhull\n",
+    hull->numapex, numdeferred));
+  if (!qh_hull3d_makefacets(qh, hull)) {
+    qh_hull3d_free(qh, hull);
+    return false;
+  }
+  qh_hull3d_free(qh, hull);
+  return true;
+} /* buildhull3d */
+
 /*-<a                             href="qh-poly_r.htm#TOC"
   >-------------------------------</a><a name="check_bestdist">-</a>
 
@@ -162,6 +456,82 @@ options 'Qci Tv' to verify all points.\n", notverified);
   trace0((qh, qh->ferr, 20, "qh_check_bestdist: max distance outside %2.2g\n", maxdist));
 } /* check_bestdist */
 
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="check_facetpoints">-</a>
+
+  qh_check_facetpoints(qh, tree, facet, maxoutside, numdist, isoutside )
+    return the maximum distance of tree's points above facet
+    skips subtrees whose box is below maxoutside and the facet's vertices
+
+  returns:
+    maximum distance, the same as testing every point
+    isoutside if a point is above maxoutside
+    adds distance tests to numdist
+
+  notes:
+    called by qh_check_pointtree.  Thread-safe, no statistics or tracing
+    a skipped point is not outside and does not change the maximum distance
+    upper is the maximum distance of a box, less a bound on the round-off of upper and dist
+
+  design:
+    determine the maximum distance of facet's vertices
+    for each node in preorder
+      skip its subtree if the node's box is below maxoutside and the maximum distance
+      if a leaf
+        test each point
+*/
+realT qh_check_facetpoints(qhT *qh, pointtreeT *tree, facetT *facet, realT maxoutside, int *numdist, bool *isoutside) {
+  vertexT *vertex, **vertexp;
+  pointnodeT *node;
+  coordT *normal= facet->normal, *low, *high;
+  realT dist, upper, skipdist, roundoff, maxdist= -REALmax;
+  int dim= qh->hull_dim, nodeid, i, k;
+
+  *isoutside= false;
+  FOREACHvertex_(facet->vertices) {
+    if (vertex->point != qh->GOODpointp && qh_pointid(qh, vertex->point) >= 0) {
+      (*numdist)++;
+      dist= qh_distnorm(dim, vertex->point, normal, &facet->offset);
+      maximize_(maxdist, dist);
+    }
+  }
+  if (maxdist > maxoutside)
+    *isoutside= true;
+  low= tree->boxes;
+  high= low + dim;
+  roundoff= fabs_(facet->offset);
+  for (k=0; k < dim; k++)
+    roundoff += fabs_(normal[k]) * fmax_(fabs_(low[k]), fabs_(high[k]));
+  roundoff *= 4 * (dim + 1) * REALepsilon;
+  skipdist= fmin_(maxdist, maxoutside) - roundoff;
+  for (nodeid=0; nodeid < tree->numnodes; ) {
+    node= tree->nodes + nodeid;
+    low= tree->boxes + 2 * dim * nodeid;
+    high= low + dim;
+    upper= facet->offset;
+    for (k=0; k < dim; k++)
+      upper += normal[k] * (normal[k] > 0 ? high[k] : low[k]);
+    if (upper <= skipdist) {
+      nodeid= node->skip;
+      continue;
+    }
+    if (node->skip == nodeid+1) {
+      for (i=node->start; i < node->end; i++) {
+        (*numdist)++;
+        dist= qh_distnorm(dim, tree->points[i], normal, &facet->offset);
+        if (dist > maxdist) {
+          maxdist= dist;
+          if (dist > maxoutside)
+            *isoutside= true;
+        }
+      }
+      skipdist= fmin_(maxdist, maxoutside) - roundoff;
+    }
+    nodeid++;
+  }
+  return maxdist;
+} /* check_facetpoints */
+
 #ifndef qh_NOmerge
 /*-<a                             href="qh-poly_r.htm#TOC"
   >-------------------------------</a><a name="check_maxout">-</a>
@@ -187,9 +557,11 @@ options 'Qci Tv' to verify all points.\n", notverified);
 
   design:
     if qh.min_vertex is needed
-      for all neighbors of all vertices
+      for all neighbors of all vertices (in parallel if 'QPn', qh_check_minvertex)
         test distance from vertex to neighbor
     determine facet for each point (if any)
+    if parallel ('QPn')
+      find the best facet for each point with qh_check_maxoutpoints
     for each point with an assigned facet
       find the best facet for the point and check all coplanar facets
         (updates outer planes)
@@ -197,10 +569,11 @@ options 'Qci Tv' to verify all points.\n", notverified);
 */
 void qh_check_maxout(qhT *qh) {
   facetT *facet, *bestfacet, *neighbor, **neighborp, *facetlist, *maxbestfacet= NULL, *minfacet, *maxfacet, *maxpointfacet;
+  facetT **bestfacets= NULL;
   realT dist, maxoutside, mindist, nearest;
-  realT maxoutside_base, minvertex_base;
+  realT maxoutside_base, minvertex_base, *dists= NULL;
   pointT *point, *maxpoint= NULL;
-  int numpart= 0, facet_i, facet_n, notgood= 0;
+  int numpart= 0, facet_i, facet_n, notgood= 0, numthreads, numpoints;
   setT *facets, *vertices;
   vertexT *vertex, *minvertex;
 
@@ -214,51 +587,69 @@ void qh_check_maxout(qhT *qh) {
         || qh->TRACElevel || qh->PRINTstatistics || qh->VERIFYoutput || qh->CHECKfrequently
         || qh->PRINTout[0] == qh_PRINTsummary || qh->PRINTout[0] == qh_PRINTnone)) {
     trace1((qh, qh->ferr, 1023, "qh_check_maxout: determine actual minvertex\n"));
-    vertices= qh_pointvertex(qh /* qh.facet_list */);
-    FORALLvertices {
-      FOREACHneighbor_(vertex) {
-        zinc_(Zdistvertex);  /* distance also computed by main loop below */
-        qh_distplane(qh, vertex->point, neighbor, &dist);
-        if (dist < mindist) {
-          if (qh->min_vertex/minvertex_base > qh_WIDEmaxoutside && (qh->PRINTprecision || !qh->ALLOWwide)) {
-            nearest= qh_vertex_bestdist(qh, neighbor->vertices);
-            /* should be caught in qh_mergefacet */
-            qh_fprintf(qh, qh->ferr, 7083, "Qhull precision warning: in post-processing (qh_check_maxout) p%d(v%d) is %2.2g below f%d nearest vertices %2.2g\n",
-              qh_pointid(qh, vertex->point), vertex->id, dist, neighbor->id, nearest);
+    numthreads= qh_parallelthreads(qh, qh->num_vertices);
+    if (numthreads > 1 && !qh->RANDOMdist && qh->TRACEdist > REALmax/2 && !qh->tracefacet && !qh->tracevertex
+    && !(qh->min_vertex/minvertex_base > qh_WIDEmaxoutside && (qh->PRINTprecision || !qh->ALLOWwide))) {
+      qh_check_minvertex(qh, numthreads, &mindist, &minvertex, &minfacet);  /* no warnings or traces */
+    }else {
+      vertices= qh_pointvertex(qh /* qh.facet_list */);
+      FORALLvertices {
+        FOREACHneighbor_(vertex) {
+          zinc_(Zdistvertex);  /* distance also computed by main loop below */
+          qh_distplane(qh, vertex->point, neighbor, &dist);
+          if (dist < mindist) {
+            if (qh->min_vertex/minvertex_base > qh_WIDEmaxoutside && (qh->PRINTprecision || !qh->ALLOWwide)) {
+              nearest= qh_vertex_bestdist(qh, neighbor->vertices);
+              /* should be caught in qh_mergefacet */
+              qh_fprintf(qh, qh->ferr, 7083, "Qhull precision warning: in post-processing (qh_check_maxout) p%d(v%d) is %2.2g below f%d nearest vertices %2.2g\n",
+                qh_pointid(qh, vertex->point), vertex->id, dist, neighbor->id, nearest);
+            }
+            mindist= dist;
+            minvertex= vertex;
+            minfacet= neighbor;
           }
-          mindist= dist;
-          minvertex= vertex;
-          minfacet= neighbor;
-        }
 #ifndef qh_NOtrace
-        if (-dist > qh->TRACEdist || dist > qh->TRACEdist
-        || neighbor == qh->tracefacet || vertex == qh->tracevertex) {
-          nearest= qh_vertex_bestdist(qh, neighbor->vertices);
-          qh_fprintf(qh, qh->ferr, 8093, "qh_check_maxout: p%d(v%d) is %.2g from f%d nearest vertices %2.2g\n",
-                    qh_pointid(qh, vertex->point), vertex->id, dist, neighbor->id, nearest);
-        }
+          if (-dist > qh->TRACEdist || dist > qh->TRACEdist
+          || neighbor == qh->tracefacet || vertex == qh->tracevertex) {
+            nearest= qh_vertex_bestdist(qh, neighbor->vertices);
+            qh_fprintf(qh, qh->ferr, 8093, "qh_check_maxout: p%d(v%d) is %.2g from f%d nearest vertices %2.2g\n",
+                      qh_pointid(qh, vertex->point), vertex->id, dist, neighbor->id, nearest);
+          }
 #endif
+        }
       }
+      qh_settempfree(qh, &vertices);
     }
     if (qh->MERGING) {
       wmin_(Wminvertex, qh->min_vertex);
     }
     qh->min_vertex= mindist;
-    qh_settempfree(qh, &vertices);
   }
   trace1((qh, qh->ferr, 1055, "qh_check_maxout: determine actual maxoutside\n"));
   maxoutside_base= fmax_(qh->max_outside, qh->ONEmerge+qh->DISTround);
   /* maxoutside_base is same as qh.MAXoutside without qh.MINoutside (qh_detmaxoutside) */
   facets= qh_pointfacet(qh /* qh.facet_list */);
+  numpoints= qh_setsize(qh, facets);
+  numthreads= qh_parallelthreads(qh, numpoints);
+  if (numthreads > 1 && !qh->RANDOMdist) {
+    bestfacets= (facetT **)qh_memalloc(qh, numpoints * (int)sizeof(facetT *));
+    dists= (realT *)qh_memalloc(qh, numpoints * (int)sizeof(realT));
+    qh_check_maxoutpoints(qh, facets, numthreads, bestfacets, dists, &numpart);
+  }
   FOREACHfacet_i_(qh, facets) {     /* for each point with facet assignment */
     if (facet) {
       point= qh_point(qh, facet_i);
       if (point == qh->GOODpointp)
         continue;
-      zzinc_(Ztotcheck);
-      qh_distplane(qh, point, facet, &dist);
-      numpart++;
-      bestfacet= qh_findbesthorizon(qh, qh_IScheckmax, point, facet, !qh_NOupper, &dist, &numpart);
+      if (bestfacets) {
+        bestfacet= bestfacets[facet_i];
+        dist= dists[facet_i];
+      }else {
+        zzinc_(Ztotcheck);
+        qh_distplane(qh, point, facet, &dist);
+        numpart++;
+        bestfacet= qh_findbesthorizon(qh, qh_IScheckmax, point, facet, !qh_NOupper, &dist, &numpart);
+      }
       if (bestfacet && dist >= maxoutside) { 
         if (qh->ONLYgood && !bestfacet->good
         && !((bestfacet= qh_findgooddist(qh, point, bestfacet, &dist, &facetlist))
@@ -286,6 +677,10 @@ void qh_check_maxout(qhT *qh) {
     }
   }
   zzadd_(Zcheckpart, numpart);
+  if (bestfacets) {
+    qh_memfree(qh, bestfacets, numpoints * (int)sizeof(facetT *));
+    qh_memfree(qh, dists, numpoints * (int)sizeof(realT));
+  }
   qh_settempfree(qh, &facets);
   wval_(Wmaxout)= maxoutside - qh->max_outside;
   wmax_(Wmaxoutside, qh->max_outside);
@@ -330,6 +725,182 @@ void qh_check_maxout(qhT *qh) {
     }
   }
 } /* check_maxout */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="check_maxoutpoints">-</a>
+
+  qh_check_maxoutpoints(qh, facets, numthreads, bestfacets, dists, numpart )
+    find the best facet for each point with a facet assignment, in parallel
+    facets is from qh_pointfacet
+
+  returns:
+    bestfacets[i] and dists[i] for point i, or NULL if no facet or qh.GOODpointp
+    updates facet->maxoutside for the start facet and visited facets
+    adds distance tests to numpart
+    counts Ztotcheck and Zdistplane
+
+  notes:
+    called by qh_check_maxout if numthreads > 1, the same as qh_findbesthorizon(qh, qh_IScheckmax, ...)
+    each thread has its own queryT and facet->maxoutside for facet->id, reduced after the threads
+    the caller reports the points in order
+
+  design:
+    allocate a queryT and maxoutsides for each thread
+    for each thread in parallel
+      for its range of points
+        search for the best facet with qh_query_findhorizon
+    update facet->maxoutside from the threads' maxoutsides
+*/
+void qh_check_maxoutpoints(qhT *qh, setT *facets, int numthreads, facetT **bestfacets, realT *dists, int *numpart) {
+  queryT **queries;
+  facetT *facet;
+  realT *maxoutsides;
+  int i, chunk, numpoints, numcheck= 0, numdist= 0;
+  size_t k, numids= qh->facet_id;
+
+  numpoints= qh_setsize(qh, facets);
+  chunk= (numpoints + numthreads - 1) / numthreads;
+  queries= (queryT **)qh_memalloc(qh, numthreads * (int)sizeof(queryT *));
+  for (i=0; i < numthreads; i++)
+    queries[i]= qh_query_alloc(qh);
+  if (!(maxoutsides= (realT *)qh_malloc((size_t)numthreads * numids * sizeof(realT)))) {
+    qh_fprintf(qh, qh->ferr, 6444, "qhull error (qh_check_maxoutpoints): insufficient memory for f.maxoutside of %d facet ids and %d threads\n",
+        qh->facet_id, numthreads);
+    qh_errexit(qh, qh_ERRmem, NULL, NULL);
+  }
+  for (k=0; k < (size_t)numthreads * numids; k++)
+    maxoutsides[k]= -REALmax;
+#if qh_PARALLEL
+#pragma omp parallel for num_threads(numthreads) schedule(static, 1)
+#endif
+  for (i=0; i < numthreads; i++) {
+    queryT *query= queries[i];
+    realT *maxoutside= maxoutsides + (size_t)i * numids;
+    facetT *facetj;
+    pointT *point;
+    realT dist;
+    int j, end;
+
+    end= (i+1)*chunk;
+    minimize_(end, numpoints);
+    for (j= i*chunk; j < end; j++) {
+      bestfacets[j]= NULL;
+      if (!(facetj= SETelemt_(facets, j, facetT)))
+        continue;
+      point= qh_point(qh, j);
+      if (point == qh->GOODpointp)
+        continue;
+      query->numpart++;
+      dist= qh_distnorm(qh->hull_dim, point, facetj->normal, &facetj->offset);
+      bestfacets[j]= qh_query_findhorizon(qh, query, qh_IScheckmax, point, facetj, !qh_NOupper, &dist, &query->numpart, maxoutside);
+      dists[j]= dist;
+    }
+  }
+  for (i=0; i < numthreads; i++) {
+    numdist += queries[i]->numpart;
+    qh_query_free(qh, &queries[i]);
+  }
+  for (i=0; i < numpoints; i++) {
+    if (bestfacets[i])
+      numcheck++;
+  }
+#if qh_MAXoutside
+  FORALLfacets {
+    for (i=0; i < numthreads; i++)
+      maximize_(facet->maxoutside, maxoutsides[(size_t)i * numids + facet->id]);
+  }
+#endif
+  *numpart += numdist;
+  zzadd_(Ztotcheck, numcheck);
+  zzadd_(Zdistplane, numdist);
+  qh_free(maxoutsides);
+  qh_memfree(qh, queries, numthreads * (int)sizeof(queryT *));
+} /* check_maxoutpoints */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="check_minvertex">-</a>
+
+  qh_check_minvertex(qh, numthreads, mindist, minvertex, minfacet )
+    determine the minimum distance of a vertex below a neighboring facet, in parallel
+    mindist is the starting minimum, usually 0.0
+
+  returns:
+    updates mindist, minvertex, and minfacet if a vertex is below mindist
+    counts Zdistvertex and Zdistplane
+
+  notes:
+    called by qh_check_maxout if numthreads > 1 and no warnings or traces
+    returns the first minimum of qh.vertex_list, the same as the serial loop
+
+  design:
+    collect the vertices in order
+    for each thread in parallel
+      for its range of vertices
+        determine the minimum distance below a neighbor
+    return the first minimum of the threads, in order
+*/
+void qh_check_minvertex(qhT *qh, int numthreads, realT *mindist, vertexT **minvertex, facetT **minfacet) {
+  setT *vertices;
+  vertexT *vertex;
+  vertexT **minvertices;
+  facetT **minfacets;
+  realT *mindists;
+  int i, chunk, numvertices, numdist= 0;
+  int *numdists;
+
+  vertices= qh_settemp(qh, qh->num_vertices);
+  FORALLvertices
+    qh_setappend(qh, &vertices, vertex);
+  numvertices= qh_setsize(qh, vertices);
+  chunk= (numvertices + numthreads - 1) / numthreads;
+  mindists= (realT *)qh_memalloc(qh, numthreads * (int)sizeof(realT));
+  minvertices= (vertexT **)qh_memalloc(qh, numthreads * (int)sizeof(vertexT *));
+  minfacets= (facetT **)qh_memalloc(qh, numthreads * (int)sizeof(facetT *));
+  numdists= (int *)qh_memalloc(qh, numthreads * (int)sizeof(int));
+#if qh_PARALLEL
+#pragma omp parallel for num_threads(numthreads) schedule(static, 1)
+#endif
+  for (i=0; i < numthreads; i++) {
+    vertexT *vertexj;
+    facetT *neighbor, **neighborp;
+    realT dist;
+    int j, end;
+
+    mindists[i]= *mindist;
+    minvertices[i]= NULL;
+    minfacets[i]= NULL;
+    numdists[i]= 0;
+    end= (i+1)*chunk;
+    minimize_(end, numvertices);
+    for (j= i*chunk; j < end; j++) {
+      vertexj= SETelemt_(vertices, j, vertexT);
+      FOREACHneighbor_(vertexj) {
+        numdists[i]++;
+        dist= qh_distnorm(qh->hull_dim, vertexj->point, neighbor->normal, &neighbor->offset);
+        if (dist < mindists[i]) {
+          mindists[i]= dist;
+          minvertices[i]= vertexj;
+          minfacets[i]= neighbor;
+        }
+      }
+    }
+  }
+  for (i=0; i < numthreads; i++) {
+    numdist += numdists[i];
+    if (minvertices[i] && mindists[i] < *mindist) {
+      *mindist= mindists[i];
+      *minvertex= minvertices[i];
+      *minfacet= minfacets[i];
+    }
+  }
+  zadd_(Zdistvertex, numdist);
+  zzadd_(Zdistplane, numdist);
+  qh_memfree(qh, mindists, numthreads * (int)sizeof(realT));
+  qh_memfree(qh, minvertices, numthreads * (int)sizeof(vertexT *));
+  qh_memfree(qh, minfacets, numthreads * (int)sizeof(facetT *));
+  qh_memfree(qh, numdists, numthreads * (int)sizeof(int));
+  qh_settempfree(qh, &vertices);
+} /* check_minvertex */
 #else /* qh_NOmerge */
 void qh_check_maxout(qhT *qh) {
   QHULL_UNUSED(qh)
@@ -344,10 +915,11 @@ void qh_check_maxout(qhT *qh) {
     Maybe called after Voronoi output.  If so, it recomputes centrums since they are Voronoi centers instead.
 */
 void qh_check_output(qhT *qh) {
-  int i;
+  int i, prevphase;
 
   if (qh->STOPcone)
     return;
+  prevphase= qh_profilephase(qh, qh_PHASEcheck);
   if (qh->VERIFYoutput || qh->IStracing || qh->CHECKfrequently) {
     qh_checkpolygon(qh, qh->facet_list);
     qh_checkflipped_all(qh, qh->facet_list);
@@ -356,6 +928,7 @@ void qh_check_output(qhT *qh) {
     qh_checkflipped_all(qh, qh->facet_list);
     qh_checkconvex(qh, qh->facet_list, qh_ALGORITHMfault);
   }
+  qh_profilephase(qh, prevphase);
 } /* check_output */
 
 
@@ -405,22 +978,28 @@ void qh_check_point(qhT *qh, pointT *point, facetT *facet, realT *maxoutside, re
       one qh.DISTround for the computed distances in qh_check_points
     qh_printafacet and qh_printsummary needs only one qh.DISTround
     the computation for qh.VERIFYdirect does not account for qh.other_points
+    unless 'Rn' or 'T4', qh_check_pointtree tests the facets in parallel ('QPn')
+      and skips the points in boxes that are below a facet.  Same messages and maxdist
 
   design:
     if many points
       use qh_check_bestdist()
     else
+      test all points against all facets with qh_check_pointtree (skips points below a facet)
       for all facets
-        for all points
-          check that point is inside facet
+        if a point may be outside the facet
+          for all points
+            check that point is inside facet
 */
 void qh_check_points(qhT *qh) {
   facetT *facet, *errfacet1= NULL, *errfacet2= NULL;
   realT total, maxoutside, maxdist= -REALmax;
+  realT *maxdists= NULL;
   pointT *point, **pointp, *pointtemp;
-  int errcount;
-  bool testouter;
+  int errcount, prevphase, numtested= 0;
+  bool testouter, *isoutsides= NULL;
 
+  prevphase= qh_profilephase(qh, qh_PHASEcheck);
   maxoutside= qh_maxouter(qh);
   maxoutside += qh->DISTround;
   /* one more qh.DISTround for check computation */
@@ -457,6 +1036,11 @@ Output completed.  Verifying that all points are below %2.2g of\n\
 all %sfacets.  Will make %2.0f distance computations.\n",
               maxoutside, (qh->ONLYgood ?  "good " : ""), total);
     }
+    if (!qh->RANDOMdist && qh->IStracing < 4) {  /* qh_distplane is the same as qh_distnorm */
+      maxdists= (realT *)qh_memalloc(qh, qh->num_facets * (int)sizeof(realT));
+      isoutsides= (bool *)qh_memalloc(qh, qh->num_facets * (int)sizeof(bool));
+      qh_check_pointtree(qh, maxoutside, testouter, maxdists, isoutsides);
+    }
     FORALLfacets {
       if (!facet->good && qh->ONLYgood)
         continue;
@@ -474,6 +1058,10 @@ all %sfacets.  Will make %2.0f distance computations.\n",
         /* one DISTround to actual point and another to computed point */
 #endif
       }
+      if (maxdists && !isoutsides[numtested++]) {  /* otherwise repeat the test to report the outside points */
+        maximize_(maxdist, maxdists[numtested-1]);
+        continue;
+      }
       errcount= 0;
       FORALLpoints {
         if (point != qh->GOODpointp)
@@ -488,6 +1076,10 @@ all %sfacets.  Will make %2.0f distance computations.\n",
              errcount-qh_MAXcheckpoint+1, facet->id, maxdist);
       }
     }
+    if (maxdists) {
+      qh_memfree(qh, maxdists, qh->num_facets * (int)sizeof(realT));
+      qh_memfree(qh, isoutsides, qh->num_facets * (int)sizeof(bool));
+    }
     if (maxdist > qh->outside_err) {
       qh_fprintf(qh, qh->ferr, 6112, "qhull precision error (qh_check_points): a coplanar point is %6.2g from convex hull.  The maximum value(qh.outside_err) is %6.2g\n",
                 maxdist, qh->outside_err );
@@ -497,9 +1089,86 @@ all %sfacets.  Will make %2.0f distance computations.\n",
     /* else if errfacet1, the error was logged to qh.ferr but does not effect the output */
     trace0((qh, qh->ferr, 21, "qh_check_points: max distance outside %2.2g\n", maxdist));
   }
+  qh_profilephase(qh, prevphase);
 } /* check_points */
 
 
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="check_pointtree">-</a>
+
+  qh_check_pointtree(qh, maxoutside, testouter, maxdists, isoutsides )
+    test all points against all facets with a bounding-box tree of the points
+    in parallel if 'QPn'
+
+  returns:
+    maxdists[i] is the maximum distance of a point above the i'th tested facet
+    isoutsides[i] is true if a point is above the i'th tested facet's maxoutside
+    counts Zdistplane
+
+  notes:
+    called by qh_check_points for the exhaustive check ('Tv')
+    tested facets are the facets of qh.facet_list that qh_check_points tests, in order
+      i.e., good facets if qh.ONLYgood, and not flipped with a normal
+    if testouter, maxoutside is facet->maxoutside + 2 * qh.DISTround
+    qh_check_points repeats the test for outside facets to report the points
+
+  design:
+    build a bounding-box tree of the points
+    collect the tested facets
+    for each thread in parallel
+      for its range of facets
+        test the points with qh_check_facetpoints
+    free the tree
+*/
+void qh_check_pointtree(qhT *qh, realT maxoutside, bool testouter, realT *maxdists, bool *isoutsides) {
+  pointtreeT *tree;
+  facetT *facet;
+  setT *facets;
+  int i, numthreads, chunk, numfacets, numdist= 0;
+  int *numdists;
+
+  tree= qh_pointtree_new(qh);
+  facets= qh_settemp(qh, qh->num_facets);
+  FORALLfacets {
+    if ((!facet->good && qh->ONLYgood) || facet->flipped || !facet->normal)
+      continue;
+    qh_setappend(qh, &facets, facet);
+  }
+  numfacets= qh_setsize(qh, facets);
+  numthreads= qh_parallelthreads(qh, numfacets);
+  chunk= (numfacets + numthreads - 1) / numthreads;
+  numdists= (int *)qh_memalloc(qh, numthreads * (int)sizeof(int));
+#if qh_PARALLEL
+#pragma omp parallel for num_threads(numthreads) schedule(static, 1)
+#endif
+  for (i=0; i < numthreads; i++) {
+    facetT *facetj;
+    realT facetmax;
+    int j, end;
+
+    numdists[i]= 0;
+    end= (i+1)*chunk;
+    minimize_(end, numfacets);
+    for (j= i*chunk; j < end; j++) {
+      facetj= SETelemt_(facets, j, facetT);
+      facetmax= maxoutside;
+#if qh_MAXoutside
+      if (testouter)
+        facetmax= facetj->maxoutside + 2 * qh->DISTround;
+#endif
+      maxdists[j]= qh_check_facetpoints(qh, tree, facetj, facetmax, &numdists[i], &isoutsides[j]);
+    }
+  }
+  for (i=0; i < numthreads; i++)
+    numdist += numdists[i];
+  zzadd_(Zdistplane, numdist);
+  trace1((qh, qh->ferr, 1071, "qh_check_pointtree: %d distance tests for %d facets and %d points with %d threads\n",
+      numdist, numfacets, tree->numpoints, numthreads));
+  qh_memfree(qh, numdists, numthreads * (int)sizeof(int));
+  qh_settempfree(qh, &facets);
+  qh_pointtree_free(qh, &tree);
+} /* check_pointtree */
+
 /*-<a                             href="qh-poly_r.htm#TOC"
   >-------------------------------</a><a name="checkconvex">-</a>
 
@@ -1470,6 +2139,22 @@ void qh_clearcenters(qhT *qh, qh_CENTER type) {
   trace2((qh, qh->ferr, 2043, "qh_clearcenters: switched to center type %d\n", type));
 } /* clearcenters */
 
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="compare_point2d">-</a>
+
+  qh_compare_point2d( p1, p2 )
+    used by qsort() to order 2-d points by x, y, and address
+*/
+int qh_compare_point2d(const void *p1, const void *p2) {
+  const pointT *a= *((pointT *const*)p1), *b= *((pointT *const*)p2);
+
+  if (a[0] != b[0])
+    return (a[0] < b[0] ? -1 : 1);
+  if (a[1] != b[1])
+    return (a[1] < b[1] ? -1 : 1);
+  return (a < b ? -1 : (a > b ? 1 : 0));
+} /* compare_point2d */
+
 /*-<a                             href="qh-poly_r.htm#TOC"
   >-------------------------------</a><a name="createsimplex">-</a>
 
@@ -1650,26 +2335,56 @@ setT *qh_facet3vertex(qhT *qh, facetT *facet) {
 facetT *qh_findbestfacet(qhT *qh, pointT *point, bool bestoutside,
            realT *bestdist, bool *isoutside) {
   facetT *bestfacet= NULL;
-  int numpart, totpart= 0;
+  int totpart= 0;
+
+  bestfacet= qh_findbestfacet_start(qh, point, qh->facet_list, bestoutside, bestdist, isoutside, &totpart);
+  trace3((qh, qh->ferr, 3014, "qh_findbestfacet: f%d dist %2.2g isoutside %d totpart %d\n",
+          bestfacet->id, *bestdist, (isoutside ? *isoutside : UINT_MAX), totpart));
+  return bestfacet;
+} /* findbestfacet */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="findbestfacet_start">-</a>
+
+  qh_findbestfacet_start(qh, point, startfacet, bestoutside, bestdist, isoutside, numpart )
+    find facet that is furthest below a point, starting at startfacet
+
+  returns:
+    see qh_findbestfacet
+    adds distance tests to numpart
+
+  notes:
+    called by qh_findbestfacet (qh.facet_list) and qh_locatefacet (qh.locate_grid)
+    uses qh.visit_id and qh.coplanarset
+
+  design:
+    search for the best facet from startfacet (qh_findbest)
+    if the point is inside
+      search all facets (qh_findfacet_all)
+      if outside and bestoutside, or inside an upperdelaunay facet
+        search for the best facet from the result
+*/
+facetT *qh_findbestfacet_start(qhT *qh, pointT *point, facetT *startfacet, bool bestoutside,
+           realT *bestdist, bool *isoutside, int *numpart) {
+  facetT *bestfacet= NULL;
+  int numpartall;
 
-  bestfacet= qh_findbest(qh, point, qh->facet_list,
+  bestfacet= qh_findbest(qh, point, startfacet,
                             bestoutside, !qh_ISnewfacets, bestoutside /* qh_NOupper */,
-                            bestdist, isoutside, &totpart);
+                            bestdist, isoutside, numpart);
   if (*bestdist < -qh->DISTround) {
-    bestfacet= qh_findfacet_all(qh, point, !qh_NOupper, bestdist, isoutside, &numpart);
-    totpart += numpart;
+    bestfacet= qh_findfacet_all(qh, point, !qh_NOupper, bestdist, isoutside, &numpartall);
+    *numpart += numpartall;
     if ((isoutside && *isoutside && bestoutside)
     || (isoutside && !*isoutside && bestfacet->upperdelaunay)) {
       bestfacet= qh_findbest(qh, point, bestfacet,
                             bestoutside, false, bestoutside,
-                            bestdist, isoutside, &totpart);
-      totpart += numpart;
+                            bestdist, isoutside, &numpartall);
+      *numpart += numpartall;
     }
   }
-  trace3((qh, qh->ferr, 3014, "qh_findbestfacet: f%d dist %2.2g isoutside %d totpart %d\n",
-          bestfacet->id, *bestdist, (isoutside ? *isoutside : UINT_MAX), totpart));
   return bestfacet;
-} /* findbestfacet */
+} /* findbestfacet_start */
 
 /*-<a                             href="qh-poly_r.htm#TOC"
   >-------------------------------</a><a name="findbestlower">-</a>
@@ -2068,65 +2783,893 @@ void qh_furthestout(qhT *qh, facetT *facet) {
 } /* furthestout */
 
 
-/*-<a                             href="qh-qhull_r.htm#TOC"
-  >-------------------------------</a><a name="infiniteloop">-</a>
-
-  qh_infiniteloop(qh, facet )
-    report infinite loop error due to facet
-*/
-void qh_infiniteloop(qhT *qh, facetT *facet) {
-
-  qh_fprintf(qh, qh->ferr, 6149, "qhull internal error (qh_infiniteloop): potential infinite loop detected.  If visible, f.replace. If newfacet, f.samecycle\n");
-  qh_errexit(qh, qh_ERRqhull, facet, NULL);
-} /* qh_infiniteloop */
-
 /*-<a                             href="qh-poly_r.htm#TOC"
-  >-------------------------------</a><a name="initbuild">-</a>
+  >-------------------------------</a><a name="hull3d_addpoint">-</a>
 
-  qh_initbuild()
-    initialize hull and outside sets with point array
-    qh.FIRSTpoint/qh.NUMpoints is point array
-    if qh.GOODpoint
-      adds qh.GOODpoint to initial hull
+  qh_hull3d_addpoint(qh, hull, face )
+    add the furthest outside point of face to the half-edge hull
 
   returns:
-    qh_facetlist with initial hull
-    points partioned into outside sets, coplanar sets, or inside
-    initializes qh.GOODpointp, qh.GOODvertexp,
+    false if a face is nearly coplanar with the point, a new face is degenerate or a sliver, or a new edge is not clearly convex
+      the hull is unchanged.  The point stays in the conflict list of face
+    otherwise the visible faces are on the free list and the new faces are in hull->newfaces
+      the points of the visible faces are partitioned into the new faces
 
   design:
-    initialize global variables used during qh_buildhull
-    determine precision constants and points with max/min coordinate values
-      if qh.SCALElast, scale last coordinate(for 'd')
-    initialize qh.newfacet_list, qh.facet_tail
-    initialize qh.vertex_list, qh.newvertex_list, qh.vertex_tail
-    determine initial vertices
-    build initial simplex
-    partition input points into facets of initial simplex
-    set up lists
-    if qh.ONLYgood
-      check consistency
-      add qh.GOODvertex if defined
+    find the visible faces and the horizon
+    create a new face for each horizon half-edge
+    test that the new edges are clearly convex
+    link the half-edges of the new faces
+    gather the points of the visible faces and delete the visible faces
+    partition the gathered points into the new faces
 */
-void qh_initbuild(qhT *qh) {
-  setT *maxpoints, *vertices;
-  facetT *facet;
-  int i, numpart;
-  realT dist;
-  bool isoutside;
+bool qh_hull3d_addpoint(qhT *qh, hull3dT *hull, int face) {
+  face3dT *newface, *nextface, *neighbor;
+  int apex, halfedge, twin, newfacet, nextfacet, i, k, numgather= 0;
 
-  if (qh->PRINTstatistics) {
-    qh_fprintf(qh, qh->ferr, 9350, "qhull %s Statistics: %s | %s\n",
-      qh_version, qh->rbox_command, qh->qhull_command);
-    fflush(NULL);
+  apex= hull->faces[face].furthest;
+  if (!qh_hull3d_horizon(qh, hull, apex, face))
+    return false;
+  for (i=0; i < hull->numhorizon; i++) {
+    halfedge= hull->horizon[i];
+    newfacet= qh_hull3d_newface(qh, hull, hull->faces[halfedge/3].vertices[halfedge%3],
+                  hull->faces[halfedge/3].vertices[(halfedge%3+1)%3], apex);
+    if (newfacet < 0) {
+      trace2((qh, qh->ferr, 2124, "qh_hull3d_addpoint: new face for p%d and horizon edge %d is degenerate or a sliver\n",
+        apex, halfedge));
+      while (i--)
+        qh_hull3d_delface(hull, hull->newfaces[i]);
+      return false;
+    }
+    hull->newfaces[i]= newfacet;
   }
-  qh->furthest_id= qh_IDunknown;
-  qh->lastreport= 0;
-  qh->lastfacets= 0;
-  qh->lastmerges= 0;
-  qh->lastplanes= 0;
-  qh->lastdist= 0;
-  qh->facet_id= qh->vertex_id= qh->ridge_id= 0;
+  for (i=0; i < hull->numhorizon; i++) {
+    halfedge= hull->horizon[i];
+    newface= &hull->faces[hull->newfaces[i]];
+    nextface= &hull->faces[hull->newfaces[(i+1)%hull->numhorizon]];
+    twin= hull->faces[halfedge/3].twins[halfedge%3];
+    neighbor= &hull->faces[twin/3];
+    if (qh_hull3d_dist(hull, neighbor->vertices[(twin%3+2)%3], newface) >= -hull->tolconvex
+    || qh_hull3d_dist(hull, nextface->vertices[1], newface) >= -hull->tolconvex
+    || qh_hull3d_dist(hull, newface->vertices[0], nextface) >= -hull->tolconvex) {
+      trace2((qh, qh->ferr, 2125, "qh_hull3d_addpoint: an edge of the new face for p%d and horizon edge %d is not clearly convex\n",
+        apex, halfedge));
+      for (i=0; i < hull->numhorizon; i++)
+        qh_hull3d_delface(hull, hull->newfaces[i]);
+      return false;
+    }
+  }
+  for (i=0; i < hull->numhorizon; i++) {
+    halfedge= hull->horizon[i];
+    newfacet= hull->newfaces[i];
+    nextfacet= hull->newfaces[(i+1)%hull->numhorizon];
+    twin= hull->faces[halfedge/3].twins[halfedge%3];
+    hull->faces[newfacet].twins[0]= twin;
+    hull->faces[twin/3].twins[twin%3]= 3*newfacet;
+    hull->faces[newfacet].twins[1]= 3*nextfacet + 2;
+    hull->faces[nextfacet].twins[2]= 3*newfacet + 1;
+  }
+  for (i=0; i < hull->numvisible; i++) {
+    newface= &hull->faces[hull->visible[i]];
+    numgather += newface->numoutside + newface->numnear;
+  }
+  if (numgather > hull->maxgather)
+    qh_hull3d_growgather(qh, hull, numgather);
+  numgather= 0;
+  for (i=0; i < hull->numvisible; i++) {
+    newface= &hull->faces[hull->visible[i]];
+    for (k=newface->start; k < newface->start + newface->numoutside + newface->numnear; k++) {
+      if (hull->points[k].id != apex)
+        hull->gather[numgather++]= hull->points[k];
+    }
+    hull->livepoints -= newface->numoutside + newface->numnear;
+    qh_hull3d_delface(hull, hull->visible[i]);
+  }
+  qh_hull3d_partition(qh, hull, numgather, (hull->keepnear ? hull->numhorizon : 0));
+  hull->numapex++;
+  return true;
+} /* hull3d_addpoint */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="hull3d_delface">-</a>
+
+  qh_hull3d_delface( hull, face )
+    delete face and add it to the free list of hull->faces
+    the caller accounts for its conflict list in hull->livepoints
+*/
+void qh_hull3d_delface(hull3dT *hull, int face) {
+  face3dT *deleted= &hull->faces[face];
+
+  deleted->numoutside= deleted->numnear= 0;
+  deleted->deleted= true;
+  deleted->start= hull->freeface;
+  hull->freeface= face;
+} /* hull3d_delface */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="hull3d_dist">-</a>
+
+  qh_hull3d_dist( hull, id, face )
+    return the distance of point id above face
+*/
+realT qh_hull3d_dist(hull3dT *hull, int id, face3dT *face) {
+  coordT *point= hull->coords + 3 * id;
+
+  return face->normal[0] * point[0] + face->normal[1] * point[1] + face->normal[2] * point[2] + face->offset;
+} /* hull3d_dist */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="hull3d_free">-</a>
+
+  qh_hull3d_free(qh, hull )
+    free a half-edge hull from qh_hull3d_new
+*/
+void qh_hull3d_free(qhT *qh, hull3dT *hull) {
+
+  qh_memfree(qh, hull->faces, hull->maxfaces * (int)sizeof(face3dT));
+  qh_memfree(qh, hull->points, hull->maxpoints * (int)sizeof(conflict3dT));
+  qh_memfree(qh, hull->pending, hull->maxpending * (int)sizeof(int));
+  qh_memfree(qh, hull->visible, hull->maxcone * (int)sizeof(int));
+  qh_memfree(qh, hull->frames, 3 * hull->maxcone * (int)sizeof(int));
+  qh_memfree(qh, hull->horizon, hull->maxcone * (int)sizeof(int));
+  qh_memfree(qh, hull->newfaces, hull->maxcone * (int)sizeof(int));
+  qh_memfree(qh, hull->conex, 2 * hull->maxplanes * (int)sizeof(coordT));
+  qh_memfree(qh, hull->coney, 2 * hull->maxplanes * (int)sizeof(coordT));
+  qh_memfree(qh, hull->conez, 2 * hull->maxplanes * (int)sizeof(coordT));
+  qh_memfree(qh, hull->coneoffset, 2 * hull->maxplanes * (int)sizeof(coordT));
+  qh_memfree(qh, hull->conedists, 2 * hull->maxplanes * (int)sizeof(realT));
+  qh_memfree(qh, hull->counts, 2 * hull->maxplanes * (int)sizeof(int));
+  qh_memfree(qh, hull->gather, hull->maxgather * (int)sizeof(conflict3dT));
+  qh_memfree(qh, hull->assign, hull->maxgather * (int)sizeof(int));
+  qh_memfree(qh, hull->gatherdists, hull->maxgather * (int)sizeof(realT));
+  qh_memfree(qh, hull, (int)sizeof(hull3dT));
+} /* hull3d_free */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="hull3d_growcone">-</a>
+
+  qh_hull3d_growcone(qh, hull, numframes )
+    double the allocation of hull->visible, frames, horizon, and newfaces
+    keeps hull->numvisible, numframes, and numhorizon entries
+*/
+void qh_hull3d_growcone(qhT *qh, hull3dT *hull, int numframes) {
+  int maxcone= 2 * hull->maxcone;
+
+  hull->visible= (int *)qh_hull3d_realloc(qh, hull->visible, hull->maxcone * (int)sizeof(int), maxcone * (int)sizeof(int), hull->numvisible * (int)sizeof(int));
+  hull->frames= (int *)qh_hull3d_realloc(qh, hull->frames, 3 * hull->maxcone * (int)sizeof(int), 3 * maxcone * (int)sizeof(int), 3 * numframes * (int)sizeof(int));
+  hull->horizon= (int *)qh_hull3d_realloc(qh, hull->horizon, hull->maxcone * (int)sizeof(int), maxcone * (int)sizeof(int), hull->numhorizon * (int)sizeof(int));
+  hull->newfaces= (int *)qh_hull3d_realloc(qh, hull->newfaces, hull->maxcone * (int)sizeof(int), maxcone * (int)sizeof(int), 0);
+  hull->maxcone= maxcone;
+} /* hull3d_growcone */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="hull3d_growgather">-</a>
+
+  qh_hull3d_growgather(qh, hull, numgather )
+    allocate hull->gather, assign, and gatherdists for at least numgather points
+    the previous entries are lost
+*/
+void qh_hull3d_growgather(qhT *qh, hull3dT *hull, int numgather) {
+  int maxgather= 2 * numgather;
+
+  hull->gather= (conflict3dT *)qh_hull3d_realloc(qh, hull->gather, hull->maxgather * (int)sizeof(conflict3dT), maxgather * (int)sizeof(conflict3dT), 0);
+  hull->assign= (int *)qh_hull3d_realloc(qh, hull->assign, hull->maxgather * (int)sizeof(int), maxgather * (int)sizeof(int), 0);
+  hull->gatherdists= (realT *)qh_hull3d_realloc(qh, hull->gatherdists, hull->maxgather * (int)sizeof(realT), maxgather * (int)sizeof(realT), 0);
+  hull->maxgather= maxgather;
+} /* hull3d_growgather */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="hull3d_horizon">-</a>
+
+  qh_hull3d_horizon(qh, hull, apex, face )
+    find the faces visible from point apex, starting at face
+
+  returns:
+    false if a neighbor of a visible face is nearly coplanar with apex or the horizon is not a cycle
+    otherwise hull->visible is the visible faces with f.visitid == hull->visit_id
+      hull->horizon is the half-edges of the visible faces to the horizon, in counter-clockwise order
+
+  design:
+    depth-first search of the visible faces across their half-edges
+      a frame is a face, its next half-edge, and the number of half-edges to test
+      the search enters a face through a half-edge and tests its other two half-edges
+    a face is visible if apex is more than hull->tolout above it
+    a face is on the horizon if apex is clearly below it
+*/
+bool qh_hull3d_horizon(qhT *qh, hull3dT *hull, int apex, int face) {
+  face3dT *neighbor;
+  realT dist, tolhorizon;
+  int *frame, top, halfedge, twin, next, i;
+
+  tolhorizon= fmax_(hull->tolout, hull->tolconvex);
+  hull->visit_id++;
+  hull->numvisible= hull->numhorizon= 0;
+  hull->faces[face].visitid= hull->visit_id;
+  hull->visible[hull->numvisible++]= face;
+  top= 0;
+  hull->frames[0]= face;
+  hull->frames[1]= 0;
+  hull->frames[2]= 3;
+  while (top >= 0) {
+    frame= hull->frames + 3 * top;
+    if (frame[2] == 0) {
+      top--;
+      continue;
+    }
+    halfedge= 3 * frame[0] + frame[1];
+    frame[1]= (frame[1] + 1) % 3;
+    frame[2]--;
+    twin= hull->faces[halfedge/3].twins[halfedge%3];
+    neighbor= &hull->faces[twin/3];
+    if (neighbor->visitid == hull->visit_id)
+      continue;
+    dist= qh_hull3d_dist(hull, apex, neighbor);
+    if (dist > hull->tolout) {
+      if (hull->numvisible >= hull->maxcone || top+1 >= hull->maxcone)
+        qh_hull3d_growcone(qh, hull, top+1);
+      neighbor->visitid= hull->visit_id;
+      hull->visible[hull->numvisible++]= twin/3;
+      top++;
+      frame= hull->frames + 3 * top;
+      frame[0]= twin/3;
+      frame[1]= (twin%3 + 1) % 3;
+      frame[2]= 2;
+    }else if (dist < -tolhorizon) {
+      if (hull->numhorizon >= hull->maxcone)
+        qh_hull3d_growcone(qh, hull, top+1);
+      hull->horizon[hull->numhorizon++]= halfedge;
+    }else {
+      trace2((qh, qh->ferr, 2126, "qh_hull3d_horizon: p%d is nearly coplanar (%2.2g) with a face of the hull\n",
+        apex, dist));
+      return false;
+    }
+  }
+  for (i=0; i < hull->numhorizon; i++) {
+    halfedge= hull->horizon[i];
+    next= hull->horizon[(i+1)%hull->numhorizon];
+    if (hull->faces[halfedge/3].vertices[(halfedge%3+1)%3] != hull->faces[next/3].vertices[next%3]) {
+      trace2((qh, qh->ferr, 2127, "qh_hull3d_horizon: the horizon of p%d is not a cycle of %d half-edges\n",
+        apex, hull->numhorizon));
+      return false;
+    }
+  }
+  return (hull->numhorizon >= 3);
+} /* hull3d_horizon */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="hull3d_makefacets">-</a>
+
+  qh_hull3d_makefacets(qh, hull )
+    create qhull's vertices and facets for the faces of a half-edge hull
+
+  returns:
+    true if qh.facet_list is the simplicial facets (new facets and new vertices) and sets qh.interior_point
+      the points of the conflict lists are in outside sets or coplanar sets as for qh_partitionall
+    false if a facet is flipped or a ridge is not clearly convex by hull->tolconvex for qhull's hyperplanes
+      deletes the new facets, new vertices, and qh.interior_point
+
+  notes:
+    each facet's vertices are inverse sorted by vertex->id, and f.neighbors[i] is opposite f.vertices[i]
+    the vertex order is an odd permutation of the counter-clockwise vertices if f.toporient
+      (qh_sethyperplane_det computes the normal as (v2-v0) x (v1-v0) for toporient)
+    a sliver face (e.g., two points 1e-10 apart) may pass the tests of qh_hull3d_addpoint with an
+      inaccurate cross product.  qh_setfacetplane may find the ridge concave, e.g., 'rbox 2000 s D3 C1,1e-10'
+
+  design:
+    set qh.interior_point to the centroid of the initial simplex
+    create a vertex for each vertex of the faces and a facet for each face
+    set the vertices and neighbors of each facet
+    set the hyperplane of each facet
+    if a facet is flipped or a vertex is not clearly below its opposite neighbor
+      delete the new facets and vertices and return false
+    test for a narrow hull
+    partition the outside and near points of each face starting from its facet
+*/
+bool qh_hull3d_makefacets(qhT *qh, hull3dT *hull) {
+  face3dT *face;
+  facetT **facetmap, *facet, *neighbor, **neighborp;
+  vertexT **vertexmap, *vertex;
+  realT angle, dist, minangle= REALmax;
+  int order[3], f, i, k, m, temp, neighbor_i, neighbor_n, numvertices= 0, numfacets= 0, numpart= 0;
+  bool isodd, isconvex= true;
+
+  qh->interior_point= (pointT *)qh_memalloc(qh, qh->normal_size);
+  for (k=0; k < 3; k++) {
+    qh->interior_point[k]= 0.0;
+    for (i=0; i < 4; i++)
+      qh->interior_point[k] += hull->coords[3 * hull->tetra[i] + k] / 4.0;
+  }
+  vertexmap= (vertexT **)qh_memalloc(qh, qh->num_points * (int)sizeof(vertexT *));
+  memset((char *)vertexmap, 0, (size_t)qh->num_points * sizeof(vertexT *));
+  facetmap= (facetT **)qh_memalloc(qh, hull->numfaces * (int)sizeof(facetT *));
+  for (f=0; f < hull->numfaces; f++) {
+    face= &hull->faces[f];
+    facetmap[f]= NULL;
+    if (face->deleted)
+      continue;
+    for (k=0; k < 3; k++) {
+      if (!vertexmap[face->vertices[k]]) {
+        vertexmap[face->vertices[k]]= qh_newvertex(qh, hull->coords + 3 * face->vertices[k]);
+        qh_appendvertex(qh, vertexmap[face->vertices[k]]);
+        numvertices++;
+      }
+    }
+    facetmap[f]= qh_newfacet(qh);
+    qh_appendfacet(qh, facetmap[f]);
+    numfacets++;
+  }
+  for (f=0; f < hull->numfaces; f++) {
+    if (!(facet= facetmap[f]))
+      continue;
+    face= &hull->faces[f];
+    order[0]= 0;
+    order[1]= 1;
+    order[2]= 2;
+    isodd= false;
+    for (i=0; i < 2; i++) {  /* sort by decreasing vertex id */
+      for (k=0; k < 2-i; k++) {
+        if (vertexmap[face->vertices[order[k]]]->id < vertexmap[face->vertices[order[k+1]]]->id) {
+          temp= order[k];
+          order[k]= order[k+1];
+          order[k+1]= temp;
+          isodd= !isodd;
+        }
+      }
+    }
+    facet->toporient= (unsigned char)isodd;
+    facet->vertices= qh_setnew(qh, qh->hull_dim);
+    for (k=0; k < 3; k++) {
+      m= order[k];
+      qh_setappend(qh, &facet->vertices, vertexmap[face->vertices[m]]);
+      qh_setappend(qh, &facet->neighbors, facetmap[face->twins[(m+1)%3]/3]);  /* the half-edge opposite vertex m */
+    }
+  }
+  for (f=0; f < hull->numfaces; f++) {
+    if ((facet= facetmap[f]))
+      qh_setfacetplane(qh, facet);
+  }
+  for (f=0; f < hull->numfaces && isconvex; f++) {
+    if (!(facet= facetmap[f]))
+      continue;
+    if (facet->flipped) {
+      trace1((qh, qh->ferr, 1079, "qh_hull3d_makefacets: f%d is flipped.  Use qh_initialhull\n", facet->id));
+      isconvex= false;
+      break;
+    }
+    FOREACHneighbor_i_(qh, facet) {
+      vertex= SETelemt_(facet->vertices, neighbor_i, vertexT);
+      qh_distplane(qh, vertex->point, neighbor, &dist);
+      if (dist >= -hull->tolconvex) {
+        trace1((qh, qh->ferr, 1080, "qh_hull3d_makefacets: p%d of f%d is not clearly below f%d (dist %2.2g).  Use qh_initialhull\n",
+          qh_pointid(qh, vertex->point), facet->id, neighbor->id, dist));
+        isconvex= false;
+        break;
+      }
+    }
+  }
+  if (!isconvex) {
+    while (qh->facet_list != qh->facet_tail)
+      qh_delfacet(qh, qh->facet_list);
+    while (qh->vertex_list != qh->vertex_tail)
+      qh_delvertex(qh, qh->vertex_list);
+    qh_memfree(qh, qh->interior_point, qh->normal_size);
+    qh->interior_point= NULL;
+    qh_memfree(qh, facetmap, hull->numfaces * (int)sizeof(facetT *));
+    qh_memfree(qh, vertexmap, qh->num_points * (int)sizeof(vertexT *));
+    return false;
+  }
+  for (f=0; f < hull->numfaces; f++) {
+    if (!(facet= facetmap[f]))
+      continue;
+    FOREACHneighbor_(facet) {
+      if (neighbor->id > facet->id) {
+        angle= qh_getangle(qh, facet->normal, neighbor->normal);
+        minimize_(minangle, angle);
+      }
+    }
+  }
+  if (minangle < qh_MAXnarrow && !qh->NOnarrow) {  /* as for qh_initialhull */
+    realT diff= 1.0 + minangle;
+
+    qh->NARROWhull= true;
+    qh_option(qh, "_narrow-hull", NULL, &diff);
+    if (minangle < qh_WARNnarrow && !qh->RERUN && qh->PRINTprecision)
+      qh_printhelp_narrowhull(qh, qh->ferr, minangle);
+  }
+  zzval_(Zprocessed)= numvertices;
+  qh->facet_next= qh->facet_list;  /* as for qh_initialhull */
+  qh->findbest_notsharp= true;  /* the hull is not a cone of new facets, qh_findbest's directed search suffices */
+  for (f=0; f < hull->numfaces; f++) {
+    if (!(facet= facetmap[f]))
+      continue;
+    face= &hull->faces[f];
+    for (k=face->start; k < face->start + face->numoutside + face->numnear; k++) {
+      qh_partitionpoint(qh, hull->coords + 3 * hull->points[k].id, facet);
+      numpart++;
+    }
+  }
+  qh->findbest_notsharp= false;
+  zzadd_(Zpartitionall, zzval_(Zpartition));
+  zzval_(Zpartition)= 0;
+  trace1((qh, qh->ferr, 1076, "qh_hull3d_makefacets: created %d vertices and %d facets for %d points.  Partitioned %d points with %d outside\n",
+    numvertices, numfacets, qh->num_points, numpart, qh->num_outside));
+  qh_memfree(qh, facetmap, hull->numfaces * (int)sizeof(facetT *));
+  qh_memfree(qh, vertexmap, qh->num_points * (int)sizeof(vertexT *));
+  return true;
+} /* hull3d_makefacets */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="hull3d_new">-</a>
+
+  qh_hull3d_new(qh, points, numpoints )
+    allocate an empty half-edge hull for numpoints 3-d points
+
+  returns:
+    hull3dT from qh_memalloc.  Free with qh_hull3d_free
+    hull->points and hull->gather hold numpoints, for partitioning the initial simplex
+*/
+hull3dT *qh_hull3d_new(qhT *qh, pointT *points, int numpoints) {
+  hull3dT *hull;
+
+  hull= (hull3dT *)qh_memalloc(qh, (int)sizeof(hull3dT));
+  memset((char *)hull, 0, sizeof(hull3dT));
+  hull->coords= points;
+  hull->maxfaces= 64;
+  hull->faces= (face3dT *)qh_memalloc(qh, hull->maxfaces * (int)sizeof(face3dT));
+  hull->freeface= -1;
+  hull->maxpoints= numpoints + 64;
+  hull->points= (conflict3dT *)qh_memalloc(qh, hull->maxpoints * (int)sizeof(conflict3dT));
+  hull->maxpending= 64;
+  hull->pending= (int *)qh_memalloc(qh, hull->maxpending * (int)sizeof(int));
+  hull->maxcone= 64;
+  hull->visible= (int *)qh_memalloc(qh, hull->maxcone * (int)sizeof(int));
+  hull->frames= (int *)qh_memalloc(qh, 3 * hull->maxcone * (int)sizeof(int));
+  hull->horizon= (int *)qh_memalloc(qh, hull->maxcone * (int)sizeof(int));
+  hull->newfaces= (int *)qh_memalloc(qh, hull->maxcone * (int)sizeof(int));
+  hull->maxplanes= 64;
+  hull->conex= (coordT *)qh_memalloc(qh, 2 * hull->maxplanes * (int)sizeof(coordT));
+  hull->coney= (coordT *)qh_memalloc(qh, 2 * hull->maxplanes * (int)sizeof(coordT));
+  hull->conez= (coordT *)qh_memalloc(qh, 2 * hull->maxplanes * (int)sizeof(coordT));
+  hull->coneoffset= (coordT *)qh_memalloc(qh, 2 * hull->maxplanes * (int)sizeof(coordT));
+  hull->conedists= (realT *)qh_memalloc(qh, 2 * hull->maxplanes * (int)sizeof(realT));
+  hull->counts= (int *)qh_memalloc(qh, 2 * hull->maxplanes * (int)sizeof(int));
+  hull->maxgather= numpoints + 64;
+  hull->gather= (conflict3dT *)qh_memalloc(qh, hull->maxgather * (int)sizeof(conflict3dT));
+  hull->assign= (int *)qh_memalloc(qh, hull->maxgather * (int)sizeof(int));
+  hull->gatherdists= (realT *)qh_memalloc(qh, hull->maxgather * (int)sizeof(realT));
+  return hull;
+} /* hull3d_new */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="hull3d_newface">-</a>
+
+  qh_hull3d_newface(qh, hull, a, b, c )
+    create a face for point ids a, b, c in counter-clockwise order from outside
+
+  returns:
+    index of the new face, with its unit normal and offset, and no twins or points
+    -1 if the face is degenerate, with a height <= qh.DISTround
+    -1 if the face is a sliver with an inaccurate hyperplane (qh_HULL3Dsliver)
+    may reallocate hull->faces
+
+  notes:
+    reuses a deleted face from a previous qh_hull3d_addpoint
+*/
+int qh_hull3d_newface(qhT *qh, hull3dT *hull, int a, int b, int c) {
+  face3dT *face;
+  coordT *pointA, *pointB, *pointC, ab[3], ac[3], normal[3];
+  realT norm, len, maxlen;
+  int f, k;
+
+  pointA= hull->coords + 3 * a;
+  pointB= hull->coords + 3 * b;
+  pointC= hull->coords + 3 * c;
+  for (k=0; k < 3; k++) {
+    ab[k]= pointB[k] - pointA[k];
+    ac[k]= pointC[k] - pointA[k];
+  }
+  qh_crossproduct(3, ab, ac, normal);
+  norm= sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+  maxlen= qh_pointdist(pointA, pointB, 3);
+  len= qh_pointdist(pointA, pointC, 3);
+  maximize_(maxlen, len);
+  len= qh_pointdist(pointB, pointC, 3);
+  maximize_(maxlen, len);
+  if (norm <= maxlen * qh->DISTround)  /* the minimum height is norm/maxlen */
+    return -1;
+  if (1.8 * REALepsilon * fmax_(maxlen, qh->MAXabs_coord) * maxlen * maxlen > qh_HULL3Dsliver * hull->tolconvex * norm)
+    return -1;  /* the distance error of its vertices, as for the 3-d minnorm of qh_sethyperplane_det */
+  if (hull->freeface >= 0) {
+    f= hull->freeface;
+    hull->freeface= hull->faces[f].start;
+  }else {
+    if (hull->numfaces >= hull->maxfaces) {
+      hull->faces= (face3dT *)qh_hull3d_realloc(qh, hull->faces, hull->maxfaces * (int)sizeof(face3dT), 2 * hull->maxfaces * (int)sizeof(face3dT), hull->numfaces * (int)sizeof(face3dT));
+      hull->maxfaces *= 2;
+    }
+    f= hull->numfaces++;
+  }
+  face= &hull->faces[f];
+  face->vertices[0]= a;
+  face->vertices[1]= b;
+  face->vertices[2]= c;
+  face->twins[0]= face->twins[1]= face->twins[2]= -1;
+  for (k=0; k < 3; k++)
+    face->normal[k]= normal[k] / norm;
+  face->offset= -(face->normal[0] * (pointA[0] + pointB[0] + pointC[0])
+                 + face->normal[1] * (pointA[1] + pointB[1] + pointC[1])
+                 + face->normal[2] * (pointA[2] + pointB[2] + pointC[2])) / 3.0;
+  face->start= 0;
+  face->numoutside= face->numnear= 0;
+  face->furthest= -1;
+  face->furthestdist= 0.0;
+  face->visitid= 0;
+  face->deleted= false;
+  return f;
+} /* hull3d_newface */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="hull3d_partition">-</a>
+
+  qh_hull3d_partition(qh, hull, numgather, numhorizon )
+    partition the points of hull->gather into the conflict lists of hull->newfaces
+    if numhorizon, the near test includes the horizon faces of the new faces (hull->keepnear)
+
+  returns:
+    each new face has its outside points followed by its near points at the end of hull->points
+    pushes the new faces with outside points onto hull->pending
+
+  notes:
+    a point is outside the new face furthest above it, if more than hull->tolout
+    otherwise it is near if it is at least -hull->margin from a new face or a horizon face
+      a near point is assigned to the new face furthest above it.  qh_partitionpoint searches from this face
+    otherwise the point is inside the hull and dropped
+    without 'Qc' or near-inside points, a point below the new faces is dropped.  It is below
+      the hull, and qh_partitionpoint would drop it unless it is above qh.max_outside
+    the distance loop over the planes of the cone (hull->conex..coneoffset) vectorizes
+
+  design:
+    copy the planes of the new faces and the horizon faces into arrays of coordinates
+    for each gathered point
+      compute its distance to each plane
+      assign it to the best new face as an outside point, a near point, or drop it
+    reserve space for the new conflict lists and fill them by counting sort
+*/
+void qh_hull3d_partition(qhT *qh, hull3dT *hull, int numgather, int numhorizon) {
+  face3dT *face;
+  coordT *conex, *coney, *conez, *coneoffset, *point;
+  realT *conedists, bestdist, maxdist;
+  int numnew= hull->numhorizon, numplanes, numkeep= 0, i, j, best, code;
+
+  numplanes= numnew + numhorizon;
+  if (numnew > hull->maxplanes) {
+    hull->conex= (coordT *)qh_hull3d_realloc(qh, hull->conex, 2 * hull->maxplanes * (int)sizeof(coordT), 4 * numnew * (int)sizeof(coordT), 0);
+    hull->coney= (coordT *)qh_hull3d_realloc(qh, hull->coney, 2 * hull->maxplanes * (int)sizeof(coordT), 4 * numnew * (int)sizeof(coordT), 0);
+    hull->conez= (coordT *)qh_hull3d_realloc(qh, hull->conez, 2 * hull->maxplanes * (int)sizeof(coordT), 4 * numnew * (int)sizeof(coordT), 0);
+    hull->coneoffset= (coordT *)qh_hull3d_realloc(qh, hull->coneoffset, 2 * hull->maxplanes * (int)sizeof(coordT), 4 * numnew * (int)sizeof(coordT), 0);
+    hull->conedists= (realT *)qh_hull3d_realloc(qh, hull->conedists, 2 * hull->maxplanes * (int)sizeof(realT), 4 * numnew * (int)sizeof(realT), 0);
+    hull->counts= (int *)qh_hull3d_realloc(qh, hull->counts, 2 * hull->maxplanes * (int)sizeof(int), 4 * numnew * (int)sizeof(int), 0);
+    hull->maxplanes= 2 * numnew;
+  }
+  conex= hull->conex;
+  coney= hull->coney;
+  conez= hull->conez;
+  coneoffset= hull->coneoffset;
+  conedists= hull->conedists;
+  for (j=0; j < numplanes; j++) {
+    if (j < numnew)
+      face= &hull->faces[hull->newfaces[j]];
+    else
+      face= &hull->faces[hull->faces[hull->newfaces[j-numnew]].twins[0]/3];
+    conex[j]= face->normal[0];
+    coney[j]= face->normal[1];
+    conez[j]= face->normal[2];
+    coneoffset[j]= face->offset;
+  }
+  for (j=0; j < 2*numnew; j++)
+    hull->counts[j]= 0;
+  for (i=0; i < numgather; i++) {
+    point= hull->gather[i].point;
+    for (j=0; j < numplanes; j++)
+      conedists[j]= conex[j] * point[0] + coney[j] * point[1] + conez[j] * point[2] + coneoffset[j];
+    best= 0;
+    for (j=1; j < numnew; j++) {
+      if (conedists[j] > conedists[best])
+        best= j;
+    }
+    bestdist= conedists[best];
+    if (bestdist > hull->tolout)
+      code= 2 * best;
+    else {
+      maxdist= bestdist;
+      for (j=numnew; j < numplanes; j++)
+        maximize_(maxdist, conedists[j]);
+      code= (maxdist >= -hull->margin ? 2 * best + 1 : -1);
+    }
+    hull->assign[i]= code;
+    hull->gatherdists[i]= bestdist;
+    if (code >= 0) {
+      hull->counts[code]++;
+      numkeep++;
+    }
+  }
+  qh_hull3d_reserve(qh, hull, numkeep);
+  for (j=0; j < numnew; j++) {
+    face= &hull->faces[hull->newfaces[j]];
+    face->start= hull->numpoints;
+    face->numoutside= hull->counts[2*j];
+    face->numnear= hull->counts[2*j+1];
+    hull->counts[2*j]= face->start;  /* next outside point */
+    hull->counts[2*j+1]= face->start + face->numoutside;  /* next near point */
+    hull->numpoints += face->numoutside + face->numnear;
+  }
+  hull->livepoints += numkeep;
+  for (i=0; i < numgather; i++) {
+    if ((code= hull->assign[i]) < 0)
+      continue;
+    hull->points[hull->counts[code]++]= hull->gather[i];
+    if (!(code & 1)) {
+      face= &hull->faces[hull->newfaces[code/2]];
+      if (face->furthest < 0 || hull->gatherdists[i] > face->furthestdist) {
+        face->furthest= hull->gather[i].id;
+        face->furthestdist= hull->gatherdists[i];
+      }
+    }
+  }
+  for (j=0; j < numnew; j++) {
+    if (hull->faces[hull->newfaces[j]].numoutside) {
+      if (hull->numpending >= hull->maxpending) {
+        hull->pending= (int *)qh_hull3d_realloc(qh, hull->pending, hull->maxpending * (int)sizeof(int), 2 * hull->maxpending * (int)sizeof(int), hull->numpending * (int)sizeof(int));
+        hull->maxpending *= 2;
+      }
+      hull->pending[hull->numpending++]= hull->newfaces[j];
+    }
+  }
+} /* hull3d_partition */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="hull3d_realloc">-</a>
+
+  qh_hull3d_realloc(qh, array, oldsize, newsize, copysize )
+    reallocate array from oldsize to newsize bytes with qh_memalloc, and copy the first copysize bytes
+*/
+void *qh_hull3d_realloc(qhT *qh, void *array, int oldsize, int newsize, int copysize) {
+  void *newarray;
+
+  newarray= qh_memalloc(qh, newsize);
+  if (copysize)
+    memcpy((char *)newarray, (char *)array, (size_t)copysize);
+  qh_memfree(qh, array, oldsize);
+  return newarray;
+} /* hull3d_realloc */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="hull3d_reserve">-</a>
+
+  qh_hull3d_reserve(qh, hull, numpoints )
+    reserve space for numpoints more points at the end of hull->points
+
+  notes:
+    if needed, copies the conflict lists of the faces into a new pool with twice the live points
+    deleted faces and the new faces of qh_hull3d_partition have empty conflict lists
+*/
+void qh_hull3d_reserve(qhT *qh, hull3dT *hull, int numpoints) {
+  face3dT *face;
+  conflict3dT *points;
+  int maxpoints, size, f, count= 0;
+
+  if (hull->numpoints + numpoints <= hull->maxpoints)
+    return;
+  maxpoints= 2 * (hull->livepoints + numpoints) + 64;
+  points= (conflict3dT *)qh_memalloc(qh, maxpoints * (int)sizeof(conflict3dT));
+  for (f=0; f < hull->numfaces; f++) {
+    face= &hull->faces[f];
+    if (face->deleted || !(size= face->numoutside + face->numnear))
+      continue;
+    memcpy((char *)(points + count), (char *)(hull->points + face->start), (size_t)size * sizeof(conflict3dT));
+    face->start= count;
+    count += size;
+  }
+  qh_memfree(qh, hull->points, hull->maxpoints * (int)sizeof(conflict3dT));
+  trace4((qh, qh->ferr, 4098, "qh_hull3d_reserve: compacted %d points of the conflict lists into %d\n",
+    count, maxpoints));
+  hull->points= points;
+  hull->numpoints= count;
+  hull->maxpoints= maxpoints;
+} /* hull3d_reserve */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="hull3d_simplex">-</a>
+
+  qh_hull3d_simplex(qh, hull, numpoints )
+    create the initial simplex of a half-edge hull and partition the points
+
+  returns:
+    false if the simplex is nearly flat, with an inradius <= qh.WIDEfacet + 2*qh.DISTround
+    otherwise hull->tetra is the simplex, hull->faces is its four faces, and the points are partitioned
+
+  design:
+    select the two furthest points of the extreme points for each coordinate
+    select the point furthest from their line, and the point furthest from the plane of the three points
+    orient the simplex so that the fourth point is below the first face
+    create the faces and link their half-edges
+    partition the other points into the faces
+*/
+bool qh_hull3d_simplex(qhT *qh, hull3dT *hull, int numpoints) {
+  coordT *coords= hull->coords, *point, *pointA, *pointB, *pointC, ab[3], ac[3], vec[3], normal[3];
+  face3dT *face, *other;
+  realT dist, maxdist, volume, area= 0.0;
+  int extremes[6], tetra[4]= {0, 0, 0, 0}, faces[4][3], i, j, k, e, numgather= 0;
+
+  for (k=0; k < 6; k++)
+    extremes[k]= 0;
+  for (i=1, point=coords+3; i < numpoints; i++, point += 3) {
+    for (k=0; k < 3; k++) {
+      if (point[k] < coords[3 * extremes[2*k] + k])
+        extremes[2*k]= i;
+      if (point[k] > coords[3 * extremes[2*k+1] + k])
+        extremes[2*k+1]= i;
+    }
+  }
+  maxdist= -1.0;
+  for (i=0; i < 6; i++) {
+    for (j=i+1; j < 6; j++) {
+      dist= qh_pointdist(coords + 3 * extremes[i], coords + 3 * extremes[j], 3);
+      if (dist > maxdist) {
+        maxdist= dist;
+        tetra[0]= extremes[i];
+        tetra[1]= extremes[j];
+      }
+    }
+  }
+  pointA= coords + 3 * tetra[0];
+  pointB= coords + 3 * tetra[1];
+  for (k=0; k < 3; k++)
+    ab[k]= pointB[k] - pointA[k];
+  maxdist= -1.0;
+  for (i=0, point=coords; i < numpoints; i++, point += 3) {
+    for (k=0; k < 3; k++)
+      vec[k]= point[k] - pointA[k];
+    qh_crossproduct(3, ab, vec, normal);
+    dist= normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2];
+    if (dist > maxdist) {
+      maxdist= dist;
+      tetra[2]= i;
+    }
+  }
+  pointC= coords + 3 * tetra[2];
+  for (k=0; k < 3; k++)
+    ac[k]= pointC[k] - pointA[k];
+  qh_crossproduct(3, ab, ac, normal);
+  maxdist= -1.0;
+  for (i=0, point=coords; i < numpoints; i++, point += 3) {
+    dist= normal[0] * (point[0] - pointA[0]) + normal[1] * (point[1] - pointA[1]) + normal[2] * (point[2] - pointA[2]);
+    if (fabs_(dist) > maxdist) {
+      maxdist= fabs_(dist);
+      tetra[3]= i;
+    }
+  }
+  point= coords + 3 * tetra[3];
+  volume= normal[0] * (point[0] - pointA[0]) + normal[1] * (point[1] - pointA[1]) + normal[2] * (point[2] - pointA[2]);
+  if (volume > 0.0) {  /* tetra[3] is below face (a, b, c) */
+    k= tetra[1];
+    tetra[1]= tetra[2];
+    tetra[2]= k;
+  }
+  faces[0][0]= tetra[0]; faces[0][1]= tetra[1]; faces[0][2]= tetra[2];
+  faces[1][0]= tetra[0]; faces[1][1]= tetra[3]; faces[1][2]= tetra[1];
+  faces[2][0]= tetra[1]; faces[2][1]= tetra[3]; faces[2][2]= tetra[2];
+  faces[3][0]= tetra[2]; faces[3][1]= tetra[3]; faces[3][2]= tetra[0];
+  for (i=0; i < 4; i++) {
+    pointA= coords + 3 * faces[i][0];
+    pointB= coords + 3 * faces[i][1];
+    pointC= coords + 3 * faces[i][2];
+    for (k=0; k < 3; k++) {
+      ab[k]= pointB[k] - pointA[k];
+      ac[k]= pointC[k] - pointA[k];
+    }
+    qh_crossproduct(3, ab, ac, normal);
+    area += sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]) / 2.0;
+  }
+  volume= fabs_(volume) / 6.0;
+  if (volume <= area * (qh->WIDEfacet + 2 * qh->DISTround) / 3.0) {  /* inradius is 3*volume/area */
+    trace2((qh, qh->ferr, 2128, "qh_hull3d_simplex: the initial simplex is nearly flat, volume %2.2g and area %2.2g\n",
+      volume, area));
+    return false;
+  }
+  for (i=0; i < 4; i++) {
+    hull->tetra[i]= tetra[i];
+    if ((hull->newfaces[i]= qh_hull3d_newface(qh, hull, faces[i][0], faces[i][1], faces[i][2])) < 0)
+      return false;
+  }
+  hull->numhorizon= 4;
+  for (i=0; i < 4; i++) {  /* link the twin half-edges */
+    face= &hull->faces[hull->newfaces[i]];
+    for (e=0; e < 3; e++) {
+      for (j=0; j < 4; j++) {
+        other= &hull->faces[hull->newfaces[j]];
+        for (k=0; j != i && k < 3; k++) {
+          if (other->vertices[k] == face->vertices[(e+1)%3] && other->vertices[(k+1)%3] == face->vertices[e])
+            face->twins[e]= 3 * hull->newfaces[j] + k;
+        }
+      }
+    }
+  }
+  for (i=0; i < numpoints; i++) {
+    if (i != tetra[0] && i != tetra[1] && i != tetra[2] && i != tetra[3]) {
+      for (k=0; k < 3; k++)
+        hull->gather[numgather].point[k]= coords[3 * i + k];
+      hull->gather[numgather++].id= i;
+    }
+  }
+  qh_hull3d_partition(qh, hull, numgather, 0);
+  return true;
+} /* hull3d_simplex */
+
+/*-<a                             href="qh-qhull_r.htm#TOC"
+  >-------------------------------</a><a name="infiniteloop">-</a>
+
+  qh_infiniteloop(qh, facet )
+    report infinite loop error due to facet
+*/
+void qh_infiniteloop(qhT *qh, facetT *facet) {
+
+  qh_fprintf(qh, qh->ferr, 6149, "qhull internal error (qh_infiniteloop): potential infinite loop detected.  If visible, f.replace. If newfacet, f.samecycle\n");
+  qh_errexit(qh, qh_ERRqhull, facet, NULL);
+} /* qh_infiniteloop */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="initbuild">-</a>
+
+  qh_initbuild()
+    initialize hull and outside sets with point array
+    qh.FIRSTpoint/qh.NUMpoints is point array
+    if qh.GOODpoint
+      adds qh.GOODpoint to initial hull
+
+  returns:
+    qh_facetlist with initial hull
+    points partioned into outside sets, coplanar sets, or inside
+    initializes qh.GOODpointp, qh.GOODvertexp,
+
+  design:
+    initialize global variables used during qh_buildhull
+    determine precision constants and points with max/min coordinate values
+      if qh.SCALElast, scale last coordinate(for 'd')
+    initialize qh.newfacet_list, qh.facet_tail
+    initialize qh.vertex_list, qh.newvertex_list, qh.vertex_tail
+    if 'Q18' and a 2-d convex hull
+      construct the hull polygon and partition the remaining points (qh_buildhull2d)
+    if 'Q19' and a 3-d convex hull
+      construct a half-edge hull and partition the remaining points (qh_buildhull3d)
+    otherwise
+      determine initial vertices
+      build initial simplex
+      partition input points into facets of initial simplex
+    set up lists
+    if qh.ONLYgood
+      check consistency
+      add qh.GOODvertex if defined
+*/
+void qh_initbuild(qhT *qh) {
+  setT *maxpoints, *vertices;
+  facetT *facet;
+  int i, numpart, prevphase;
+  realT dist;
+  bool isoutside;
+
+  if (qh->PRINTstatistics) {
+    qh_fprintf(qh, qh->ferr, 9350, "qhull %s Statistics: %s | %s\n",
+      qh_version, qh->rbox_command, qh->qhull_command);
+    fflush(NULL);
+  }
+  qh->furthest_id= qh_IDunknown;
+  qh->lastreport= 0;
+  qh->lastfacets= 0;
+  qh->lastmerges= 0;
+  qh->lastplanes= 0;
+  qh->lastdist= 0;
+  qh->facet_id= qh->vertex_id= qh->ridge_id= 0;
   qh->visit_id= qh->vertex_visit= 0;
   qh->maxoutdone= false;
 
@@ -2148,6 +3691,7 @@ void qh_initbuild(qhT *qh) {
              qh->num_points-1);
     qh_errexit(qh, qh_ERRinput, NULL, NULL);
   }
+  prevphase= qh_profilephase(qh, qh_PHASEsimplex);
   maxpoints= qh_maxmin(qh, qh->first_point, qh->num_points, qh->hull_dim);
   if (qh->SCALElast)
     qh_scalelast(qh, qh->first_point, qh->num_points, qh->hull_dim, qh->MINlastcoord, qh->MAXlastcoord, qh->MAXabs_coord);
@@ -2173,11 +3717,17 @@ void qh_initbuild(qhT *qh) {
   }
   trace4((qh, qh->ferr, 4091, "qh_initbuild: create sentinels for qh.facet_tail and qh.vertex_tail\n"));
   qh->facet_list= qh->newfacet_list= qh->facet_tail= qh_newfacet(qh);
-  qh->num_facets= qh->num_vertices= qh->num_visible= 0;
+  qh->num_facets= qh->num_vertices= qh->num_visible= qh->num_outside= 0;
   qh->vertex_list= qh->newvertex_list= qh->vertex_tail= qh_newvertex(qh, NULL);
-  vertices= qh_initialvertices(qh, qh->hull_dim, maxpoints, qh->first_point, qh->num_points);
-  qh_initialhull(qh, vertices);  /* initial qh->facet_list */
-  qh_partitionall(qh, vertices, qh->first_point, qh->num_points);
+  vertices= NULL;
+  if ((!qh->BUILD2d || !qh_buildhull2d(qh, qh->first_point, qh->num_points))
+  && (!qh->BUILD3d || !qh_buildhull3d(qh, qh->first_point, qh->num_points))) {
+    vertices= qh_initialvertices(qh, qh->hull_dim, maxpoints, qh->first_point, qh->num_points);
+    qh_initialhull(qh, vertices);  /* initial qh->facet_list */
+    qh_profilephase(qh, qh_PHASEpartition);
+    qh_partitionall(qh, vertices, qh->first_point, qh->num_points);
+    qh_profilephase(qh, prevphase);
+  }
   if (qh->PRINToptions1st || qh->TRACElevel || qh->IStracing) {
     if (qh->TRACElevel || qh->IStracing)
       qh_fprintf(qh, qh->ferr, 8103, "\nTrace level T%d, IStracing %d, point TP%d, merge TM%d, dist TW%2.2g, qh.tracefacet_id %d, traceridge_id %d, tracevertex_id %d, last qh.RERUN %d, %s | %s\n",
@@ -2219,7 +3769,7 @@ void qh_initbuild(qhT *qh) {
     }
     qh_findgood(qh, qh->facet_list, 0);
   }
-  qh_settempfree(qh, &vertices);
+  qh_settempfree(qh, &vertices);  /* NULL for qh_buildhull2d */
   qh_settempfree(qh, &maxpoints);
   trace1((qh, qh->ferr, 1030, "qh_initbuild: initial hull created and points partitioned\n"));
 } /* initbuild */
@@ -2344,9 +3894,12 @@ void qh_initialhull(qhT *qh, setT *vertices) {
   notes:
     unless qh.ALLpoints,
       uses maxpoints as long as determinate is non-zero
+    if qh.REUSEsimplex ('Q16') and a 'QJ' restart,
+      reuses the previous simplex (qh.restart_simplex) if its joggled determinate is non-zero
+      qh_joggleinput joggles the points in place, so the point pointers remain valid
 */
 setT *qh_initialvertices(qhT *qh, int dim, setT *maxpoints, pointT *points, int numpoints) {
-  pointT *point, **pointp;
+  pointT *point, **pointp, *apex;
   setT *vertices, *simplex, *tested;
   realT randr;
   int idx, point_i, point_n, k;
@@ -2354,7 +3907,25 @@ setT *qh_initialvertices(qhT *qh, int dim, setT *maxpoints, pointT *points, int
 
   vertices= qh_settemp(qh, dim + 1);
   simplex= qh_settemp(qh, dim + 1);
-  if (qh->ALLpoints)
+  if (qh->REUSEsimplex && !qh->RANDOMoutside && qh_setsize(qh, qh->restart_simplex) == dim+1) {
+    apex= SETfirstt_(qh->restart_simplex, pointT);
+    FOREACHpoint_(qh->restart_simplex) {
+      if (point != apex)
+        qh_setappend(qh, &simplex, point);
+    }
+    qh_detsimplex(qh, apex, simplex, dim, &nearzero);
+    if (nearzero)
+      qh_settruncate(qh, simplex, 0);
+    else {
+      qh_setaddnth(qh, &simplex, 0, apex);
+      zinc_(Zretrysimplex);
+      trace1((qh, qh->ferr, 1073, "qh_initialvertices: reuse the initial simplex of the previous build, apex p%d\n",
+        qh_pointid(qh, apex)));
+    }
+  }
+  if (qh_setsize(qh, simplex) == dim+1) {
+    /* reused qh.restart_simplex */
+  }else if (qh->ALLpoints)
     qh_maxsimplex(qh, dim, NULL, points, numpoints, &simplex);
   else if (qh->RANDOMoutside) {
     while (qh_setsize(qh, simplex) != dim+1) {
@@ -2424,6 +3995,12 @@ setT *qh_initialvertices(qhT *qh, int dim, setT *maxpoints, pointT *points, int
     qh_maxsimplex(qh, dim, maxpoints, points, numpoints, &simplex);
   }else /* qh.hull_dim < qh_INITIALmax */
     qh_maxsimplex(qh, dim, maxpoints, points, numpoints, &simplex);
+  if (qh->REUSEsimplex) {
+    if (!qh->restart_simplex)
+      qh->restart_simplex= qh_setnew(qh, dim+1);
+    qh_settruncate(qh, qh->restart_simplex, 0);
+    qh_setappend_set(qh, &qh->restart_simplex, simplex);
+  }
   FOREACHpoint_(simplex)
     qh_setaddnth(qh, &vertices, 0, qh_newvertex(qh, point)); /* descending order */
   qh_settempfree(qh, &simplex);
@@ -2451,9 +4028,239 @@ vertexT *qh_isvertex(pointT *point, setT *vertices) {
 } /* isvertex */
 
 /*-<a                             href="qh-poly_r.htm#TOC"
-  >-------------------------------</a><a name="makenewfacets">-</a>
+  >-------------------------------</a><a name="locate_build">-</a>
 
-  qh_makenewfacets(qh, point )
+  qh_locate_build(qh)
+    build a grid of start facets for qh_locatefacet
+    call after qh_qhull (and qh_triangulate, if any)
+
+  returns:
+    qh.locate_grid with a start facet for each cell, or NULL if no vertices
+    sets qh.locate_facetid to qh.facet_id
+
+  notes:
+    for Delaunay triangulations, the grid covers the input sites (first hull_dim-1 coordinates)
+    otherwise it covers the first qh_LOCATEdim coordinates of the vertices
+    about qh_LOCATEvertices vertices per cell.  Narrow coordinates have one cell
+    sets vertex neighbors (qh_vertexneighbors)
+    freed by qh_locate_free and qh_freebuild
+
+  design:
+    determine the bounding box of the vertices
+    choose the cell size for num_vertices/qh_LOCATEvertices cells
+    for each vertex
+      set its cell to a lower neighbor if the vertex is nearest to the cell's center
+    fill empty cells from adjacent cells, one coordinate at a time
+*/
+void qh_locate_build(qhT *qh) {
+  vertexT *vertex;
+  facetT *neighbor, **neighborp, *startfacet;
+  realT *celldist, high[qh_LOCATEdim], extent[qh_LOCATEdim];
+  realT dist, offset, x, volume, cellsize= 1.0, numcells;
+  bool isgrid[qh_LOCATEdim], waschanged;
+  int k, cell, stride, size, numdim, numempty= 0;
+
+  qh_locate_free(qh);
+  qh->locate_facetid= qh->facet_id;
+  if (!qh->vertex_list || !qh->num_vertices)
+    return;
+  qh_vertexneighbors(qh);
+  qh->locate_dim= (qh->DELAUNAY ? qh->hull_dim-1 : qh->hull_dim);
+  minimize_(qh->locate_dim, qh_LOCATEdim);
+  for (k=0; k < qh->locate_dim; k++) {
+    qh->locate_low[k]= REALmax;
+    high[k]= -REALmax;
+  }
+  FORALLvertices {
+    for (k=0; k < qh->locate_dim; k++) {
+      minimize_(qh->locate_low[k], vertex->point[k]);
+      maximize_(high[k], vertex->point[k]);
+    }
+  }
+  numcells= (realT)qh->num_vertices / qh_LOCATEvertices;
+  maximize_(numcells, 1.0);
+  for (k=0; k < qh->locate_dim; k++) {
+    extent[k]= high[k] - qh->locate_low[k];
+    isgrid[k]= (extent[k] > 0.0);
+  }
+  do {  /* a coordinate narrower than a cell has one cell */
+    volume= 1.0;
+    numdim= 0;
+    for (k=0; k < qh->locate_dim; k++) {
+      if (isgrid[k]) {
+        volume *= extent[k];
+        numdim++;
+      }
+    }
+    if (!numdim)
+      break;
+    cellsize= pow(volume/numcells, 1.0/numdim);
+    waschanged= false;
+    for (k=0; k < qh->locate_dim; k++) {
+      if (isgrid[k] && extent[k] < cellsize) {
+        isgrid[k]= false;
+        waschanged= true;
+      }
+    }
+  }while (waschanged);
+  qh->locate_cells= 1;
+  for (k=0; k < qh->locate_dim; k++) {
+    if (isgrid[k]) {
+      size= (int)(extent[k]/cellsize);
+      maximize_(size, 1);
+      qh->locate_size[k]= size;
+      qh->locate_scale[k]= size/extent[k];
+    }else {
+      qh->locate_size[k]= 1;
+      qh->locate_scale[k]= 0.0;
+    }
+    qh->locate_cells *= qh->locate_size[k];
+  }
+  qh->locate_grid= (facetT **)qh_memalloc(qh, qh->locate_cells * (int)sizeof(facetT *));
+  celldist= (realT *)qh_memalloc(qh, qh->locate_cells * (int)sizeof(realT));
+  for (cell=0; cell < qh->locate_cells; cell++) {
+    qh->locate_grid[cell]= NULL;
+    celldist[cell]= REALmax;
+  }
+  FORALLvertices {
+    startfacet= NULL;
+    FOREACHneighbor_(vertex) {
+      if (neighbor->flipped || neighbor->visible || !neighbor->normal)
+        continue;
+      startfacet= neighbor;
+      if (!neighbor->upperdelaunay)
+        break;
+    }
+    if (!startfacet)
+      continue;
+    cell= qh_locate_cell(qh, vertex->point);
+    dist= 0.0;
+    for (k=0; k < qh->locate_dim; k++) {
+      x= (vertex->point[k] - qh->locate_low[k]) * qh->locate_scale[k];
+      offset= x - floor(x) - 0.5;  /* x is at most locate_size[k] */
+      dist += offset * offset;
+    }
+    if (!qh->locate_grid[cell]
+    || (qh->locate_grid[cell]->upperdelaunay && !startfacet->upperdelaunay)
+    || (qh->locate_grid[cell]->upperdelaunay == startfacet->upperdelaunay && dist < celldist[cell])) {
+      qh->locate_grid[cell]= startfacet;
+      celldist[cell]= dist;
+    }
+  }
+  qh_memfree(qh, celldist, qh->locate_cells * (int)sizeof(realT));
+  for (cell=0; cell < qh->locate_cells; cell++) {
+    if (!qh->locate_grid[cell])
+      numempty++;
+  }
+  stride= 1;
+  for (k=0; k < qh->locate_dim; k++) {
+    size= qh->locate_size[k];
+    if (size > 1) {
+      for (cell=0; cell < qh->locate_cells; cell++) {
+        if (!qh->locate_grid[cell] && (cell/stride) % size > 0)
+          qh->locate_grid[cell]= qh->locate_grid[cell-stride];
+      }
+      for (cell= qh->locate_cells-1; cell >= 0; cell--) {
+        if (!qh->locate_grid[cell] && (cell/stride) % size < size-1)
+          qh->locate_grid[cell]= qh->locate_grid[cell+stride];
+      }
+    }
+    stride *= size;
+  }
+  trace1((qh, qh->ferr, 1069, "qh_locate_build: %d-d grid of %d cells for %d vertices.  %d cells were empty\n",
+    qh->locate_dim, qh->locate_cells, qh->num_vertices, numempty));
+} /* locate_build */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="locate_cell">-</a>
+
+  qh_locate_cell(qh, point )
+    return index of point's cell in qh.locate_grid
+
+  notes:
+    points outside of the grid are clamped to the nearest cell
+    does not change qh (thread-safe)
+*/
+int qh_locate_cell(qhT *qh, pointT *point) {
+  realT x;
+  int k, i, cell= 0, stride= 1;
+
+  for (k=0; k < qh->locate_dim; k++) {
+    x= (point[k] - qh->locate_low[k]) * qh->locate_scale[k];
+    if (x >= qh->locate_size[k])
+      i= qh->locate_size[k] - 1;
+    else if (x > 0.0)
+      i= (int)x;
+    else
+      i= 0;  /* also for NaN */
+    cell += i * stride;
+    stride *= qh->locate_size[k];
+  }
+  return cell;
+} /* locate_cell */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="locate_free">-</a>
+
+  qh_locate_free(qh)
+    free the point-location grid, if any
+*/
+void qh_locate_free(qhT *qh) {
+
+  if (qh->locate_grid)
+    qh_memfree(qh, qh->locate_grid, qh->locate_cells * (int)sizeof(facetT *));
+  qh->locate_grid= NULL;
+  qh->locate_cells= 0;
+  qh->locate_dim= 0;
+  qh->locate_facetid= 0;
+} /* locate_free */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="locatefacet">-</a>
+
+  qh_locatefacet(qh, point, bestoutside, bestdist, isoutside )
+    same as qh_findbestfacet, but starts at a nearby facet from qh.locate_grid
+
+    for Delaunay triangulations,
+      Use qh_setdelaunay() to lift point to paraboloid and scale by 'Qbb' if needed
+      Do not use options 'Qbk', 'QBk', or 'QbB' since they scale the coordinates.
+
+  returns:
+    see qh_findbestfacet
+
+  notes:
+    builds qh.locate_grid (qh_locate_build) on first call or if the hull changed
+    qh_findbestfacet starts at qh.facet_list.  Its directed search visits
+      O(n^(1/d)) facets for n vertices.  qh_locatefacet visits O(1) facets for well-distributed points
+    Both return a facet that is furthest below the point in its neighborhood.  They may return
+      different facets, e.g., for points near a ridge or outside of the hull
+    both call qh_findbestfacet_start
+    uses qh.visit_id and qh.coplanarset
+
+  see:
+    <a href="poly2_r.c#findbestfacet">qh_findbestfacet</a>
+*/
+facetT *qh_locatefacet(qhT *qh, pointT *point, bool bestoutside,
+           realT *bestdist, bool *isoutside) {
+  facetT *startfacet= NULL, *bestfacet= NULL;
+  int totpart= 0;
+
+  if (qh->locate_facetid != qh->facet_id)
+    qh_locate_build(qh);
+  if (qh->locate_grid)
+    startfacet= qh->locate_grid[qh_locate_cell(qh, point)];
+  if (!startfacet)
+    startfacet= qh->facet_list;
+  bestfacet= qh_findbestfacet_start(qh, point, startfacet, bestoutside, bestdist, isoutside, &totpart);
+  trace3((qh, qh->ferr, 3079, "qh_locatefacet: f%d dist %2.2g isoutside %d totpart %d from start f%d\n",
+          bestfacet->id, *bestdist, (isoutside ? *isoutside : UINT_MAX), totpart, startfacet->id));
+  return bestfacet;
+} /* locatefacet */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="makenewfacets">-</a>
+
+  qh_makenewfacets(qh, point )
     make new facets from point and qh.visible_list
 
   returns:
@@ -3178,6 +4985,165 @@ setT *qh_pointfacet(qhT *qh /* qh.facet_list */) {
   return facets;
 } /* pointfacet */
 
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="pointtree_free">-</a>
+
+  qh_pointtree_free(qh, treep )
+    free a bounding-box tree from qh_pointtree_new, if any
+*/
+void qh_pointtree_free(qhT *qh, pointtreeT **treep) {
+  pointtreeT *tree= *treep;
+
+  if (tree) {
+    qh_memfree(qh, tree->points, tree->maxpoints * (int)sizeof(pointT *));
+    qh_memfree(qh, tree->nodes, tree->maxnodes * (int)sizeof(pointnodeT));
+    qh_memfree(qh, tree->boxes, tree->maxnodes * 2 * qh->hull_dim * (int)sizeof(coordT));
+    qh_memfree(qh, tree, (int)sizeof(pointtreeT));
+    *treep= NULL;
+  }
+} /* pointtree_free */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="pointtree_new">-</a>
+
+  qh_pointtree_new(qh )
+    return a bounding-box tree of the points checked by qh_check_points
+    includes qh.other_points but not qh.GOODpointp
+
+  returns:
+    pointtreeT from qh_memalloc.  Free with qh_pointtree_free
+
+  notes:
+    the tree does not change when facets change.  It is invalid if points are added
+    O(n log n) for n points
+
+  design:
+    collect the points
+    split the points at the median of their widest coordinate until each leaf has qh_POINTleaf points or less
+*/
+pointtreeT *qh_pointtree_new(qhT *qh) {
+  pointtreeT *tree;
+  pointT *point, **pointp, *pointtemp;
+  int numpoints= qh->num_points + qh_setsize(qh, qh->other_points);
+
+  tree= (pointtreeT *)qh_memalloc(qh, (int)sizeof(pointtreeT));
+  tree->maxpoints= numpoints;
+  tree->points= (pointT **)qh_memalloc(qh, numpoints * (int)sizeof(pointT *));
+  tree->numpoints= 0;
+  FORALLpoints {
+    if (point != qh->GOODpointp)
+      tree->points[tree->numpoints++]= point;
+  }
+  FOREACHpoint_(qh->other_points) {
+    if (point != qh->GOODpointp)
+      tree->points[tree->numpoints++]= point;
+  }
+  tree->maxnodes= 4 * (numpoints / qh_POINTleaf) + 2;  /* leaves have at least qh_POINTleaf/2 points */
+  tree->nodes= (pointnodeT *)qh_memalloc(qh, tree->maxnodes * (int)sizeof(pointnodeT));
+  tree->boxes= (coordT *)qh_memalloc(qh, tree->maxnodes * 2 * qh->hull_dim * (int)sizeof(coordT));
+  tree->numnodes= 0;
+  if (tree->numpoints)
+    qh_pointtree_split(qh, tree, 0, tree->numpoints);
+  trace2((qh, qh->ferr, 2119, "qh_pointtree_new: %d nodes for %d points\n", tree->numnodes, tree->numpoints));
+  return tree;
+} /* pointtree_new */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="pointtree_select">-</a>
+
+  qh_pointtree_select( points, start, end, nth, k )
+    partially sort points[start..end-1] by coordinate k about points[nth]
+
+  returns:
+    points before nth have coordinate k <= points[nth][k]
+    points after nth have coordinate k >= points[nth][k]
+
+  notes:
+    Hoare's selection algorithm, expected O(end-start)
+*/
+void qh_pointtree_select(pointT **points, int start, int end, int nth, int k) {
+  pointT *temp;
+  coordT pivot;
+  int left= start, right= end-1, i, j;
+
+  while (left < right) {
+    pivot= points[left + (right-left)/2][k];
+    i= left;
+    j= right;
+    while (i <= j) {
+      while (points[i][k] < pivot)
+        i++;
+      while (points[j][k] > pivot)
+        j--;
+      if (i <= j) {
+        temp= points[i];
+        points[i++]= points[j];
+        points[j--]= temp;
+      }
+    }
+    if (nth <= j)
+      right= j;
+    else if (nth >= i)
+      left= i;
+    else
+      break;
+  }
+} /* pointtree_select */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="pointtree_split">-</a>
+
+  qh_pointtree_split(qh, tree, start, end )
+    append a node for tree->points[start..end-1] and its subtree
+
+  returns:
+    nodes in preorder with their bounding boxes
+    node->skip is the next node after its subtree.  It is node+1 for a leaf
+*/
+void qh_pointtree_split(qhT *qh, pointtreeT *tree, int start, int end) {
+  pointnodeT *node;
+  coordT *low, *high, *coord;
+  realT width, maxwidth= -1.0;
+  int nodeid, i, k, widest= 0, mid;
+
+  if (tree->numnodes >= tree->maxnodes) {
+    qh_fprintf(qh, qh->ferr, 6443, "qhull internal error (qh_pointtree_split): more than %d nodes for %d points\n",
+        tree->maxnodes, tree->numpoints);
+    qh_errexit(qh, qh_ERRqhull, NULL, NULL);
+  }
+  nodeid= tree->numnodes++;
+  node= tree->nodes + nodeid;
+  node->start= start;
+  node->end= end;
+  low= tree->boxes + 2 * qh->hull_dim * nodeid;
+  high= low + qh->hull_dim;
+  for (k=0; k < qh->hull_dim; k++) {
+    low[k]= REALmax;
+    high[k]= -REALmax;
+  }
+  for (i=start; i < end; i++) {
+    coord= tree->points[i];
+    for (k=0; k < qh->hull_dim; k++) {
+      minimize_(low[k], coord[k]);
+      maximize_(high[k], coord[k]);
+    }
+  }
+  if (end - start > qh_POINTleaf) {
+    for (k=0; k < qh->hull_dim; k++) {
+      width= high[k] - low[k];
+      if (width > maxwidth) {
+        maxwidth= width;
+        widest= k;
+      }
+    }
+    mid= start + (end - start)/2;
+    qh_pointtree_select(tree->points, start, end, mid, widest);
+    qh_pointtree_split(qh, tree, start, mid);
+    qh_pointtree_split(qh, tree, mid, end);
+  }
+  node->skip= tree->numnodes;
+} /* pointtree_split */
+
 /*-<a                             href="qh-poly_r.htm#TOC"
   >-------------------------------</a><a name="pointvertex">-</a>
 
@@ -3317,6 +5283,560 @@ void qh_printlists(qhT *qh) {
   qh_fprintf(qh, qh->ferr, 8114, "\n");
 } /* printlists */
 
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="query_alloc">-</a>
+
+  qh_query_alloc(qh)
+    return scratch state for searches that start from a known facet
+    e.g., qh_query_findhorizon for qh_check_maxout
+
+  returns:
+    queryT from qh_memalloc.  Free with qh_query_free
+
+  notes:
+    same as qh_query_new without qh.locate_grid and vertex neighbors
+    does not change qh.VERTEXneighbors, as needed for post-processing (qh_check_maxout)
+*/
+queryT *qh_query_alloc(qhT *qh) {
+  queryT *query;
+  bool nearzero= false;
+
+  query= (queryT *)qh_memalloc(qh, (int)sizeof(queryT));
+  query->facet_id= qh->facet_id;
+  query->visit_id= 0;
+  query->visitids= (unsigned int *)qh_memalloc(qh, (int)query->facet_id * (int)sizeof(unsigned int));
+  memset((char *)query->visitids, 0, (size_t)query->facet_id * sizeof(unsigned int));
+  query->searchsize= qh->num_facets+1;
+  query->searchset= (facetT **)qh_memalloc(qh, query->searchsize * (int)sizeof(facetT *));
+  query->point= (coordT *)qh_memalloc(qh, qh->normal_size);
+  query->isscalelast= (qh->DELAUNAY && qh->last_low < REALmax/2);
+  query->lastscale= 1.0;
+  query->lastshift= 0.0;
+  if (query->isscalelast) {  /* same as qh_scalelast from qh_setdelaunay */
+    query->lastscale= qh_divzero(qh->last_newhigh - 0.0, qh->last_high - qh->last_low, qh->MINdenom_1, &nearzero);
+    query->lastshift= 0.0 - qh->last_low * query->lastscale;
+  }
+  query->numpart= 0;
+  return query;
+} /* query_alloc */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="query_findall">-</a>
+
+  qh_query_findall(qh, query, point, noupper, bestdist, isoutside )
+    exhaustive search for facet below a point
+    same as qh_findfacet_all, but read-only
+
+  returns:
+    returns first facet below point
+    if point is inside, returns nearest facet
+    distance to facet
+    isoutside if point is outside of the hull
+    adds distance tests to query->numpart
+*/
+facetT *qh_query_findall(qhT *qh, queryT *query, pointT *point, bool noupper, realT *bestdist, bool *isoutside) {
+  facetT *bestfacet= NULL, *facet;
+  realT dist;
+
+  *bestdist= -REALmax;
+  *isoutside= false;
+  FORALLfacets {
+    if (facet->flipped || !facet->normal || facet->visible)
+      continue;
+    if (noupper && facet->upperdelaunay)
+      continue;
+    query->numpart++;
+    dist= qh_distnorm(qh->hull_dim, point, facet->normal, &facet->offset);
+    if (dist > *bestdist) {
+      *bestdist= dist;
+      bestfacet= facet;
+      if (dist > qh->MINoutside) {
+        *isoutside= true;
+        break;
+      }
+    }
+  }
+  return bestfacet;
+} /* query_findall */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="query_findbest">-</a>
+
+  qh_query_findbest(qh, query, point, startfacet, bestoutside, noupper, dist, isoutside )
+    find facet that is furthest below a point
+    same as qh_findbest(..., !qh_ISnewfacets, ...), but read-only
+
+  returns:
+    best facet
+    early out if !bestoutside and dist >= qh.MINoutside
+    dist is distance to facet
+    isoutside is true if point is outside of facet
+    adds distance tests to query->numpart
+
+  notes:
+    uses query->visitids instead of facet->visitid
+    qh_distnorm does not randomize distances ('Rn')
+    does not update statistics or trace
+
+  design:
+    see qh_findbest
+*/
+facetT *qh_query_findbest(qhT *qh, queryT *query, pointT *point, facetT *startfacet,
+           bool bestoutside, bool noupper, realT *dist, bool *isoutside) {
+  realT bestdist= -REALmax/2 /* avoid underflow */;
+  facetT *facet, *neighbor, **neighborp;
+  facetT *bestfacet= NULL, *lastfacet= NULL;
+  unsigned int visitid;
+
+  if (!++query->visit_id) {
+    memset((char *)query->visitids, 0, (size_t)query->facet_id * sizeof(unsigned int));
+    query->visit_id= 1;
+  }
+  visitid= query->visit_id;
+  if (isoutside)
+    *isoutside= true;
+  if (!startfacet->flipped) {  /* test startfacet before testing its neighbors */
+    query->numpart++;
+    *dist= qh_distnorm(qh->hull_dim, point, startfacet->normal, &startfacet->offset);
+    if (!bestoutside && *dist >= qh->MINoutside
+    && (!startfacet->upperdelaunay || !noupper))
+      return startfacet;
+    bestdist= *dist;
+    if (!startfacet->upperdelaunay)
+      bestfacet= startfacet;
+  }
+  query->visitids[startfacet->id]= visitid;
+  facet= startfacet;
+  while (facet) {
+    lastfacet= facet;
+    FOREACHneighbor_(facet) {
+      if (query->visitids[neighbor->id] == visitid)
+        continue;
+      query->visitids[neighbor->id]= visitid;
+      if (!neighbor->flipped) {
+        query->numpart++;
+        *dist= qh_distnorm(qh->hull_dim, point, neighbor->normal, &neighbor->offset);
+        if (*dist > bestdist) {
+          if (!bestoutside && *dist >= qh->MINoutside
+          && (!neighbor->upperdelaunay || !noupper))
+            return neighbor;
+          if (!neighbor->upperdelaunay) {
+            bestfacet= neighbor;
+            bestdist= *dist;
+            break; /* switch to neighbor */
+          }else if (!bestfacet) {
+            bestdist= *dist;
+            break; /* switch to neighbor */
+          }
+        }
+      }
+    }
+    facet= neighbor;  /* non-NULL only if *dist>bestdist */
+  }
+  if (!bestfacet)
+    bestfacet= qh_query_findlower(qh, query, lastfacet, point, &bestdist);
+  bestfacet= qh_query_findhorizon(qh, query, !qh_IScheckmax, point, bestfacet, noupper, &bestdist, &query->numpart, NULL);
+  *dist= bestdist;
+  if (isoutside && bestdist < qh->MINoutside)
+    *isoutside= false;
+  return bestfacet;
+} /* query_findbest */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="query_findhorizon">-</a>
+
+  qh_query_findhorizon(qh, query, ischeckmax, point, startfacet, noupper, &bestdist, &numpart, maxoutsides )
+    search coplanar and better horizon facets from startfacet/bestdist
+    the search of qh_findbesthorizon, with the scratch state in query
+    if query is NULL, uses facet->visitid, qh.coplanarfacetset, and facet->maxoutside
+
+  returns:
+    the same as qh_findbesthorizon
+    if query and ischeckmax, updates maxoutsides[facet->id] instead of facet->maxoutside
+    numpart -- updates number of distance tests, e.g., &query->numpart
+
+  notes:
+    called by qh_findbesthorizon (query is NULL), qh_query_findbest, and qh_check_maxoutpoints
+    if query, read-only and thread-safe.  No statistics, tracing, or random distance ('Rn')
+    query->searchset replaces qh.coplanarfacetset.  A facet is pushed at most once
+    the caller reduces maxoutsides into facet->maxoutside
+
+  design:
+    see qh_findbesthorizon
+*/
+facetT *qh_query_findhorizon(qhT *qh, queryT *query, bool ischeckmax, pointT *point, facetT *startfacet,
+           bool noupper, realT *bestdist, int *numpart, realT *maxoutsides) {
+  facetT *bestfacet= startfacet;
+  realT dist;
+  facetT *neighbor, **neighborp, *facet;
+  facetT *nextfacet= NULL; /* optimize last facet of the search set */
+  int numpartinit= *numpart, numsearch= 0, numcoplanar= 0, numfacet= 0;
+  unsigned int visitid, *visitp;
+  bool newbest= false; /* for tracing */
+  realT minsearch, searchdist;  /* skip facets that are too far from point */
+  bool is_5x_minsearch;
+
+  if (query) {
+    if (!++query->visit_id) {
+      memset((char *)query->visitids, 0, (size_t)query->facet_id * sizeof(unsigned int));
+      query->visit_id= 1;
+    }
+    visitid= query->visit_id;
+  }else
+    visitid= ++qh->visit_id;
+  if (!ischeckmax) {
+    if (!query)
+      zinc_(Zfindhorizon);
+  }else {
+#if qh_MAXoutside
+    if (!qh->ONLYgood || startfacet->good) {
+      if (query) {
+        maximize_(maxoutsides[startfacet->id], *bestdist);
+      }else {
+        maximize_(startfacet->maxoutside, *bestdist);
+      }
+    }
+#endif
+  }
+  searchdist= qh_SEARCHdist; /* an expression, a multiple of qh.max_outside and precision constants */
+  minsearch= *bestdist - searchdist;
+  if (ischeckmax) {
+    /* Always check coplanar facets.  Needed for RBOX 1000 s Z1 G1e-13 t996564279 | QHULL Tv */
+    minimize_(minsearch, -searchdist);
+  }
+  if (query)
+    query->visitids[startfacet->id]= visitid;
+  else
+    startfacet->visitid= visitid;
+  facet= startfacet;
+  while (true) {
+    numfacet++;
+    is_5x_minsearch= (ischeckmax && facet->nummerge > 10 && qh_setsize(qh, facet->neighbors) > 100);  /* QH11033 FIX: qh_findbesthorizon: many tests for facets with many merges and neighbors.  Can hide coplanar facets, e.g., 'rbox 1000 s Z1 G1e-13' with 4400+ neighbors */
+    if (!query) {
+      trace4((qh, qh->ferr, 4002, "qh_findbesthorizon: test neighbors of f%d bestdist %2.2g f%d ischeckmax? %d noupper? %d minsearch %2.2g is_5x? %d searchdist %2.2g\n",
+                facet->id, *bestdist, getid_(bestfacet), ischeckmax, noupper,
+                minsearch, is_5x_minsearch, searchdist));
+    }
+    FOREACHneighbor_(facet) {
+      visitp= (query ? &query->visitids[neighbor->id] : &neighbor->visitid);
+      if (*visitp == visitid)
+        continue;
+      *visitp= visitid;
+      if (!neighbor->flipped) {  /* neighbors of flipped facets always searched via nextfacet */
+        if (query)
+          dist= qh_distnorm(qh->hull_dim, point, neighbor->normal, &neighbor->offset);
+        else
+          qh_distplane(qh, point, neighbor, &dist); /* duplicate qh_distpane for new facets, they may be coplanar */
+        (*numpart)++;
+        if (dist > *bestdist) {
+          if (!neighbor->upperdelaunay || ischeckmax || (!noupper && dist >= qh->MINoutside)) {
+            if (!ischeckmax) {
+              minsearch= dist - searchdist;
+              if (dist > *bestdist + searchdist) {
+                if (!query)
+                  zinc_(Zfindjump);  /* everything in the search set is at least searchdist below */
+                numsearch= 0;
+              }
+            }
+            bestfacet= neighbor;
+            *bestdist= dist;
+            newbest= true;
+          }
+        }else if (is_5x_minsearch) {
+          if (dist < 5 * minsearch)
+            continue; /* skip this neighbor, do not set nextfacet.  dist is negative */
+        }else if (dist < minsearch)
+          continue;  /* skip this neighbor, do not set nextfacet.  If ischeckmax, dist can't be positive */
+#if qh_MAXoutside
+        if (ischeckmax) {
+          if (query) {
+            maximize_(maxoutsides[neighbor->id], dist);
+          }else {
+            maximize_(neighbor->maxoutside, dist);
+          }
+        }
+#endif
+      } /* end of !flipped, need to search neighbor */
+      if (nextfacet) {
+        numcoplanar++;
+        if (query)
+          query->searchset[numsearch++]= nextfacet;
+        else if (!numsearch++) {
+          SETfirst_(qh->coplanarfacetset)= nextfacet;
+          SETtruncate_(qh->coplanarfacetset, 1);
+        }else
+          qh_setappend(qh, &qh->coplanarfacetset, nextfacet); /* Was needed for RBOX 1000 s W1e-13 P0 t996547055 | QHULL d Qbb Qc Tv
+                                                 and RBOX 1000 s Z1 G1e-13 t996564279 | qhull Tv  */
+      }
+      nextfacet= neighbor;
+    } /* end of EACHneighbor */
+    facet= nextfacet;
+    if (facet)
+      nextfacet= NULL;
+    else if (!numsearch)
+      break;
+    else if (query)
+      facet= query->searchset[--numsearch];
+    else if (!--numsearch) {
+      facet= SETfirstt_(qh->coplanarfacetset, facetT);
+      SETtruncate_(qh->coplanarfacetset, 0);
+    }else
+      facet= (facetT *)qh_setdellast(qh->coplanarfacetset);
+  } /* while true, i.e., "for each facet in the search set" */
+  if (!query) {
+    if (!ischeckmax) {
+      zadd_(Zfindhorizontot, *numpart - numpartinit);
+      zmax_(Zfindhorizonmax, *numpart - numpartinit);
+      if (newbest)
+        zinc_(Znewbesthorizon);
+    }
+    trace4((qh, qh->ferr, 4003, "qh_findbesthorizon: p%d, newbest? %d, bestfacet f%d, bestdist %2.2g, numfacet %d, coplanarfacets %d, numdist %d\n",
+      qh_pointid(qh, point), newbest, getid_(bestfacet), *bestdist, numfacet, numcoplanar, *numpart - numpartinit));
+  }
+  return bestfacet;
+} /* query_findhorizon */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="query_findlower">-</a>
+
+  qh_query_findlower(qh, query, upperfacet, point, bestdist )
+    returns best non-upper, non-flipped neighbor of upperfacet for point
+    same as qh_findbestlower, but read-only
+
+  notes:
+    if needed, searches the neighbors of all vertices of upperfacet instead of qh_nearvertex
+    requires qh.VERTEXneighbors (qh_query_new)
+*/
+facetT *qh_query_findlower(qhT *qh, queryT *query, facetT *upperfacet, pointT *point, realT *bestdist) {
+  facetT *neighbor, **neighborp, *bestfacet= NULL;
+  vertexT *vertex, **vertexp;
+  realT dist;
+  bool isoutside;  /* not used */
+
+  *bestdist= -REALmax/2 /* avoid underflow */;
+  FOREACHneighbor_(upperfacet) {
+    if (neighbor->upperdelaunay || neighbor->flipped)
+      continue;
+    query->numpart++;
+    dist= qh_distnorm(qh->hull_dim, point, neighbor->normal, &neighbor->offset);
+    if (dist > *bestdist) {
+      bestfacet= neighbor;
+      *bestdist= dist;
+    }
+  }
+  if (!bestfacet) {
+    FOREACHvertex_(upperfacet->vertices) {
+      FOREACHneighbor_(vertex) {
+        if (neighbor->upperdelaunay || neighbor->flipped)
+          continue;
+        query->numpart++;
+        dist= qh_distnorm(qh->hull_dim, point, neighbor->normal, &neighbor->offset);
+        if (dist > *bestdist) {
+          bestfacet= neighbor;
+          *bestdist= dist;
+        }
+      }
+    }
+  }
+  if (!bestfacet)
+    bestfacet= qh_query_findall(qh, query, point, qh_NOupper, bestdist, &isoutside);
+  return bestfacet;
+} /* query_findlower */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="query_free">-</a>
+
+  qh_query_free(qh, &query )
+    free query state from qh_query_new, if any
+
+  returns:
+    query= NULL
+*/
+void qh_query_free(qhT *qh, queryT **queryp) {
+  queryT *query= *queryp;
+
+  if (query) {
+    qh_memfree(qh, query->visitids, (int)query->facet_id * (int)sizeof(unsigned int));
+    qh_memfree(qh, query->searchset, query->searchsize * (int)sizeof(facetT *));
+    qh_memfree(qh, query->point, qh->normal_size);
+    qh_memfree(qh, query, (int)sizeof(queryT));
+    *queryp= NULL;
+  }
+} /* query_free */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="query_lift">-</a>
+
+  qh_query_lift(qh, query, site )
+    lift an input site to the paraboloid for a Delaunay query
+    same as copying site and calling qh_setdelaunay, but read-only
+
+  returns:
+    query->point with hull_dim coordinates, overwritten by the next call
+*/
+pointT *qh_query_lift(qhT *qh, queryT *query, pointT *site) {
+  coordT *coordp= query->point, coord;
+  realT paraboloid;
+  int k;
+
+  coord= *coordp++= site[0];
+  paraboloid= coord*coord;
+  for (k=1; k < qh->hull_dim-1; k++) {
+    coord= *coordp++= site[k];
+    paraboloid += coord*coord;
+  }
+  if (query->isscalelast)
+    *coordp= paraboloid * query->lastscale + query->lastshift;
+  else
+    *coordp= paraboloid;
+  return query->point;
+} /* query_lift */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="query_locate">-</a>
+
+  qh_query_locate(qh, query, point, bestoutside, bestdist, isoutside )
+    same as qh_locatefacet, but read-only
+    thread-safe if each thread has its own query from qh_query_new
+
+    for Delaunay triangulations,
+      Use qh_query_lift() to lift a site to the paraboloid
+
+  returns:
+    see qh_findbestfacet
+    NULL if the hull changed after qh_query_new
+    sets query->numpart to the number of distance tests
+
+  notes:
+    does not change qh, facets, or vertices
+    does not update statistics, trace, or randomize distances ('Rn')
+    isoutside may be NULL
+*/
+facetT *qh_query_locate(qhT *qh, queryT *query, pointT *point, bool bestoutside,
+           realT *bestdist, bool *isoutside) {
+  facetT *startfacet= NULL, *bestfacet;
+  bool wasoutside;
+
+  if (query->facet_id != qh->facet_id || qh->locate_facetid != qh->facet_id)
+    return NULL;
+  query->numpart= 0;
+  if (qh->locate_grid)
+    startfacet= qh->locate_grid[qh_locate_cell(qh, point)];
+  if (!startfacet)
+    startfacet= qh->facet_list;
+  bestfacet= qh_query_findbest(qh, query, point, startfacet,
+                            bestoutside, bestoutside /* qh_NOupper */, bestdist, isoutside);
+  if (*bestdist < -qh->DISTround) {
+    bestfacet= qh_query_findall(qh, query, point, !qh_NOupper, bestdist, &wasoutside);
+    if (isoutside)
+      *isoutside= wasoutside;
+    if ((isoutside && *isoutside && bestoutside)
+    || (isoutside && !*isoutside && bestfacet->upperdelaunay)) {
+      bestfacet= qh_query_findbest(qh, query, point, bestfacet,
+                            bestoutside, bestoutside, bestdist, isoutside);
+    }
+  }
+  return bestfacet;
+} /* query_locate */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="query_locate_all">-</a>
+
+  qh_query_locate_all(qh, dim, numpoints, points, bestoutside, bestfacets, bestdists, isoutsides )
+    locate numpoints points with qh_query_locate, in parallel if 'QPn'
+    points are hull_dim coordinates, or input sites (hull_dim-1) for Delaunay triangulations
+
+  returns:
+    bestfacets[i], bestdists[i], and isoutsides[i] for points[i*dim]
+    bestdists and isoutsides may be NULL
+
+  notes:
+    the same as calling qh_locatefacet for each point (lifted by qh_setdelaunay)
+    each thread has its own queryT
+    does not change facets or vertices.  Builds qh.locate_grid and vertex neighbors if needed
+
+  design:
+    check dim
+    determine the number of threads (qh_parallelthreads)
+    allocate a queryT for each thread
+    for each thread in parallel
+      for its range of points
+        lift the point to the paraboloid if needed
+        locate the point with qh_query_locate
+    free the queryT
+*/
+void qh_query_locate_all(qhT *qh, int dim, int numpoints, coordT *points, bool bestoutside,
+           facetT **bestfacets, realT *bestdists, bool *isoutsides) {
+  queryT **queries;
+  int i, numthreads, chunk;
+  bool islift= false;
+
+  if (qh->DELAUNAY && dim == qh->hull_dim-1)
+    islift= true;
+  else if (dim != qh->hull_dim) {
+    qh_fprintf(qh, qh->ferr, 6429, "qhull input error (qh_query_locate_all): points have dimension %d.  Expecting %d%s\n",
+        dim, qh->hull_dim, (qh->DELAUNAY ? " or the input dimension for Delaunay triangulations" : ""));
+    qh_errexit(qh, qh_ERRinput, NULL, NULL);
+  }
+  numthreads= qh_parallelthreads(qh, numpoints);
+  chunk= (numpoints + numthreads - 1) / numthreads;
+  queries= (queryT **)qh_memalloc(qh, numthreads * (int)sizeof(queryT *));
+  for (i=0; i < numthreads; i++)
+    queries[i]= qh_query_new(qh);
+  trace2((qh, qh->ferr, 2116, "qh_query_locate_all: locate %d points of dimension %d with %d threads\n",
+      numpoints, dim, numthreads));
+#if qh_PARALLEL
+#pragma omp parallel for num_threads(numthreads) schedule(static, 1)
+#endif
+  for (i=0; i < numthreads; i++) {
+    queryT *query= queries[i];
+    coordT *point;
+    realT bestdist;
+    bool isoutside;
+    int j, end;
+
+    end= (i+1)*chunk;
+    minimize_(end, numpoints);
+    for (j= i*chunk; j < end; j++) {
+      point= points + j*dim;
+      if (islift)
+        point= qh_query_lift(qh, query, point);
+      bestfacets[j]= qh_query_locate(qh, query, point, bestoutside, &bestdist, &isoutside);
+      if (bestdists)
+        bestdists[j]= bestdist;
+      if (isoutsides)
+        isoutsides[j]= isoutside;
+    }
+  }
+  for (i=0; i < numthreads; i++)
+    qh_query_free(qh, &queries[i]);
+  qh_memfree(qh, queries, numthreads * (int)sizeof(queryT *));
+} /* query_locate_all */
+
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="query_new">-</a>
+
+  qh_query_new(qh)
+    return scratch state for read-only queries of a finished hull (qh_query_locate)
+    allocate one queryT per thread before starting the threads
+
+  returns:
+    queryT from qh_memalloc.  Free with qh_query_free
+    builds qh.locate_grid (qh_locate_build) if needed
+    sets vertex neighbors (qh_vertexneighbors)
+
+  notes:
+    the visit ids and search set are sized for the current hull
+    qh_query_locate returns NULL if the hull changes, e.g., by qh_addpoint or qh_triangulate
+*/
+queryT *qh_query_new(qhT *qh) {
+
+  if (qh->locate_facetid != qh->facet_id)
+    qh_locate_build(qh);
+  qh_vertexneighbors(qh);
+  return qh_query_alloc(qh);
+} /* query_new */
+
 /*-<a                             href="qh-poly.htm#TOC"
   >-------------------------------</a><a name="addfacetvertex">-</a>
 
@@ -3438,6 +5958,7 @@ void qh_resetlists(qhT *qh, bool stats, bool resetVisible /* qh.newvertex_list n
 
   notes:
     unused/untested code: please email bradb@shore.net if this works ok for you
+    if 'QPn' or OpenMP, computes simplicial centers in parallel (qh_setvoronoi_parallel)
 
   use:
     FORALLvertices {...} to locate the vertex for a point.
@@ -3449,6 +5970,8 @@ void qh_setvoronoi_all(qhT *qh) {
   qh_clearcenters(qh, qh_ASvoronoi);
   qh_vertexneighbors(qh);
 
+  if (qh_setvoronoi_parallel(qh))
+    return;
   FORALLfacets {
     if (!facet->normal || !facet->upperdelaunay || qh->UPPERdelaunay) {
       if (!facet->center)
@@ -3457,6 +5980,78 @@ void qh_setvoronoi_all(qhT *qh) {
   }
 } /* setvoronoi_all */
 
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="setvoronoi_parallel">-</a>
+
+  qh_setvoronoi_parallel(qh)
+    compute Voronoi centers for all facets with qh_parallelthreads() threads
+    same facets as qh_setvoronoi_all
+
+  returns:
+    false if not computed (e.g., serial, or not 2-d, 3-d, or 4-d Voronoi)
+    otherwise facet->center is the Voronoi center
+      the same as qh_facetcenter
+
+  notes:
+    called by qh_setvoronoi_all and qh_markvoronoi after qh_clearcenters(qh, qh_ASvoronoi)
+    allocates each facet->center before the parallel section (qh_memalloc is not thread-safe)
+    non-simplicial facets use qh_facetcenter before the parallel section (qh_maxsimplex)
+    each thread calls qh_voronoi_center_fixed for a contiguous range of facets
+
+  design:
+    collect facets without a center, allocating a center for simplicial facets
+    compute the center of non-simplicial facets with qh_facetcenter
+    in parallel, compute the center of each simplicial facet
+*/
+bool qh_setvoronoi_parallel(qhT *qh) {
+  facetT *facet;
+  setT *centerfacets;
+  int i, dim= qh->hull_dim - 1, numfacets, numthreads, chunk;
+
+  if (dim < 2 || dim > 4 || qh->CENTERtype != qh_ASvoronoi)
+    return false;
+  if ((numthreads= qh_parallelthreads(qh, qh->num_facets)) <= 1)
+    return false;
+  centerfacets= qh_settemp(qh, qh->num_facets);
+  FORALLfacets {
+    if (!facet->normal || !facet->upperdelaunay || qh->UPPERdelaunay) {
+      if (facet->center)
+        continue;
+      if (qh_setsize(qh, facet->vertices) != dim+1)
+        facet->center= qh_facetcenter(qh, facet->vertices);
+      else {
+        facet->center= (pointT *)qh_memalloc(qh, qh->center_size);
+        qh_setappend(qh, &centerfacets, facet);
+      }
+    }
+  }
+  numfacets= qh_setsize(qh, centerfacets);
+  chunk= (numfacets + numthreads - 1) / numthreads;
+#if qh_PARALLEL
+#pragma omp parallel for num_threads(numthreads) schedule(static, 1)
+#endif
+  for (i=0; i < numthreads; i++) {
+    facetT *centerfacet;
+    vertexT *vertex, **vertexp;
+    pointT *simplex[5];
+    int j, k, end;
+
+    end= (i+1) * chunk;
+    minimize_(end, numfacets);
+    for (j= i * chunk; j < end; j++) {
+      centerfacet= SETelemt_(centerfacets, j, facetT);
+      k= 0;
+      FOREACHvertex_(centerfacet->vertices)
+        simplex[k++]= vertex->point;
+      qh_voronoi_center_fixed(qh, dim, simplex, centerfacet->center);
+    }
+  }
+  trace2((qh, qh->ferr, 2114, "qh_setvoronoi_parallel: computed %d Voronoi centers with %d threads\n",
+      numfacets, numthreads));
+  qh_settempfree(qh, &centerfacets);
+  return true;
+} /* setvoronoi_parallel */
+
 #ifndef qh_NOmerge
 /*-<a                             href="qh-poly_r.htm#TOC"
   >-------------------------------</a><a name="triangulate">-</a>
@@ -3478,6 +6073,9 @@ void qh_setvoronoi_all(qhT *qh) {
     while running, 'triangulated_facet_list' is a list of
        one non-simplicial facet followed by its 'f.tricoplanar' triangulated facets
     See qh_buildcone
+    the fans are built serially.  qh_memalloc, qh.facet_list, and qh_matchnewfacets are not thread-safe,
+      and the facet ids of the output depend on the order of construction.  The later passes over
+      the fans take less time than a parallel pass with its bookkeeping
 */
 void qh_triangulate(qhT *qh /* qh.facet_list */) {
   facetT *facet, *nextfacet, *owner;
@@ -3867,6 +6465,7 @@ void qh_vertexintersect(qhT *qh, setT **vertexsetA, setT *vertexsetB) {
     called by qh_checkfacet, qh_vertexintersect, qh_rename_sharedvertex, qh_findbest_pinchedvertex, qh_neighbor_intersections
     if !qh.QHULLfinished, non-simplicial facets may have f.vertices with extraneous vertices
        cleaned by qh_remove_extravertices in qh_reduce_vertices
+    merges two short sets in O(|A|+|B|).  A bitset over vertex ids would cost O(qh.num_vertices)
 */
 setT *qh_vertexintersect_new(qhT *qh, setT *vertexsetA, setT *vertexsetB) {
   setT *intersection= qh_setnew(qh, qh->hull_dim - 1);
@@ -562,15 +562,36 @@ facetT *qh_makenewfacet(qhT *qh, setT *vertices, bool toporient, facetT *horizon
 
   notes:
     facet->f.samecycle is defined for facet->mergehorizon facets
+    if 'QPn' and a cone of at least qh_PARALLELmin new facets,
+      qh_setfacetplane_all computes the hyperplanes in parallel
 */
 void qh_makenewplanes(qhT *qh /* qh.newfacet_list */) {
   facetT *newfacet;
+  setT *newfacets;
+  int numnew= 0, numthreads= 1;
 
   trace4((qh, qh->ferr, 4074, "qh_makenewplanes: make new hyperplanes for facets on qh.newfacet_list f%d\n",
     qh->newfacet_list->id));
-  FORALLnew_facets {
-    if (!newfacet->mergehorizon)
-      qh_setfacetplane(qh, newfacet); /* updates Wnewvertexmax */
+  if (qh_PARALLEL && !qh->RANDOMdist && qh->PARALLELthreads != 1) {
+    FORALLnew_facets {
+      if (!newfacet->mergehorizon)
+        numnew++;
+    }
+    numthreads= qh_parallelthreads(qh, numnew);
+  }
+  if (numthreads > 1) {
+    newfacets= qh_settemp(qh, numnew);
+    FORALLnew_facets {
+      if (!newfacet->mergehorizon)
+        qh_setappend(qh, &newfacets, newfacet);
+    }
+    qh_setfacetplane_all(qh, newfacets, numthreads);  /* updates Wnewvertexmax */
+    qh_settempfree(qh, &newfacets);
+  }else {
+    FORALLnew_facets {
+      if (!newfacet->mergehorizon)
+        qh_setfacetplane(qh, newfacet); /* updates Wnewvertexmax */
+    }
   }
   if (qh->JOGGLEmax < REALmax/2)
     minimize_(qh->min_vertex, -wwval_(Wnewvertexmax));
@@ -1172,6 +1193,26 @@ int qh_pointid(qhT *qh, pointT *point) {
   return (int)id;
 } /* pointid */
 
+/*-<a                             href="qh-poly_r.htm#TOC"
+  >-------------------------------</a><a name="pointid_input">-</a>
+
+  qh_pointid_input(qh, point )
+    return the input id of a point
+    if qh.input_ids (qh_new_qhull_outofcore), returns the index of the point in the input file
+    otherwise returns qh_pointid
+
+  notes:
+    returns qh_IDnone, qh_IDinterior, or qh_IDunknown as for qh_pointid
+    input ids may be larger than an int
+*/
+ptr_intT qh_pointid_input(qhT *qh, pointT *point) {
+  int id= qh_pointid(qh, point);
+
+  if (qh && qh->input_ids && id >= 0 && id < qh->num_points)
+    return qh->input_ids[id];
+  return id;
+} /* pointid_input */
+
 /*-<a                             href="qh-poly_r.htm#TOC"
   >-------------------------------</a><a name="removefacet">-</a>
 
@@ -173,6 +173,34 @@ void qh_srand(qhT *qh, int seed) {
         qh->last_random= seed;
 } /* qh_srand */
 
+/*-<a                             href="qh-geom_r.htm#TOC"
+  >-------------------------------</a><a name="randcounter">-</a>
+
+  qh_randcounter( seed, index, draw )
+    generate a pseudo-random number between 0 and qh_RANDOMmax
+    a function of seed, index, and draw only (counter-based)
+
+  notes:
+    for rbox 'X', draw is the 'draw'th random number for point 'index'
+    any point may be generated independently, in any order, by any thread
+    does not use qh.last_random (qh_rand)
+    mixes seed and index, then draw, with the splitmix64 finalizer
+*/
+int qh_randcounter(int seed, int index, int draw) {
+    unsigned long long z;
+
+    z= (unsigned long long)(unsigned int)seed * 0x9E3779B97F4A7C15ULL;
+    z += (unsigned long long)(unsigned int)index * 0xD1B54A32D192ED03ULL + 1;
+    z= (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z= (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z ^= z >> 31;
+    z += (unsigned long long)(unsigned int)draw * 0x9E3779B97F4A7C15ULL;
+    z= (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z= (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z ^= z >> 31;
+    return (int)(z % ((unsigned long long)qh_RANDOMmax + 1));
+} /* randcounter */
+
 /*-<a                             href="qh-geom_r.htm#TOC"
 >-------------------------------</a><a name="randomfactor">-</a>
 
@@ -32,14 +32,39 @@
 #define MAXdim 200
 #define PI 3.1415926535897932384
 
+#define RBOXblock 65536     /* coordinates per block of 'Xn' points, see qh_rboxpoints2 */
+#define RBOXcoincident 256  /* first qh_randcounter draw for 'Cn,r,m' points of a point, MAXdim+5 < 256 */
+
+/* ------------------------------ data structures ----------------*/
+
+/*-<a                             href="qh-qhull_r.htm#TOC"
+  >-------------------------------</a><a name="rboxrandomT">-</a>
+
+  rboxrandomT
+    options for random points in a cube, sphere, lens, or disk ('s', 'Ln', 'Zn', 'Wn', 'Gn')
+    see qh_rboxrandom
+*/
+typedef struct {
+  int     dim;        /* dimension of points */
+  int     gendim;     /* dimension of random coordinates, dim-1 for 'Ln' and 'Zn' */
+  int     numpoints;  /* number of points, for 'l' */
+  int     isaxis, islens, isspiral, issphere, iswidth;
+  double  box, gap, lensbase, radius, width, randmax;
+  int     iscounter;  /* 'X', use qh_randcounter(seed, point index, draw) instead of qh_RANDOMint */
+  int     seed;       /*   seed for qh_randcounter */
+} rboxrandomT;
+
 /* ------------------------------ prototypes ----------------*/
 int qh_roundi(qhT *qh, double a);
 void qh_out1(qhT *qh, double a);
 void qh_out2n(qhT *qh, double a, double b);
 void qh_out3n(qhT *qh, double a, double b, double c);
+void qh_outnl(qhT *qh, int msgcode);
 void qh_outcoord(qhT *qh, int iscdd, double *coord, int dim);
-void qh_outcoincident(qhT *qh, int coincidentpoints, double radius, int iscdd, double *coord, int dim);
-void qh_rboxpoints2(qhT *qh, char* rbox_command, double **simplex);
+void qh_outcoincident(qhT *qh, rboxrandomT *rb, int index, int coincidentpoints, double radius, int iscdd, double *coord, int dim);
+void qh_rboxpoints2(qhT *qh, char* rbox_command, double **simplex, double **block);
+int qh_rboxrand(qhT *qh, rboxrandomT *rb, int index, int *draw);
+void qh_rboxrandom(qhT *qh, rboxrandomT *rb, int index, double *coord);
 
 void    qh_fprintf_rbox(qhT *qh, FILE *fp, int msgcode, const char *fmt, ... );
 void    qh_free(void *mem);
@@ -63,6 +88,7 @@ void    qh_srand(qhT *qh, int seed);
   notes:
     To avoid using stdio, redefine qh_malloc, qh_free, and qh_fprintf_rbox (user_r.c)
     Split out qh_rboxpoints2() to avoid -Wclobbered
+    'X' uses counter-based random numbers (qh_randcounter).  'Xn' generates random points with n threads
 
   design:
     Straight line code (consider defining a struct and functions):
@@ -73,24 +99,82 @@ void    qh_srand(qhT *qh, int seed);
 */
 int qh_rboxpoints(qhT *qh, char* rbox_command) {
   int exitcode;
-  double *simplex;
+  double *simplex, *block;
 
-  simplex= NULL;
+  simplex= block= NULL;
+  qh->rbox_isbuffer= false;
+  qh->rbox_outbuf= qh->rbox_outend= NULL;
   exitcode= setjmp(qh->rbox_errexit);
   if (exitcode) {
     /* same code for error exit and normal return.  qh.NOerrexit is set */
     if (simplex)
       qh_free(simplex);
+    if (block)
+      qh_free(block);
     return exitcode;
   }
-  qh_rboxpoints2(qh, rbox_command, &simplex);
+  qh_rboxpoints2(qh, rbox_command, &simplex, &block);
   /* same code for error exit and normal return */
   if (simplex)
     qh_free(simplex);
+  if (block)
+    qh_free(block);
   return qh_ERRnone;
 } /* rboxpoints */
 
-void qh_rboxpoints2(qhT *qh, char* rbox_command, double **simplex) {
+/*-<a                             href="qh-qhull_r.htm#TOC"
+  >-------------------------------</a><a name="rboxbuffer">-</a>
+
+  qh_rboxbuffer(qh, rbox_command, points, maxcoords, &dimension, &numpoints )
+    Generate points according to rbox options into points[0..maxcoords-1]
+    If points is NULL, only determine dimension and numpoints
+    Report errors on qh.ferr
+
+  returns:
+    same exit codes as qh_rboxpoints
+    dimension and numpoints of the generated points (0 if not determined)
+    qh.rbox_command is the rbox command including its seed, e.g., "rbox 1000 D4 t1234"
+
+  notes:
+    same points as qh_rboxpoints, without formatting and parsing each coordinate
+    coordinates are packed by point, as for qh_new_qhull
+    rounded coordinates for 'z'
+    error if 'h' (cdd format)
+    error if maxcoords < dimension * numpoints
+    'n' (no command line) is ignored
+    qh_fprintf_rbox is only called for errors
+
+  design:
+    qh_rboxpoints2 stops after the header if points is NULL
+    qh_out1, qh_out2n, and qh_out3n store coordinates at qh.rbox_outbuf
+*/
+int qh_rboxbuffer(qhT *qh, char* rbox_command, coordT *points, countT maxcoords, int *dimension, countT *numpoints) {
+  int exitcode;
+  double *simplex, *block;
+
+  simplex= block= NULL;
+  qh->rbox_isbuffer= true;
+  qh->rbox_outbuf= points;
+  qh->rbox_outend= (points ? points+maxcoords : NULL);
+  qh->rbox_outdim= 0;
+  qh->rbox_outcount= 0;
+  exitcode= setjmp(qh->rbox_errexit);
+  if (!exitcode) {
+    qh_rboxpoints2(qh, rbox_command, &simplex, &block);
+  }
+  /* same code for error exit and normal return.  qh.NOerrexit is set */
+  if (simplex)
+    qh_free(simplex);
+  if (block)
+    qh_free(block);
+  *dimension= qh->rbox_outdim;
+  *numpoints= qh->rbox_outcount;
+  qh->rbox_isbuffer= false;
+  qh->rbox_outbuf= qh->rbox_outend= NULL;
+  return exitcode;
+} /* rboxbuffer */
+
+void qh_rboxpoints2(qhT *qh, char* rbox_command, double **simplex, double **block) {
   int i,j,k;
   int gendim;
   int coincidentcount=0, coincidenttotal=0, coincidentpoints=0;
@@ -98,19 +182,20 @@ void qh_rboxpoints2(qhT *qh, char* rbox_command, double **simplex) {
   int dim=3, numpoints=0, totpoints, addpoints=0;
   int issphere=0, isaxis=0,  iscdd=0, islens=0, isregular=0, iswidth=0, addcube=0;
   int isgap=0, isspiral=0, NOcommand=0, adddiamond=0;
-  int israndom=0, istime=0;
+  int israndom=0, istime=0, iscounter=0, numthreads=1, blocksize, blockcount, chunk, thread;
   int isbox=0, issimplex=0, issimplex2=0, ismesh=0;
   double width=0.0, gap=0.0, radius=0.0, coincidentradius=0.0;
   double coord[MAXdim], offset, meshm=3.0, meshn=4.0, meshr=5.0;
-  double *coordp, *simplexp;
+  double *coordp, *simplexp, *blockp;
   int nthroot, mult[MAXdim];
-  double norm, factor, randr, rangap, tempr, lensangle=0, lensbase=1;
+  double norm, factor, randr, tempr, lensangle=0, lensbase=1;
   double anglediff, angle, x, y, cube=0.0, diamond=0.0;
   double box= qh_DEFAULTbox; /* scale all numbers before output */
   double randmax= qh_RANDOMmax;
   char command[250], seedbuf[50];
   char *s=command, *t, *first_point=NULL;
   time_t timedata;
+  rboxrandomT rb;
 
   *command= '\0';
   strncat(command, rbox_command, sizeof(command)-sizeof(seedbuf)-strlen(command)-1);
@@ -172,6 +257,16 @@ void qh_rboxpoints2(qhT *qh, char* rbox_command, double **simplex) {
     case 'x':
       issimplex= 1;
       break;
+    case 'X':
+      iscounter= 1;
+      if (isdigit(*s)) {
+        numthreads= qh_strtol(s, &s);
+        if (numthreads < 1) {
+          qh_fprintf_rbox(qh, qh->ferr, 6434, "rbox error: number of threads for 'Xn' (%d) should be at least 1\n", numthreads);
+          qh_errexit_rbox(qh, qh_ERRinput);
+        }
+      }
+      break;
     case 'y':
       issimplex2= 1;
       break;
@@ -369,6 +464,9 @@ void qh_rboxpoints2(qhT *qh, char* rbox_command, double **simplex) {
       else
         i= *s;
       seed= 11*seed + i;
+      if (*s == 'X')  /* same seed for any number of threads */
+        while (isdigit(s[1]))
+          s++;
     }
   }else if (israndom) {
     seed= (int)time(&timedata);
@@ -379,10 +477,29 @@ void qh_rboxpoints2(qhT *qh, char* rbox_command, double **simplex) {
       strcpy(t+1, t+3); /* remove " t " */
   } /* else, seed explicitly set to n */
   qh_RANDOMseed_(qh, seed);
+  rb.iscounter= iscounter;
+  rb.seed= seed;
 
   /* ============= print header =============== */
 
-  if (iscdd)
+  if (qh->rbox_isbuffer) {
+    if (iscdd) {
+      qh_fprintf_rbox(qh, qh->ferr, 6430, "rbox error: option 'h' (cdd format) is not available for qh_rboxbuffer\n");
+      qh_errexit_rbox(qh, qh_ERRinput);
+    }
+    qh->rbox_command[0]= '\0';
+    strncat(qh->rbox_command, command, sizeof(qh->rbox_command)-1);
+    qh->rbox_outdim= dim;
+    qh->rbox_outcount= totpoints;
+    if (!qh->rbox_outbuf)
+      return;  /* dimension and count only */
+    if ((double)dim * totpoints > (double)(qh->rbox_outend - qh->rbox_outbuf)) {
+      qh_fprintf_rbox(qh, qh->ferr, 6431, "rbox error: qh_rboxbuffer needs %d points of dimension %d, but the buffer has room for %d coordinates\n",
+        totpoints, dim, (int)(qh->rbox_outend - qh->rbox_outbuf));
+      qh_errexit_rbox(qh, qh_ERRinput);
+    }
+    qh->rbox_outend= qh->rbox_outbuf + dim * totpoints;
+  }else if (iscdd)
       qh_fprintf_rbox(qh, qh->fout, 9391, "%s\nbegin\n        %d %d %s\n",
       NOcommand ? "" : command,
       totpoints, dim+1,
@@ -390,7 +507,6 @@ void qh_rboxpoints2(qhT *qh, char* rbox_command, double **simplex) {
   else if (NOcommand)
       qh_fprintf_rbox(qh, qh->fout, 9392, "%d\n%d\n", dim, totpoints);
   else
-      /* qh_fprintf_rbox special cases 9393 to append 'command' to the RboxPoints.comment() */
       qh_fprintf_rbox(qh, qh->fout, 9393, "%d %s\n%d\n", dim, command, totpoints);
 
   /* ============= explicit points =============== */
@@ -417,7 +533,7 @@ void qh_rboxpoints2(qhT *qh, char* rbox_command, double **simplex) {
                   count, dim, s);
         qh_errexit_rbox(qh, qh_ERRinput);
       }
-      qh_fprintf_rbox(qh, qh->fout, 9394, "\n");
+      qh_outnl(qh, 9394);
       while ((s= strchr(s, 'P'))) {
         if (isspace(s[-1]))
           break;
@@ -441,8 +557,9 @@ void qh_rboxpoints2(qhT *qh, char* rbox_command, double **simplex) {
         *(simplexp++)= -1.0;
     }else {
       for (i=0; i<dim+1; i++) {
+        count= 0;
         for (k=0; k<dim; k++) {
-          randr= qh_RANDOMint;
+          randr= qh_rboxrand(qh, &rb, -1-i, &count);  /* simplex vertices are negative indices for 'X' */
           *(simplexp++)= 2.0 * randr/randmax - 1.0;
         }
       }
@@ -454,19 +571,20 @@ void qh_rboxpoints2(qhT *qh, char* rbox_command, double **simplex) {
           qh_out1(qh, 1.0);
         for (k=0; k<dim; k++)
           qh_out1(qh, *(simplexp++) * box);
-        qh_fprintf_rbox(qh, qh->fout, 9395, "\n");
+        qh_outnl(qh, 9395);
       }
     }
     for (j=0; j<numpoints; j++) {
+      count= 0;
       if (iswidth)
-        apex= qh_RANDOMint % (dim+1);
+        apex= qh_rboxrand(qh, &rb, j, &count) % (dim+1);
       else
         apex= -1;
       for (k=0; k<dim; k++)
         coord[k]= 0.0;
       norm= 0.0;
       for (i=0; i<dim+1; i++) {
-        randr= qh_RANDOMint;
+        randr= qh_rboxrand(qh, &rb, j, &count);
         factor= randr/randmax;
         if (i == apex)
           factor *= width;
@@ -480,7 +598,7 @@ void qh_rboxpoints2(qhT *qh, char* rbox_command, double **simplex) {
         coord[k] *= box/norm;
       qh_outcoord(qh, iscdd, coord, dim);
       if(coincidentcount++ < coincidenttotal)
-        qh_outcoincident(qh, coincidentpoints, coincidentradius, iscdd, coord, dim);
+        qh_outcoincident(qh, &rb, j, coincidentpoints, coincidentradius, iscdd, coord, dim);
     }
     isregular= 0; /* continue with isbox */
     numpoints= 0;
@@ -503,7 +621,7 @@ void qh_rboxpoints2(qhT *qh, char* rbox_command, double **simplex) {
       }
       qh_outcoord(qh, iscdd, coord, dim);
       if(coincidentcount++ < coincidenttotal)
-        qh_outcoincident(qh, coincidentpoints, coincidentradius, iscdd, coord, dim);
+        qh_outcoincident(qh, &rb, i, coincidentpoints, coincidentradius, iscdd, coord, dim);
       for (k=0; k < dim; k++) {
         if (++mult[k] < nthroot)
           break;
@@ -615,120 +733,72 @@ void qh_rboxpoints2(qhT *qh, char* rbox_command, double **simplex) {
       for (j=0; j < gendim; j++)
         qh_out1(qh, 0.0);
       qh_out1(qh, -box);
-      qh_fprintf_rbox(qh, qh->fout, 9398, "\n");
+      qh_outnl(qh, 9398);
     }else if (islens)
       gendim= dim-1;
     else
       gendim= dim;
-    /* ============= generate random point in unit cube =============== */
-    for (i=0; i < numpoints; i++) {
-      norm= 0.0;
-      for (j=0; j < gendim; j++) {
-        randr= qh_RANDOMint;
-        coord[j]= 2.0 * randr/randmax - 1.0;
-        norm += coord[j] * coord[j];
-      }
-      norm= sqrt(norm);
-      /* ============= dim-1 point of 'Zn' distribution ========== */
-      if (isaxis) {
-        if (!isgap) {
-          isgap= 1;
-          gap= 1.0;
-        }
-        randr= qh_RANDOMint;
-        rangap= 1.0 - gap * randr/randmax;
-        factor= radius * rangap / norm;
-        for (j=0; j<gendim; j++)
-          coord[j]= factor * coord[j];
-      /* ============= dim-1 point of 'Ln s' distribution =========== */
-      }else if (islens && issphere) {
-        if (!isgap) {
-          isgap= 1;
-          gap= 1.0;
-        }
-        randr= qh_RANDOMint;
-        rangap= 1.0 - gap * randr/randmax;
-        factor= rangap / norm;
-        for (j=0; j<gendim; j++)
-          coord[j]= factor * coord[j];
-      /* ============= dim-1 point of 'Ln' distribution ========== */
-      }else if (islens && !issphere) {
-        if (!isgap) {
-          isgap= 1;
-          gap= 1.0;
-        }
-        j= qh_RANDOMint % gendim;
-        if (coord[j] < 0)
-          coord[j]= -1.0 - coord[j] * gap;
-        else
-          coord[j]= 1.0 - coord[j] * gap;
-      /* ============= point of 'l' distribution =============== */
-      }else if (isspiral) {
-        if (dim != 3) {
-          qh_fprintf_rbox(qh, qh->ferr, 6199, "rbox error: spiral distribution is available only in 3d\n\n");
-          qh_errexit_rbox(qh, qh_ERRinput);
-        }
-        coord[0]= cos(2*PI*i/(numpoints - 1));
-        coord[1]= sin(2*PI*i/(numpoints - 1));
-        coord[2]= 2.0*(double)i/(double)(numpoints - 1) - 1.0;
-      /* ============= point of 's' distribution =============== */
-      }else if (issphere) {
-        factor= 1.0/norm;
-        if (iswidth) {
-          randr= qh_RANDOMint;
-          factor *= 1.0 - width * randr/randmax;
-        }
-        for (j=0; j<dim; j++)
-          coord[j]= factor * coord[j];
+    if ((isaxis || islens) && !isgap) {
+      isgap= 1;
+      gap= 1.0;
+    }
+    if (isspiral && numpoints > 0 && dim != 3) {
+      qh_fprintf_rbox(qh, qh->ferr, 6199, "rbox error: spiral distribution is available only in 3d\n\n");
+      qh_errexit_rbox(qh, qh_ERRinput);
+    }
+    rb.dim= dim;
+    rb.gendim= gendim;
+    rb.numpoints= numpoints;
+    rb.isaxis= isaxis;
+    rb.islens= islens;
+    rb.isspiral= isspiral;
+    rb.issphere= issphere;
+    rb.iswidth= iswidth;
+    rb.box= box;
+    rb.gap= gap;
+    rb.lensbase= lensbase;
+    rb.radius= radius;
+    rb.width= width;
+    rb.randmax= randmax;
+    /* ============= generate random points in unit cube, by blocks for 'Xn' =============== */
+    if (iscounter && numthreads > 1 && numpoints > 0) {
+      blocksize= RBOXblock/dim;
+      if (blocksize < numthreads)
+        blocksize= numthreads;
+      if (!(*block= (double *)qh_malloc((size_t)(blocksize * dim) * sizeof(double)))) {
+        qh_fprintf_rbox(qh, qh->ferr, 6435, "rbox error: insufficient memory for %d points of 'Xn'\n", blocksize);
+        qh_errexit_rbox(qh, qh_ERRmem);
       }
-      /* ============= project 'Zn s' point in to sphere =============== */
-      if (isaxis && issphere) {
-        coord[dim-1]= 1.0;
-        norm= 1.0;
-        for (j=0; j<gendim; j++)
-          norm += coord[j] * coord[j];
-        norm= sqrt(norm);
-        for (j=0; j<dim; j++)
-          coord[j]= coord[j] / norm;
-        if (iswidth) {
-          randr= qh_RANDOMint;
-          coord[dim-1] *= 1 - width * randr/randmax;
-        }
-      /* ============= project 'Zn' point onto cube =============== */
-      }else if (isaxis && !issphere) {  /* not very interesting */
-        randr= qh_RANDOMint;
-        coord[dim-1]= 2.0 * randr/randmax - 1.0;
-      /* ============= project 'Ln' point out to sphere =============== */
-      }else if (islens) {
-        coord[dim-1]= lensbase;
-        for (j=0, norm= 0; j<dim; j++)
-          norm += coord[j] * coord[j];
-        norm= sqrt(norm);
-        for (j=0; j<dim; j++)
-          coord[j]= coord[j] * radius/ norm;
-        coord[dim-1] -= lensbase;
-        if (iswidth) {
-          randr= qh_RANDOMint;
-          coord[dim-1] *= 1 - width * randr/randmax;
+    }else
+      blocksize= 1;
+    for (i=0; i < numpoints; i += blocksize) {
+      if (!*block) {
+        qh_rboxrandom(qh, &rb, i, coord);
+        blockcount= 1;
+        blockp= coord;
+      }else {
+        blockcount= (numpoints - i < blocksize ? numpoints - i : blocksize);
+        chunk= (blockcount + numthreads - 1)/numthreads;
+#if qh_PARALLEL
+#pragma omp parallel for num_threads(numthreads) schedule(static, 1)
+#endif
+        for (thread=0; thread < numthreads; thread++) {
+          int p, end;  /* private */
+
+          end= (thread+1) * chunk;
+          if (end > blockcount)
+            end= blockcount;
+          for (p= thread * chunk; p < end; p++)
+            qh_rboxrandom(qh, &rb, i+p, *block + p*dim);
         }
-        if (qh_RANDOMint > randmax/2)
-          coord[dim-1]= -coord[dim-1];
-      /* ============= project 'Wn' point toward boundary =============== */
-      }else if (iswidth && !issphere) {
-        j= qh_RANDOMint % gendim;
-        if (coord[j] < 0)
-          coord[j]= -1.0 - coord[j] * width;
-        else
-          coord[j]= 1.0 - coord[j] * width;
+        blockp= *block;
       }
-      /* ============= scale point to box =============== */
-      for (k=0; k<dim; k++)
-          coord[k]= coord[k] * box;
-
       /* ============= write output =============== */
-      qh_outcoord(qh, iscdd, coord, dim);
-      if(coincidentcount++ < coincidenttotal)
-        qh_outcoincident(qh, coincidentpoints, coincidentradius, iscdd, coord, dim);
+      for (j=0; j < blockcount; j++, blockp += dim) {
+        qh_outcoord(qh, iscdd, blockp, dim);
+        if(coincidentcount++ < coincidenttotal)
+          qh_outcoincident(qh, &rb, i+j, coincidentpoints, coincidentradius, iscdd, blockp, dim);
+      }
     }
   }
 
@@ -743,7 +813,7 @@ void qh_rboxpoints2(qhT *qh, char* rbox_command, double **simplex) {
         else
           qh_out1(qh, -cube);
       }
-      qh_fprintf_rbox(qh, qh->fout, 9400, "\n");
+      qh_outnl(qh, 9400);
     }
   }
 
@@ -760,14 +830,143 @@ void qh_rboxpoints2(qhT *qh, char* rbox_command, double **simplex) {
         else
           qh_out1(qh, -diamond);
       }
-      qh_fprintf_rbox(qh, qh->fout, 9401, "\n");
+      qh_outnl(qh, 9401);
     }
   }
 
   if (iscdd)
     qh_fprintf_rbox(qh, qh->fout, 9402, "end\nhull\n");
+  if (qh->rbox_isbuffer && qh->rbox_outbuf != qh->rbox_outend) {
+    qh_fprintf_rbox(qh, qh->ferr, 6432, "rbox internal error (qh_rboxbuffer): generated %d fewer coordinates than %d points of dimension %d\n",
+      (int)(qh->rbox_outend - qh->rbox_outbuf), totpoints, dim);
+    qh_errexit_rbox(qh, qh_ERRqhull);
+  }
 } /* rboxpoints2 */
 
+/*-<a                             href="qh-qhull_r.htm#TOC"
+  >-------------------------------</a><a name="rboxrand">-</a>
+
+  qh_rboxrand(qh, rb, index, &draw )
+    return a random integer between 0 and qh_RANDOMmax for point 'index'
+
+  returns:
+    increments draw
+
+  notes:
+    for 'X', returns qh_randcounter(seed, index, draw), otherwise qh_RANDOMint
+*/
+int qh_rboxrand(qhT *qh, rboxrandomT *rb, int index, int *draw) {
+
+  if (rb->iscounter)
+    return qh_randcounter(rb->seed, index, (*draw)++);
+  return qh_RANDOMint;
+} /* rboxrand */
+
+/*-<a                             href="qh-qhull_r.htm#TOC"
+  >-------------------------------</a><a name="rboxrandom">-</a>
+
+  qh_rboxrandom(qh, rb, index, coord )
+    set coord[0..dim-1] to random point 'index' of rb's distribution
+
+  notes:
+    for 'X', a function of rb and index only.  Thread-safe
+    otherwise, call for index 0..numpoints-1 in order (qh_RANDOMint)
+    qh_rboxpoints2 checks the options, including 'l' in 3-d
+*/
+void qh_rboxrandom(qhT *qh, rboxrandomT *rb, int index, double *coord) {
+  double norm, factor, randr, rangap;
+  int j, k, draw= 0;
+
+  norm= 0.0;
+  for (j=0; j < rb->gendim; j++) {
+    randr= qh_rboxrand(qh, rb, index, &draw);
+    coord[j]= 2.0 * randr/rb->randmax - 1.0;
+    norm += coord[j] * coord[j];
+  }
+  norm= sqrt(norm);
+  /* ============= dim-1 point of 'Zn' distribution ========== */
+  if (rb->isaxis) {
+    randr= qh_rboxrand(qh, rb, index, &draw);
+    rangap= 1.0 - rb->gap * randr/rb->randmax;
+    factor= rb->radius * rangap / norm;
+    for (j=0; j<rb->gendim; j++)
+      coord[j]= factor * coord[j];
+  /* ============= dim-1 point of 'Ln s' distribution =========== */
+  }else if (rb->islens && rb->issphere) {
+    randr= qh_rboxrand(qh, rb, index, &draw);
+    rangap= 1.0 - rb->gap * randr/rb->randmax;
+    factor= rangap / norm;
+    for (j=0; j<rb->gendim; j++)
+      coord[j]= factor * coord[j];
+  /* ============= dim-1 point of 'Ln' distribution ========== */
+  }else if (rb->islens && !rb->issphere) {
+    j= qh_rboxrand(qh, rb, index, &draw) % rb->gendim;
+    if (coord[j] < 0)
+      coord[j]= -1.0 - coord[j] * rb->gap;
+    else
+      coord[j]= 1.0 - coord[j] * rb->gap;
+  /* ============= point of 'l' distribution =============== */
+  }else if (rb->isspiral) {
+    coord[0]= cos(2*PI*index/(rb->numpoints - 1));
+    coord[1]= sin(2*PI*index/(rb->numpoints - 1));
+    coord[2]= 2.0*(double)index/(double)(rb->numpoints - 1) - 1.0;
+  /* ============= point of 's' distribution =============== */
+  }else if (rb->issphere) {
+    factor= 1.0/norm;
+    if (rb->iswidth) {
+      randr= qh_rboxrand(qh, rb, index, &draw);
+      factor *= 1.0 - rb->width * randr/rb->randmax;
+    }
+    for (j=0; j<rb->dim; j++)
+      coord[j]= factor * coord[j];
+  }
+  /* ============= project 'Zn s' point in to sphere =============== */
+  if (rb->isaxis && rb->issphere) {
+    coord[rb->dim-1]= 1.0;
+    norm= 1.0;
+    for (j=0; j<rb->gendim; j++)
+      norm += coord[j] * coord[j];
+    norm= sqrt(norm);
+    for (j=0; j<rb->dim; j++)
+      coord[j]= coord[j] / norm;
+    if (rb->iswidth) {
+      randr= qh_rboxrand(qh, rb, index, &draw);
+      coord[rb->dim-1] *= 1 - rb->width * randr/rb->randmax;
+    }
+  /* ============= project 'Zn' point onto cube =============== */
+  }else if (rb->isaxis && !rb->issphere) {  /* not very interesting */
+    randr= qh_rboxrand(qh, rb, index, &draw);
+    coord[rb->dim-1]= 2.0 * randr/rb->randmax - 1.0;
+  /* ============= project 'Ln' point out to sphere =============== */
+  }else if (rb->islens) {
+    coord[rb->dim-1]= rb->lensbase;
+    for (j=0, norm= 0; j<rb->dim; j++)
+      norm += coord[j] * coord[j];
+    norm= sqrt(norm);
+    for (j=0; j<rb->dim; j++)
+      coord[j]= coord[j] * rb->radius/ norm;
+    coord[rb->dim-1] -= rb->lensbase;
+    if (rb->iswidth) {
+      randr= qh_rboxrand(qh, rb, index, &draw);
+      coord[rb->dim-1] *= 1 - rb->width * randr/rb->randmax;
+    }
+    if (qh_rboxrand(qh, rb, index, &draw) > rb->randmax/2)
+      coord[rb->dim-1]= -coord[rb->dim-1];
+  /* ============= project 'Wn' point toward boundary =============== */
+  }else if (rb->iswidth && !rb->issphere) {
+    j= qh_rboxrand(qh, rb, index, &draw) % rb->gendim;
+    if (coord[j] < 0)
+      coord[j]= -1.0 - coord[j] * rb->width;
+    else
+      coord[j]= 1.0 - coord[j] * rb->width;
+  }
+  /* ============= scale point to box =============== */
+  for (k=0; k<rb->dim; k++)
+    coord[k]= coord[k] * rb->box;
+
+
+} /* rboxrandom */
+
 /*------------------------------------------------
 outxxx - output functions for qh_rboxpoints
 */
@@ -789,7 +988,17 @@ int qh_roundi(qhT *qh, double a) {
 
 void qh_out1(qhT *qh, double a) {
 
-  if (qh->rbox_isinteger)
+  if (qh->rbox_isbuffer) {
+    if (qh->rbox_outbuf >= qh->rbox_outend) {
+      qh_fprintf_rbox(qh, qh->ferr, 6433, "rbox internal error (qh_rboxbuffer): more coordinates than %d points of dimension %d\n",
+        qh->rbox_outcount, qh->rbox_outdim);
+      qh_errexit_rbox(qh, qh_ERRqhull);
+    }
+    if (qh->rbox_isinteger)
+      *(qh->rbox_outbuf++)= (coordT)qh_roundi(qh, a+qh->rbox_out_offset);
+    else
+      *(qh->rbox_outbuf++)= (coordT)(a+qh->rbox_out_offset);
+  }else if (qh->rbox_isinteger)
     qh_fprintf_rbox(qh, qh->fout, 9403, "%d ", qh_roundi(qh, a+qh->rbox_out_offset));
   else
     qh_fprintf_rbox(qh, qh->fout, 9404, qh_REAL_1, a+qh->rbox_out_offset);
@@ -797,7 +1006,10 @@ void qh_out1(qhT *qh, double a) {
 
 void qh_out2n(qhT *qh, double a, double b) {
 
-  if (qh->rbox_isinteger)
+  if (qh->rbox_isbuffer) {
+    qh_out1(qh, a);
+    qh_out1(qh, b);
+  }else if (qh->rbox_isinteger)
     qh_fprintf_rbox(qh, qh->fout, 9405, "%d %d\n", qh_roundi(qh, a+qh->rbox_out_offset), qh_roundi(qh, b+qh->rbox_out_offset));
   else
     qh_fprintf_rbox(qh, qh->fout, 9406, qh_REAL_2n, a+qh->rbox_out_offset, b+qh->rbox_out_offset);
@@ -805,12 +1017,22 @@ void qh_out2n(qhT *qh, double a, double b) {
 
 void qh_out3n(qhT *qh, double a, double b, double c) {
 
-  if (qh->rbox_isinteger)
+  if (qh->rbox_isbuffer) {
+    qh_out1(qh, a);
+    qh_out1(qh, b);
+    qh_out1(qh, c);
+  }else if (qh->rbox_isinteger)
     qh_fprintf_rbox(qh, qh->fout, 9407, "%d %d %d\n", qh_roundi(qh, a+qh->rbox_out_offset), qh_roundi(qh, b+qh->rbox_out_offset), qh_roundi(qh, c+qh->rbox_out_offset));
   else
     qh_fprintf_rbox(qh, qh->fout, 9408, qh_REAL_3n, a+qh->rbox_out_offset, b+qh->rbox_out_offset, c+qh->rbox_out_offset);
 } /* qh_out3n */
 
+void qh_outnl(qhT *qh, int msgcode) {
+
+  if (!qh->rbox_isbuffer)
+    qh_fprintf_rbox(qh, qh->fout, msgcode, "\n");
+} /* qh_outnl */
+
 void qh_outcoord(qhT *qh, int iscdd, double *coord, int dim) {
     double *p= coord;
     int k;
@@ -819,13 +1041,13 @@ void qh_outcoord(qhT *qh, int iscdd, double *coord, int dim) {
       qh_out1(qh, 1.0);
     for (k=0; k < dim; k++)
       qh_out1(qh, *(p++));
-    qh_fprintf_rbox(qh, qh->fout, 9396, "\n");
+    qh_outnl(qh, 9396);
 } /* qh_outcoord */
 
-void qh_outcoincident(qhT *qh, int coincidentpoints, double radius, int iscdd, double *coord, int dim) {
+void qh_outcoincident(qhT *qh, rboxrandomT *rb, int index, int coincidentpoints, double radius, int iscdd, double *coord, int dim) {
   double *p;
   double randr, delta;
-  int i,k;
+  int i,k, draw= RBOXcoincident;
   double randmax= qh_RANDOMmax;
 
   for (i=0; i<coincidentpoints; i++) {
@@ -833,12 +1055,12 @@ void qh_outcoincident(qhT *qh, int coincidentpoints, double radius, int iscdd, d
     if (iscdd)
       qh_out1(qh, 1.0);
     for (k=0; k < dim; k++) {
-      randr= qh_RANDOMint;
+      randr= qh_rboxrand(qh, rb, index, &draw);
       delta= 2.0 * randr/randmax - 1.0; /* -1..+1 */
       delta *= radius;
       qh_out1(qh, *(p++) + delta);
     }
-    qh_fprintf_rbox(qh, qh->fout, 9410, "\n");
+    qh_outnl(qh, 9410);
   }
 } /* qh_outcoincident */
 
@@ -13,6 +13,22 @@
 
 #include <qhull/qhull_ra.h>
 
+#if qh_PERFCOUNTERS
+#include <errno.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/*============= internal functions ==============*/
+
+static int qh_compare_profiletime(const void *p1, const void *p2);
+static void qh_perfsample(qhT *qh, int phase);
+
+static const char *qh_phasenames[qh_PHASEend]= {"other", "read", "project", "simplex",
+      "partition", "build", "merge", "triangulate", "check", "output"};
+
 /*========== functions in alphabetic order ================*/
 
 /*-<a                             href="qh-stat_r.htm#TOC"
@@ -86,6 +102,8 @@ void qh_allstatC(qhT *qh) {
   zzdef_(zinc, Zprocessed, "points processed", -1);
   zzdef_(zinc, Zretry, "retries due to precision problems", -1);
   zdef_(wmax, Wretrymax, "  max. random joggle", -1);
+  zdef_(wadd, Wretrytime, "  wall-clock seconds lost to restarts", -1);
+  zdef_(zinc, Zretrysimplex, "  restarts that reused the initial simplex ('Q16')", -1);
   zdef_(zmax, Zmaxvertex, "max. vertices at any one time", -1);
   zdef_(zinc, Ztotvisible, "ave. visible facets per iteration", Zprocessed);
   zdef_(zinc, Zinsidevisible, "  ave. visible facets without an horizon neighbor", Zprocessed);
@@ -439,6 +457,18 @@ void qh_collectstatistics(qhT *qh) {
 } /* collectstatistics */
 #endif /* qh_KEEPstatistics */
 
+/*-<a                             href="qh-stat_r.htm#TOC"
+  >-------------------------------</a><a name="compare_profiletime">-</a>
+
+  qh_compare_profiletime( p1, p2 )
+    used by qsort to sort qh.profile_addtime in increasing order
+*/
+static int qh_compare_profiletime(const void *p1, const void *p2) {
+  double t1= *((const double *)p1), t2= *((const double *)p2);
+
+  return (t1 > t2) - (t1 < t2);
+} /* compare_profiletime */
+
 /*-<a                             href="qh-stat_r.htm#TOC"
   >-------------------------------</a><a name="initstatistics">-</a>
 
@@ -542,6 +572,123 @@ bool qh_nostatistic(qhT *qh, int i) {
   return false;
 } /* nostatistic */
 
+/*-<a                             href="qh-stat_r.htm#TOC"
+  >-------------------------------</a><a name="perfsample">-</a>
+
+  qh_perfsample(qh, phase )
+    charge the hardware counts since the last sample to qh_PHASE phase
+
+  notes:
+    called by qh_profilephase if qh.PERFactive
+    one read() of the counter group.  Its values are in the order of the open counters.
+*/
+static void qh_perfsample(qhT *qh, int phase) {
+#if qh_PERFCOUNTERS
+  unsigned long long values[1 + qh_PERFend];  /* number of values, then a value for each open counter */
+  int i, k= 1;
+
+  if (read(qh->perf_fd[qh_PERFcycles], values, sizeof(values)) < (ssize_t)sizeof(values[0]))
+    return;
+  for (i=0; i < qh_PERFend; i++) {
+    if (qh->perf_fd[i] >= 0 && k <= (int)values[0]) {
+      qh->perf_count[phase][i] += (long long)values[k] - qh->perf_last[i];
+      qh->perf_last[i]= (long long)values[k++];
+    }
+  }
+#else
+  QHULL_UNUSED(qh)
+  QHULL_UNUSED(phase)
+#endif
+} /* perfsample */
+
+/*-<a                             href="qh-stat_r.htm#TOC"
+  >-------------------------------</a><a name="perfstart">-</a>
+
+  qh_perfstart(qh )
+    if qh_PERFCOUNTERS, open and enable the hardware counters of qh_PERF
+
+  returns:
+    sets qh.PERFactive if the cycle counter is available
+    clears qh.perf_count
+    nop if qh_PERFCOUNTERS=0
+
+  notes:
+    called by qh_initflags for 'Ts' and 'Tj'
+    counts user-mode events of the calling thread (pid 0, cpu -1)
+    a counter that is not supported by the processor has perf_fd -1 and prints as '-'
+    warning 7103 if the kernel refuses the cycle counter, e.g., /proc/sys/kernel/perf_event_paranoid
+
+  design:
+    open the cycle counter as a disabled group leader
+    open the other counters in its group
+    reset and enable the group
+*/
+void qh_perfstart(qhT *qh) {
+#if qh_PERFCOUNTERS
+  static const unsigned long long config[qh_PERFend]= {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+      PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+  struct perf_event_attr attr;
+  int i;
+
+  qh_perfstop(qh);
+  memset((char *)qh->perf_count, 0, sizeof(qh->perf_count));
+  for (i=0; i < qh_PERFend; i++) {
+    qh->perf_fd[i]= -1;
+    qh->perf_last[i]= 0;
+  }
+  for (i=0; i < qh_PERFend; i++) {
+    memset((char *)&attr, 0, sizeof(attr));
+    attr.type= PERF_TYPE_HARDWARE;
+    attr.size= sizeof(attr);
+    attr.config= config[i];
+    attr.disabled= (i == qh_PERFcycles);
+    attr.exclude_kernel= 1;
+    attr.exclude_hv= 1;
+    attr.read_format= PERF_FORMAT_GROUP;
+    qh->perf_fd[i]= (int)syscall(__NR_perf_event_open, &attr, 0, -1, qh->perf_fd[qh_PERFcycles], 0);
+    if (qh->perf_fd[qh_PERFcycles] < 0) {
+      qh_fprintf(qh, qh->ferr, 7103, "qhull warning (qh_perfstart): hardware counters of qh_PERFCOUNTERS are not available (perf_event_open errno %d).  See /proc/sys/kernel/perf_event_paranoid\n",
+        errno);
+      return;
+    }
+  }
+  ioctl(qh->perf_fd[qh_PERFcycles], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ioctl(qh->perf_fd[qh_PERFcycles], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  qh->PERFactive= true;
+#else
+  QHULL_UNUSED(qh)
+#endif
+} /* perfstart */
+
+/*-<a                             href="qh-stat_r.htm#TOC"
+  >-------------------------------</a><a name="perfstop">-</a>
+
+  qh_perfstop(qh )
+    close the hardware counters of qh_perfstart
+
+  returns:
+    clears qh.PERFactive.  Keeps qh.perf_count.
+
+  notes:
+    called by qh_freebuffers
+*/
+void qh_perfstop(qhT *qh) {
+#if qh_PERFCOUNTERS
+  int i;
+
+  if (qh->PERFactive) {
+    for (i=0; i < qh_PERFend; i++) {
+      if (qh->perf_fd[i] >= 0)
+        close(qh->perf_fd[i]);
+      qh->perf_fd[i]= -1;
+    }
+    qh->PERFactive= false;
+  }
+#else
+  QHULL_UNUSED(qh)
+#endif
+} /* perfstop */
+
 #if qh_KEEPstatistics
 /*-<a                             href="qh-stat_r.htm#TOC"
   >-------------------------------</a><a name="printallstatistics">-</a>
@@ -620,9 +767,155 @@ qhull invoked by: %s | %s\n  %s with options:\n%s\n",
   qh_fprintf(qh, fp, 9359, "\n\n");
   for(i=0 ; i < qh->qhstat.next; )
     qh_printstats(qh, fp, i, &i);
+  qh_printperfcounters(qh, fp);
 } /* printstatistics */
 #endif /* qh_KEEPstatistics */
 
+/*-<a                             href="qh-stat_r.htm#TOC"
+  >-------------------------------</a><a name="printperfcounters">-</a>
+
+  qh_printperfcounters(qh, fp )
+    print the hardware counters of qh_PERFCOUNTERS by qh_PHASE
+
+  returns:
+    charges the current phase up to now
+    nop if not qh.PERFactive
+
+  notes:
+    called by qh_printstatistics ('Ts')
+    skips phases without cycles.  '-' is a counter that is not available.
+    IPC is instructions per cycle
+*/
+void qh_printperfcounters(qhT *qh, FILE *fp) {
+  static const char *perfnames[qh_PERFend]= {"cycles", "instructions", "cache-misses", "branch-misses"};
+  long long total[qh_PERFend];
+  long long *count;
+  int i, k;
+
+  if (!qh->PERFactive)
+    return;
+  qh_profilephase(qh, qh->profile_phase);
+  qh_fprintf(qh, fp, 9447, "\nhardware counters by phase (qh_PERFCOUNTERS, user mode of the calling thread):\n %-12s", "phase");
+  for (k=0; k < qh_PERFend; k++) {
+    qh_fprintf(qh, fp, 9448, " %14s", perfnames[k]);
+    total[k]= 0;
+  }
+  qh_fprintf(qh, fp, 9449, " %6s\n", "IPC");
+  for (i=0; i <= qh_PHASEend; i++) {
+    if (i == qh_PHASEend)
+      count= total;
+    else {
+      count= qh->perf_count[i];
+      if (count[qh_PERFcycles] == 0)
+        continue;
+      for (k=0; k < qh_PERFend; k++)
+        total[k] += count[k];
+    }
+    qh_fprintf(qh, fp, 9450, " %-12s", (i == qh_PHASEend ? "total" : qh_phasenames[i]));
+    for (k=0; k < qh_PERFend; k++) {
+      if (qh->perf_fd[k] < 0)
+        qh_fprintf(qh, fp, 9451, " %14s", "-");
+      else
+        qh_fprintf(qh, fp, 9452, " %14lld", count[k]);
+    }
+    if (qh->perf_fd[qh_PERFinstructions] < 0 || count[qh_PERFcycles] == 0)
+      qh_fprintf(qh, fp, 9453, " %6s\n", "-");
+    else
+      qh_fprintf(qh, fp, 9454, " %6.2f\n", (double)count[qh_PERFinstructions] / (double)count[qh_PERFcycles]);
+  }
+} /* printperfcounters */
+
+/*-<a                             href="qh-stat_r.htm#TOC"
+  >-------------------------------</a><a name="printprofile">-</a>
+
+  qh_printprofile(qh, fp )
+    print the wall-clock profile of option 'Tj' as a JSON object
+
+  returns:
+    charges the current phase up to now
+    sorts qh.profile_addtime
+
+  notes:
+    called by the qhull programs after qh_check_points and by qh_new_qhull
+    "seconds" is wall-clock time by qh_PHASE.  Its "total" is the sum of the phases.
+    "addpoint" is the time of each qh_addpoint by qh_buildhull, including retries of 'QJ'
+      percentiles are nearest rank
+    "counters" are statistics that remain defined if qh_KEEPstatistics=0
+      Zpartition is zero if qh_KEEPstatistics=0
+    an error exit before qh_printprofile does not print a profile
+
+  design:
+    charge the current phase
+    escape qh.rbox_command and qh.qhull_command as JSON strings
+    print the hull size, phase times, qh_addpoint percentiles, and counters
+*/
+void qh_printprofile(qhT *qh, FILE *fp) {
+  static const char *perfnames[qh_PERFend]= {"cycles", "instructions", "cache_misses", "branch_misses"};
+  static const int percentiles[]= {50, 90, 99};
+  char rboxcommand[2*sizeof(qh->rbox_command)], qhullcommand[2*sizeof(qh->qhull_command)];
+  char *t;
+  const char *s;
+  double total= 0.0, addtotal= 0.0, *addtime= qh->profile_addtime;
+  int i, k, numadd= qh->profile_addcount;
+  bool isfirst= true;
+
+  qh_profilephase(qh, qh->profile_phase);
+  for (k=0; k < 2; k++) {
+    s= (k == 0 ? qh->rbox_command : qh->qhull_command);
+    t= (k == 0 ? rboxcommand : qhullcommand);
+    while (*s) {
+      if (*s == '"' || *s == '\\')
+        *t++= '\\';
+      *t++= (isspace(*s) ? ' ' : *s);
+      s++;
+    }
+    *t= '\0';
+  }
+  qh_fprintf(qh, fp, 9428, "{\n  \"qhull_profile\": 1,\n  \"version\": \"%s\",\n", qh_version);
+  qh_fprintf(qh, fp, 9429, "  \"rbox_command\": \"%s\",\n  \"qhull_command\": \"%s\",\n", rboxcommand, qhullcommand);
+  qh_fprintf(qh, fp, 9430, "  \"hull_dim\": %d, \"num_points\": %d, \"num_facets\": %d, \"num_vertices\": %d, \"builds\": %d,\n",
+    qh->hull_dim, qh->num_points + qh_setsize(qh, qh->other_points), qh->num_facets, qh->num_vertices, qh->build_cnt);
+  qh_fprintf(qh, fp, 9431, "  \"seconds\": {");
+  for (i=0; i < qh_PHASEend; i++) {
+    qh_fprintf(qh, fp, 9432, "\"%s\": %.9f, ", qh_phasenames[i], qh->profile_time[i]);
+    total += qh->profile_time[i];
+  }
+  qh_fprintf(qh, fp, 9433, "\"total\": %.9f},\n", total);
+  qh_fprintf(qh, fp, 9434, "  \"addpoint\": {\"count\": %d", numadd);
+  if (numadd > 0) {
+    qsort(addtime, (size_t)numadd, sizeof(double), qh_compare_profiletime);
+    for (i=0; i < numadd; i++)
+      addtotal += addtime[i];
+    qh_fprintf(qh, fp, 9435, ", \"total\": %.9f, \"mean\": %.9f", addtotal, addtotal/numadd);
+    for (k=0; k < (int)(sizeof(percentiles)/sizeof(int)); k++) {
+      i= (int)ceil(percentiles[k] * (double)numadd / 100.0) - 1;
+      qh_fprintf(qh, fp, 9436, ", \"p%d\": %.9f", percentiles[k], addtime[(i < 0 ? 0 : i)]);
+    }
+    qh_fprintf(qh, fp, 9437, ", \"max\": %.9f", addtime[numadd-1]);
+  }
+  qh_fprintf(qh, fp, 9438, "},\n");
+  qh_fprintf(qh, fp, 9439, "  \"counters\": {\"Zprocessed\": %d, \"Zsetplane\": %d, \"Zdistplane\": %d, \"Zpartition\": %d, \"Ztotmerge\": %d, \"Zretry\": %d}",
+    zzval_(Zprocessed), zzval_(Zsetplane), zzval_(Zdistplane), zzval_(Zpartition), zzval_(Ztotmerge), zzval_(Zretry));
+  if (qh->PERFactive) {
+    qh_fprintf(qh, fp, 9440, ",\n  \"hardware\": {");
+    for (i=0; i < qh_PHASEend; i++) {
+      if (qh->perf_count[i][qh_PERFcycles] == 0)
+        continue;
+      qh_fprintf(qh, fp, 9441, "%s\n    \"%s\": {", (isfirst ? "" : ","), qh_phasenames[i]);
+      isfirst= false;
+      for (k=0; k < qh_PERFend; k++) {
+        if (qh->perf_fd[k] < 0)
+          qh_fprintf(qh, fp, 9442, "%s\"%s\": null", (k ? ", " : ""), perfnames[k]);
+        else
+          qh_fprintf(qh, fp, 9443, "%s\"%s\": %lld", (k ? ", " : ""), perfnames[k], qh->perf_count[i][k]);
+      }
+      qh_fprintf(qh, fp, 9444, "}");
+    }
+    qh_fprintf(qh, fp, 9445, "}");
+  }
+  qh_fprintf(qh, fp, 9446, "\n}\n");
+} /* printprofile */
+
 /*-<a                             href="qh-stat_r.htm#TOC"
   >-------------------------------</a><a name="printstatlevel">-</a>
 
@@ -679,6 +972,68 @@ void qh_printstats(qhT *qh, FILE *fp, int idx, int *nextindex) {
     *nextindex= nexti;
 } /* printstats */
 
+/*-<a                             href="qh-stat_r.htm#TOC"
+  >-------------------------------</a><a name="profileaddpoint">-</a>
+
+  qh_profileaddpoint(qh, starttime )
+    for 'Tj', append the wall-clock time since starttime to qh.profile_addtime
+
+  notes:
+    called by qh_buildhull after each qh_addpoint
+    qh.profile_addtime is allocated by qh_malloc and freed by qh_freebuffers
+    reserves qh.num_points times, doubling as needed
+*/
+void qh_profileaddpoint(qhT *qh, double starttime) {
+  double endtime= qh_wallclock(), *addtime;
+  int newsize;
+
+  if (qh->profile_addcount >= qh->profile_addsize) {
+    newsize= (qh->profile_addsize ? 2 * qh->profile_addsize : qh->num_points + 16);
+    if (!(addtime= (double *)qh_malloc((size_t)newsize * sizeof(double)))) {
+      qh_fprintf(qh, qh->ferr, 6442, "qhull error (qh_profileaddpoint): insufficient memory for %d qh_addpoint times of 'Tj'\n",
+        newsize);
+      qh_errexit(qh, qh_ERRmem, NULL, NULL);
+    }
+    if (qh->profile_addtime) {
+      memcpy((char *)addtime, (char *)qh->profile_addtime, (size_t)qh->profile_addcount * sizeof(double));
+      qh_free(qh->profile_addtime);
+    }
+    qh->profile_addtime= addtime;
+    qh->profile_addsize= newsize;
+  }
+  qh->profile_addtime[qh->profile_addcount++]= endtime - starttime;
+} /* profileaddpoint */
+
+/*-<a                             href="qh-stat_r.htm#TOC"
+  >-------------------------------</a><a name="profilephase">-</a>
+
+  qh_profilephase(qh, phase )
+    start qh_PHASE phase for the wall-clock profile of option 'Tj'
+
+  returns:
+    previous phase, for restoring the caller's phase
+    if 'Tj', adds the wall-clock time since the previous call to the previous phase
+    if qh.PERFactive, adds the hardware counts since the previous call to the previous phase
+
+  notes:
+    time is exclusive.  A nested phase is not charged to its caller.
+    qh_printprofile prints qh.profile_time
+*/
+int qh_profilephase(qhT *qh, int phase) {
+  int prevphase= qh->profile_phase;
+  double now;
+
+  if (qh->PRINTprofile) {
+    now= qh_wallclock();
+    qh->profile_time[prevphase] += now - qh->profile_start;
+    qh->profile_start= now;
+  }
+  if (qh->PERFactive)
+    qh_perfsample(qh, prevphase);
+  qh->profile_phase= phase;
+  return prevphase;
+} /* profilephase */
+
 #if qh_KEEPstatistics
 
 /*-<a                             href="qh-stat_r.htm#TOC"
@@ -725,3 +1080,29 @@ void    qh_printallstatistics(qhT *qh, FILE *fp, const char *string) {}
 void    qh_printstatistics(qhT *qh, FILE *fp, const char *string) {}
 #endif
 
+/*-<a                             href="qh-stat_r.htm#TOC"
+  >-------------------------------</a><a name="wallclock">-</a>
+
+  qh_wallclock()
+    return wall-clock time in seconds from an arbitrary origin
+
+  notes:
+    for the profile of option 'Tj'.  qh_CPUclock is processor time with low resolution.
+    uses a monotonic clock if available (POSIX), then timespec_get (C11), then qh_CPUclock
+*/
+double qh_wallclock(void) {
+#if defined(CLOCK_MONOTONIC)
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+#elif defined(TIME_UTC)
+  struct timespec now;
+
+  timespec_get(&now, TIME_UTC);
+  return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+#else
+  return (double)qh_CPUclock / (double)qh_SECticks;
+#endif
+} /* wallclock */
+
@@ -40,9 +40,25 @@
    information it supplies.
 */
 
+#if !defined(_POSIX_C_SOURCE) && (defined(__unix__) || defined(__APPLE__))
+#define _POSIX_C_SOURCE 200112L  /* fileno() for qh_MMAP, hidden by 'gcc -ansi' */
+#endif
 #include <qhull/qhull_ra.h>
 
 #include <stdarg.h>
+#if qh_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#elif defined(_MSC_VER) || defined(__MINGW32__)
+typedef __int64 fileposT;     /* 64-bit file offsets for qh_new_qhull_outofcore.  'long' is 32-bits */
+#define fseekpos_(fp, offset, origin) _fseeki64(fp, (fileposT)(offset), origin)
+#define ftellpos_(fp) _ftelli64(fp)
+#else
+typedef long fileposT;        /* files are limited to LONG_MAX bytes */
+#define fseekpos_(fp, offset, origin) fseek(fp, (fileposT)(offset), origin)
+#define ftellpos_(fp) ftell(fp)
+#endif
 
 /*-<a                             href="qh-user_r.htm#TOC"
   >-------------------------------</a><a name="qhull_template">-</a>
@@ -178,11 +194,373 @@ int qh_new_qhull(qhT *qh, int dim, int numpoints, coordT *points, bool ismalloc,
     }
     if (qh->VERIFYoutput && !qh->FORCEoutput && !qh->STOPadd && !qh->STOPcone && !qh->STOPpoint)
       qh_check_points(qh);
+    if (qh->PRINTprofile)
+      qh_printprofile(qh, qh->ferr);
   }
   qh->NOerrexit= true;
   return exitcode;
 } /* new_qhull */
 
+/*-<a                             href="qh-user_r.htm#TOC"
+  >-------------------------------</a><a name="new_qhull_outofcore">-</a>
+
+  qh_new_qhull_outofcore(qh, dim, pointfile, memlimit, qhull_cmd, outfile, errfile )
+    Run qhull on a binary file of points that may be larger than memory
+    pointfile is opened for reading ("rb").  It is an array of dim coordT per point without a header
+    memlimit is the approximate limit in bytes for points and qhull's memory
+
+  returns:
+    results in qh for the points that survive the chunks
+    qh.input_ids is the index in pointfile of each qh.first_point (see qh_pointid_input)
+    exitcode (0 if no errors).
+
+  notes:
+    Before first call, either call qh_zero(qh, errfile), or set qh to all zero.
+    Computes convex hulls only.  Options 'd', 'v', and 'H' are input errors.
+    the vertices of the convex hull are vertices of the convex hull of their chunk
+    a chunk uses 'Q18' in 2-d and 'Q19' in 3-d.  A singular chunk is joggled ('QJ') or kept whole
+    a point within roundoff of a chunk's hull may be dropped, as for a merged facet
+    the estimated memory per point uses qh_OUTOFCOREpoint.  It does not include the page cache
+    the surviving points must fit in memory, otherwise reports error QH6454
+    without qh_MMAP, file offsets are 64-bits for Windows (_fseeki64) and 'long' otherwise (fseek)
+    reports error QH6449 if the file size does not fit in ptr_intT, e.g., over 2 GB for 32-bit code
+    point ids in outfile are indices of the surviving points.  Use qh_pointid_input for the input ids
+    the surviving points are in input order
+    not for the C++ interface.  qh_new_qhull clears qh.ISqhullQh
+
+  see:
+    qh_new_qhull, qh_outofcore_chunk
+    Run 4 of user_eg_r.c compares its vertices to an in-memory convex hull
+
+  design:
+    parse qhull_cmd for 'd', 'v', and 'H'
+    determine the number of points from the size of pointfile
+    determine the maximum points per chunk from memlimit
+    while more points remain than fit in a chunk
+      split the points into chunks of the maximum size and a smaller last chunk
+      for each chunk
+        map its coordinates and ids (qh_outofcore_map)
+        append the vertices of its convex hull to temporary files (qh_outofcore_chunk)
+      error if the number of points did not decrease
+      continue with the temporary files
+    read the surviving points and their ids
+    run qh_new_qhull on the surviving points with qhull_cmd
+    set qh.input_ids
+*/
+int qh_new_qhull_outofcore(qhT *qh, int dim, FILE *pointfile, size_t memlimit,
+                char *qhull_cmd, FILE *outfile, FILE *errfile) {
+  FILE *coordfile, *idfile= NULL, *newcoords= NULL, *newids= NULL, *chunkerr= NULL;
+  coordT *points, *coords= NULL;
+  ptr_intT *ids, *inputids= NULL;
+  ptr_intT filesize, numpoints, count, newcount, first, pointsize;
+  void *coordmap, *idmap;
+  size_t coordlength, idlength;
+  double bytes;
+  int exitcode, maxchunk, size, numkept, numrounds= 0, i, k;
+#if qh_MMAP
+  struct stat filestatus;
+#else
+  fileposT filepos;
+#endif
+
+  if (!errfile)
+    errfile= stderr;
+  if ((exitcode= qh_outofcore_checkflags(qh, qhull_cmd, errfile)))
+    return exitcode;
+  pointsize= (ptr_intT)dim * (ptr_intT)sizeof(coordT);
+#if qh_MMAP
+  filesize= (fstat(fileno(pointfile), &filestatus) ? -1 : (ptr_intT)filestatus.st_size);
+#else
+  if (fseekpos_(pointfile, 0, SEEK_END) || (filepos= ftellpos_(pointfile)) < 0 || filepos != (fileposT)(ptr_intT)filepos)
+    filesize= -1;  /* or too large for ptr_intT, e.g., 32-bit Windows */
+  else
+    filesize= (ptr_intT)filepos;
+#endif
+  if (dim < 2 || filesize <= 0 || filesize % pointsize) {
+    qh_fprintf(qh, errfile, 6449, "qhull input error (qh_new_qhull_outofcore): expecting a binary file of %d-d points with %d bytes per coordinate.  Got %.0f bytes\n",
+      dim, (int)sizeof(coordT), (double)filesize);
+    return qh_ERRinput;
+  }
+  numpoints= filesize / pointsize;
+  bytes= qh_OUTOFCOREpoint;
+  for (k=2; k < dim; k++)
+    bytes *= 3;
+  bytes += (double)pointsize + (double)sizeof(ptr_intT) + 1.0;
+  maxchunk= ((double)memlimit / bytes > (double)(qh_POINTSmax/2) ? qh_POINTSmax/2 : (int)((double)memlimit / bytes));
+  if (maxchunk < 4 * (dim+1)) {
+    qh_fprintf(qh, errfile, 6450, "qhull input error (qh_new_qhull_outofcore): a memory limit of %.0f bytes is too small.  It allows %d %d-d points at about %.0f bytes per point\n",
+      (double)memlimit, maxchunk, dim, bytes);
+    return qh_ERRinput;
+  }
+  coordfile= pointfile;
+  count= numpoints;
+  if (count > maxchunk && !(chunkerr= tmpfile())) {
+    qh_fprintf(qh, errfile, 6451, "qhull error (qh_new_qhull_outofcore): cannot open a temporary file (tmpfile)\n");
+    return qh_ERRother;
+  }
+  while (!exitcode && count > maxchunk) {
+    if (!(newcoords= tmpfile()) || !(newids= tmpfile())) {
+      qh_fprintf(qh, errfile, 6451, "qhull error (qh_new_qhull_outofcore): cannot open a temporary file (tmpfile)\n");
+      exitcode= qh_ERRother;
+      break;
+    }
+    newcount= 0;
+    for (first=0; first < count; first += maxchunk) {
+      size= (count - first < maxchunk ? (int)(count - first) : maxchunk);
+      points= (coordT *)qh_outofcore_map(qh, coordfile, first * pointsize, size * pointsize, &coordmap, &coordlength);
+      ids= NULL;
+      idmap= NULL;
+      if (points && idfile)
+        ids= (ptr_intT *)qh_outofcore_map(qh, idfile, first * (ptr_intT)sizeof(ptr_intT), size * (ptr_intT)sizeof(ptr_intT), &idmap, &idlength);
+      if (!points || (idfile && !ids)) {
+        qh_fprintf(qh, errfile, 6452, "qhull error (qh_new_qhull_outofcore): cannot read %d points at point %.0f of round %d\n",
+          size, (double)first, numrounds);
+        exitcode= qh_ERRother;
+      }else
+        exitcode= qh_outofcore_chunk(qh, dim, points, ids, first, size, newcoords, newids, chunkerr, errfile, &numkept);
+      qh_outofcore_unmap(qh, coordmap, coordlength);
+      qh_outofcore_unmap(qh, idmap, idlength);
+      if (exitcode)
+        break;
+      newcount += numkept;
+    }
+    if (coordfile != pointfile)
+      fclose(coordfile);
+    if (idfile)
+      fclose(idfile);
+    coordfile= newcoords;
+    idfile= newids;
+    newcoords= newids= NULL;
+    numrounds++;
+    if (!exitcode && (fflush(coordfile) || fflush(idfile))) {
+      qh_fprintf(qh, errfile, 6453, "qhull error (qh_new_qhull_outofcore): cannot write a temporary file for %.0f points\n", (double)newcount);
+      exitcode= qh_ERRother;
+    }else if (!exitcode && newcount >= count) {
+      qh_fprintf(qh, errfile, 6454, "qhull input error (qh_new_qhull_outofcore): round %d did not reduce %.0f points.  A chunk has at most %d points for a memory limit of %.0f bytes.  Either the convex hull has more vertices than fit in a chunk or the chunks are degenerate\n",
+        numrounds, (double)count, maxchunk, (double)memlimit);
+      exitcode= qh_ERRinput;
+    }
+    count= newcount;
+  }
+  if (newcoords)
+    fclose(newcoords);
+  if (chunkerr)
+    fclose(chunkerr);
+  if (!exitcode) {
+    if (!(coords= (coordT *)qh_malloc((size_t)(count * pointsize)))
+    || !(inputids= (ptr_intT *)qh_malloc((size_t)count * sizeof(ptr_intT)))) {
+      qh_fprintf(qh, errfile, 6455, "qhull error (qh_new_qhull_outofcore): insufficient memory for %.0f surviving points\n", (double)count);
+      exitcode= qh_ERRmem;
+    }else if (fseek(coordfile, 0L, SEEK_SET) || fread(coords, (size_t)pointsize, (size_t)count, coordfile) != (size_t)count
+    || (idfile && (fseek(idfile, 0L, SEEK_SET) || fread(inputids, sizeof(ptr_intT), (size_t)count, idfile) != (size_t)count))) {
+      qh_fprintf(qh, errfile, 6456, "qhull error (qh_new_qhull_outofcore): cannot read %.0f points at point 0 of round %d\n",
+        (double)count, numrounds);
+      exitcode= qh_ERRother;
+    }else if (!idfile) {
+      for (i=0; i < (int)count; i++)
+        inputids[i]= i;
+    }
+  }
+  if (coordfile != pointfile)
+    fclose(coordfile);
+  if (idfile)
+    fclose(idfile);
+  if (exitcode) {
+    if (coords)
+      qh_free(coords);
+    if (inputids)
+      qh_free(inputids);
+    return exitcode;
+  }
+  exitcode= qh_new_qhull(qh, dim, (int)count, coords, true, qhull_cmd, outfile, errfile);
+  qh->input_ids= inputids;  /* freed by qh_freebuffers */
+  trace1((qh, qh->ferr, 1078, "qh_new_qhull_outofcore: %d of %.0f %d-d points survived %d rounds of chunks.  A chunk has at most %d points for a memory limit of %.0f bytes\n",
+    (int)count, (double)numpoints, dim, numrounds, maxchunk, (double)memlimit));
+  return exitcode;
+} /* new_qhull_outofcore */
+
+/*-<a                             href="qh-user_r.htm#TOC"
+  >-------------------------------</a><a name="outofcore_checkflags">-</a>
+
+  qh_outofcore_checkflags(qh, qhull_cmd, errfile )
+    parse qhull_cmd for qh_new_qhull_outofcore and free qhull
+
+  returns:
+    exitcode (0 if no errors)
+    qh_ERRinput if not a convex hull ('d', 'v', 'H')
+*/
+int qh_outofcore_checkflags(qhT *qh, char *qhull_cmd, FILE *errfile) {
+  int exitcode, curlong, totlong;
+
+  if (!qh->qhmem.ferr) {
+    qh_meminit(qh, errfile);
+  } else {
+    qh_memcheck(qh);
+  }
+  if (strncmp(qhull_cmd, "qhull ", (size_t)6) && strcmp(qhull_cmd, "qhull") != 0) {
+    qh_fprintf(qh, errfile, 6447, "qhull error (qh_new_qhull_outofcore): start qhull_cmd argument with \"qhull \" or set to \"qhull\"\n");
+    return qh_ERRinput;
+  }
+  qh_initqhull_start(qh, NULL, NULL, errfile);
+  exitcode= setjmp(qh->errexit);
+  if (!exitcode) {
+    qh->NOerrexit= false;
+    qh_initflags(qh, qhull_cmd);
+    if (qh->DELAUNAY || qh->HALFspace) {
+      qh_fprintf(qh, errfile, 6448, "qhull input error (qh_new_qhull_outofcore): computes convex hulls only.  Options 'd', 'v', and 'H' are not supported\n");
+      exitcode= qh_ERRinput;
+    }
+  }
+  qh->NOerrexit= true;
+  qh_freeqhull(qh, !qh_ALL);
+  qh_memfreeshort(qh, &curlong, &totlong);
+  return exitcode;
+} /* outofcore_checkflags */
+
+/*-<a                             href="qh-user_r.htm#TOC"
+  >-------------------------------</a><a name="outofcore_chunk">-</a>
+
+  qh_outofcore_chunk(qh, dim, points, ids, firstid, count, coordfile, idfile, chunkerr, errfile, numkept )
+    append the vertices of the convex hull of a chunk of points to coordfile and idfile
+    ids is the input id of each point, or NULL if the input ids are firstid, firstid+1, ...
+    chunkerr is a temporary file for qhull's messages
+
+  returns:
+    exitcode (0 if no errors)
+    numkept is the number of points appended, in input order
+    qhull is freed
+
+  notes:
+    does not modify points
+    if the chunk is singular or has a precision error, joggles the chunk ('QJ')
+    if the joggled chunk is also singular or the chunk has at most dim+1 points, keeps all of its points
+    on other errors, copies qhull's messages to errfile
+
+  design:
+    build the convex hull of the chunk with 'Q18' (2-d), 'Q19' (3-d), or the default options
+    if the hull is singular or has a precision error, build it again with 'QJ'
+    mark the point of each vertex
+    append the coordinates and input id of each marked point
+*/
+int qh_outofcore_chunk(qhT *qh, int dim, coordT *points, ptr_intT *ids, ptr_intT firstid, int count,
+        FILE *coordfile, FILE *idfile, FILE *chunkerr, FILE *errfile, int *numkept) {
+  vertexT *vertex;
+  char *iskept;
+  ptr_intT id;
+  long length;
+  int exitcode= 0, curlong, totlong, attempt, c, i;
+  char command[20];
+
+  *numkept= 0;
+  if (!(iskept= (char *)qh_malloc((size_t)count))) {
+    qh_fprintf(qh, errfile, 6457, "qhull error (qh_outofcore_chunk): insufficient memory for a chunk of %d points\n", count);
+    return qh_ERRmem;
+  }
+  memset(iskept, 0, (size_t)count);
+  for (attempt=(count <= dim+1 ? 2 : 0); attempt < 2; attempt++) {
+    rewind(chunkerr);
+    strcpy(command, (attempt ? "qhull QJ" : (dim == 2 ? "qhull Q18" : (dim == 3 ? "qhull Q19" : "qhull"))));
+    exitcode= qh_new_qhull(qh, dim, count, points, false, command, NULL, chunkerr);
+    if (!exitcode) {
+      FORALLvertices {
+        i= qh_pointid(qh, vertex->point);
+        if (!vertex->deleted && i >= 0 && i < count)
+          iskept[i]= 1;
+      }
+    }
+    qh_freeqhull(qh, !qh_ALL);
+    qh_memfreeshort(qh, &curlong, &totlong);
+    if (exitcode != qh_ERRsingular && exitcode != qh_ERRprec)
+      break;
+  }
+  if (count <= dim+1 || exitcode == qh_ERRsingular || exitcode == qh_ERRprec) {
+    memset(iskept, 1, (size_t)count);
+    exitcode= 0;
+  }else if (exitcode) {
+    length= ftell(chunkerr);
+    rewind(chunkerr);
+    while (length-- > 0 && (c= getc(chunkerr)) != EOF)
+      putc(c, errfile);
+    qh_fprintf(qh, errfile, 6458, "qhull error (qh_outofcore_chunk): qhull failed with exit code %d for a chunk of %d points at input id %.0f\n",
+      exitcode, count, (double)(ids ? ids[0] : firstid));
+  }
+  for (i=0; !exitcode && i < count; i++) {
+    if (iskept[i]) {
+      id= (ids ? ids[i] : firstid + i);
+      if (fwrite(points + (ptr_intT)i * dim, sizeof(coordT), (size_t)dim, coordfile) != (size_t)dim
+      || fwrite(&id, sizeof(ptr_intT), (size_t)1, idfile) != 1) {
+        qh_fprintf(qh, errfile, 6459, "qhull error (qh_outofcore_chunk): cannot write a temporary file for %d points\n", *numkept);
+        exitcode= qh_ERRother;
+      }else
+        (*numkept)++;
+    }
+  }
+  qh_free(iskept);
+  return exitcode;
+} /* outofcore_chunk */
+
+/*-<a                             href="qh-user_r.htm#TOC"
+  >-------------------------------</a><a name="outofcore_map">-</a>
+
+  qh_outofcore_map(qh, fp, offset, size, map, length )
+    return a pointer to size bytes of fp at offset
+    if qh_MMAP, maps the pages with mmap()
+    otherwise reads the bytes into a buffer with fread()
+
+  returns:
+    pointer to the bytes, or NULL if an error
+    map and length for qh_outofcore_unmap (NULL if an error)
+
+  notes:
+    offset is a multiple of sizeof(coordT)
+    mmap is MAP_PRIVATE.  Changes are not written to fp.
+    without qh_MMAP, seeks with fseekpos_.  It is _fseeki64 for Windows and fseek otherwise
+*/
+void *qh_outofcore_map(qhT *qh, FILE *fp, ptr_intT offset, ptr_intT size, void **map, size_t *length) {
+#if qh_MMAP
+  ptr_intT pagesize= (ptr_intT)sysconf(_SC_PAGESIZE);
+  ptr_intT start= offset - offset % pagesize;
+
+  QHULL_UNUSED(qh)
+  *length= (size_t)(offset + size - start);
+  *map= mmap(NULL, *length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno(fp), (off_t)start);
+  if (*map == MAP_FAILED) {
+    *map= NULL;
+    return NULL;
+  }
+  return (char *)*map + (offset - start);
+#else
+  QHULL_UNUSED(qh)
+  *length= (size_t)size;
+  if (!(*map= qh_malloc((size_t)size)))
+    return NULL;
+  if (fseekpos_(fp, offset, SEEK_SET) || fread(*map, (size_t)1, (size_t)size, fp) != (size_t)size) {
+    qh_free(*map);
+    *map= NULL;
+  }
+  return *map;
+#endif
+} /* outofcore_map */
+
+/*-<a                             href="qh-user_r.htm#TOC"
+  >-------------------------------</a><a name="outofcore_unmap">-</a>
+
+  qh_outofcore_unmap(qh, map, length )
+    release the bytes of qh_outofcore_map
+    nop if map is NULL
+*/
+void qh_outofcore_unmap(qhT *qh, void *map, size_t length) {
+  QHULL_UNUSED(qh)
+  if (!map)
+    return;
+#if qh_MMAP
+  munmap(map, length);
+#else
+  QHULL_UNUSED(length)
+  qh_free(map);
+#endif
+} /* outofcore_unmap */
+
 /*-<a                             href="qh-user_r.htm#TOC"
   >-------------------------------</a><a name="errexit">-</a>
 
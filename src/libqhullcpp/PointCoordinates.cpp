@@ -144,6 +144,33 @@ operator=(const PointCoordinates &other)
     return *this;
 }//operator=
 
+#ifdef QHULL_USES_MOVE
+PointCoordinates::
+PointCoordinates(PointCoordinates &&other)
+: QhullPoints(other)
+, point_coordinates(std::move(other.point_coordinates))
+, describe_points(std::move(other.describe_points))
+{
+    makeValid();  // Same point_first and point_end.  std::vector retains its buffer
+    other.describe_points.clear();
+    other.makeValid();
+}
+
+PointCoordinates & PointCoordinates::
+operator=(PointCoordinates &&other)
+{
+    if(this!=&other){
+        QhullPoints::operator=(other);
+        point_coordinates= std::move(other.point_coordinates);
+        describe_points= std::move(other.describe_points);
+        makeValid();
+        other.describe_points.clear();
+        other.makeValid();
+    }
+    return *this;
+}//operator= move
+#endif //QHULL_USES_MOVE
+
 PointCoordinates::
 ~PointCoordinates()
 { }
@@ -226,6 +253,20 @@ appendComment(const std::string &s){
     describe_points += s;
 }//appendComment
 
+//! Appends coordinatesCount zero coordinates for filling in place (e.g., by qh_rboxbuffer)
+//! Returns the first new coordinate.  It is invalid after the next append or reserve
+coordT * PointCoordinates::
+extendCoordinates(countT coordinatesCount)
+{
+    countT oldCount= point_coordinates.count();
+    if(coordinatesCount<0){
+        throw QhullError(10083, "Qhull error: can not extend PointCoordinates by %d coordinates", coordinatesCount);
+    }
+    point_coordinates.resize(oldCount+coordinatesCount);
+    makeValid();
+    return point_coordinates.data()+oldCount;
+}//extendCoordinates
+
 //! Read PointCoordinates from istream.  First two numbers are dimension and count.  A non-digit starts a rboxCommand.
 //! Overwrites describe_points.  See qh_readpoints [io.c]
 void PointCoordinates::
@@ -34,7 +34,7 @@ namespace orgQhull{
 #//!\name Global variables
 
 const char s_unsupported_options[]=" Fd TI ";
-const char s_not_output_options[]= " Fd TI A C d E H P Qa Qb QbB Qbb Qc Qf Qg Qi Qm QJ Qr QR Qs Qt Qv Qx Qz Q0 Q1 Q2 Q3 Q4 Q5 Q6 Q7 Q8 Q9 Q10 Q11 Q15 R TA Tc TC TM TP TR Tv TV TW U v V W ";
+const char s_not_output_options[]= " Fd TI A C d E H P Qa Qb QbB Qbb Qc Qf Qg Qi Qm QJ Qr QR Qs Qt Qv Qx Qz Q0 Q1 Q2 Q3 Q4 Q5 Q6 Q7 Q8 Q9 Q10 Q11 Q15 R TA Tc TC Tj TM TP TR Tv TV TW U v V W ";
 
 #//!\name Constructor, destructor, etc.
 Qhull::
@@ -95,7 +95,7 @@ Qhull::
 ~Qhull() throw()
 {
     // Except for cerr, does not throw errors
-    if(qh_qh->hasQhullMessage()){
+    if(qh_qh && qh_qh->hasQhullMessage()){
         cerr<< "\nQhull messages at ~Qhull()\n"; // QH11005 FIX: where should error and log messages go on ~Qhull?
         cerr<< qh_qh->qhullMessage();
         qh_qh->clearQhullMessage();
@@ -104,6 +104,40 @@ Qhull::
     qh_qh= 0;
 }//~Qhull
 
+#ifdef QHULL_USES_MOVE
+//! QhullFacet, QhullVertex, etc. from 'other' remain valid.  They refer to QhullQh
+Qhull::
+Qhull(Qhull &&other)
+: qh_qh(other.qh_qh)
+, origin_point(std::move(other.origin_point))
+, run_called(other.run_called)
+, feasible_point(std::move(other.feasible_point))
+{
+    other.qh_qh= 0;
+    other.run_called= false;
+}//Qhull move
+
+Qhull & Qhull::
+operator=(Qhull &&other)
+{
+    if(this!=&other){
+        if(qh_qh && qh_qh->hasQhullMessage()){
+            cerr<< "\nQhull messages at Qhull::operator=()\n";
+            cerr<< qh_qh->qhullMessage();
+            qh_qh->clearQhullMessage();
+        }
+        delete qh_qh;
+        qh_qh= other.qh_qh;
+        origin_point= std::move(other.origin_point);
+        run_called= other.run_called;
+        feasible_point= std::move(other.feasible_point);
+        other.qh_qh= 0;
+        other.run_called= false;
+    }
+    return *this;
+}//operator= move
+#endif //QHULL_USES_MOVE
+
 #//!\name GetSet
 
 void Qhull::
@@ -155,9 +189,9 @@ area(){
 double Qhull::
 volume(){
     checkIfQhullInitialized();
-    if(!qh_qh->hasAreaVolume){
+    if(!qh_qh->hasVolume){
         QH_TRY_(qh_qh){ // no object creation -- destructors skipped on longjmp()
-            qh_getarea(qh_qh, qh_qh->facet_list);
+            qh_getvolume(qh_qh, qh_qh->facet_list);
         }
         qh_qh->NOerrexit= true;
         qh_qh->maybeThrowQhullMessage(QH_TRY_status);
@@ -165,6 +199,225 @@ volume(){
     return qh_qh->totvol;
 }//volume
 
+//! Returns the number of Delaunay simplices, each with hullDimension() point ids (qh_extract_delaunay)
+//! Simplex i is simplices[i*hullDimension() .. (i+1)*hullDimension()-1], oriented as option 'i'
+//! If neighborIds, neighbor k of simplex i is opposite its k'th point, or -1 if outside the triangulation
+//! If siteOffsets, the simplices of input site p are siteSimplices[siteOffsets[p] .. siteOffsets[p+1]-1] in increasing order
+//! Same simplices as option 'i' or 'Fn'.  Requires simplicial facets ('Qt' or 'QJ').  Uses 'QPn' threads if OpenMP
+countT Qhull::
+extractDelaunay(vector<countT> *simplices, vector<countT> *neighborIds, vector<countT> *siteOffsets, vector<countT> *siteSimplices)
+{
+    checkIfQhullInitialized();
+    if(!qh_qh->DELAUNAY){
+        throw QhullError(10087, "Qhull error: extractDelaunay requires a Delaunay triangulation ('d' or 'v').  Use extractFacets instead.");
+    }
+    int numfacets= 0;
+    int numvertexids= 0;
+    int numneighbors= 0;
+    int numsites= 0;
+    vector<countT> siteSimplexIds; // simplices for siteOffsets
+    {   // scope for QH_TRY_status
+        QH_TRY_(qh_qh){ // no object creation -- destructors skipped on longjmp()
+            numfacets= qh_extract_count(qh_qh, !qh_ALL, &numvertexids, &numneighbors);
+            numsites= qh_qh->num_points + qh_setsize(qh_qh, qh_qh->other_points);
+        }
+        qh_qh->NOerrexit= true;
+        qh_qh->maybeThrowQhullMessage(QH_TRY_status);
+    }
+    if(numvertexids!=numfacets*qh_qh->hull_dim || numneighbors!=numvertexids){
+        throw QhullError(10088, "Qhull error: extractDelaunay requires simplicial facets ('Qt' or 'QJ').  Found %d point ids for %d Delaunay regions", numvertexids, numfacets);
+    }
+    if(!simplices && siteOffsets){
+        siteSimplexIds.resize(numvertexids);
+    }else if(simplices){
+        simplices->resize(numvertexids);
+    }
+    if(neighborIds){
+        neighborIds->resize(numneighbors);
+    }
+    if(siteOffsets){
+        siteOffsets->resize(numsites+1);
+        if(siteSimplices){
+            siteSimplices->resize(numvertexids);
+        }
+    }
+    if(numfacets>0 || siteOffsets){
+        QH_TRY_(qh_qh){ // no object creation -- destructors skipped on longjmp()
+            qh_extract_delaunay(qh_qh, (numfacets==0 ? NULL : (simplices ? &(*simplices)[0] : (siteOffsets ? &siteSimplexIds[0] : NULL))), (neighborIds && numfacets ? &(*neighborIds)[0] : NULL),
+                (siteOffsets ? &(*siteOffsets)[0] : NULL), (siteOffsets && siteSimplices && numfacets ? &(*siteSimplices)[0] : NULL));
+        }
+        qh_qh->NOerrexit= true;
+        qh_qh->maybeThrowQhullMessage(QH_TRY_status);
+    }
+    return numfacets;
+}//extractDelaunay
+
+//! Returns the number of facets after extracting them into CSR arrays (qh_extract_count, qh_extract_facets)
+//! Facet i has point ids vertexIds[vertexOffsets[i] .. vertexOffsets[i+1]-1], oriented as option 'i' if simplicial
+//! Facet i has neighbors neighborIds[neighborOffsets[i] .. neighborOffsets[i+1]-1], as facet indices or -1 for a skipped facet
+//! normals has hullDimension() coordinates and the offset for each facet (option 'n')
+//! Skips facets as for output (qh_skipfacet, e.g., upper Delaunay facets or 'QGn'), unless printAll
+countT Qhull::
+extractFacets(vector<countT> *vertexOffsets, vector<countT> *vertexIds, vector<countT> *neighborOffsets, vector<countT> *neighborIds, vector<coordT> *normals, bool printAll)
+{
+    checkIfQhullInitialized();
+    int numfacets= 0;
+    int numvertexids= 0;
+    int numneighbors= 0;
+    {   // scope for QH_TRY_status
+        QH_TRY_(qh_qh){ // no object creation -- destructors skipped on longjmp()
+            numfacets= qh_extract_count(qh_qh, printAll, &numvertexids, &numneighbors);
+        }
+        qh_qh->NOerrexit= true;
+        qh_qh->maybeThrowQhullMessage(QH_TRY_status);
+    }
+    if(vertexOffsets){
+        vertexOffsets->resize(numfacets+1);
+        (*vertexOffsets)[0]= 0;
+    }
+    if(vertexIds){
+        vertexIds->resize(numvertexids);
+    }
+    if(neighborOffsets){
+        neighborOffsets->resize(numfacets+1);
+        (*neighborOffsets)[0]= 0;
+    }
+    if(neighborIds){
+        neighborIds->resize(numneighbors);
+    }
+    if(normals){
+        normals->resize(numfacets*(qh_qh->hull_dim+1));
+    }
+    if(numfacets>0){
+        QH_TRY_(qh_qh){ // no object creation -- destructors skipped on longjmp()
+            qh_extract_facets(qh_qh, (vertexIds && vertexOffsets ? &(*vertexOffsets)[0] : NULL), (vertexIds ? &(*vertexIds)[0] : NULL),
+                (neighborIds && neighborOffsets ? &(*neighborOffsets)[0] : NULL), (neighborIds ? &(*neighborIds)[0] : NULL), (normals ? &(*normals)[0] : NULL));
+        }
+        qh_qh->NOerrexit= true;
+        qh_qh->maybeThrowQhullMessage(QH_TRY_status);
+    }
+    return numfacets;
+}//extractFacets
+
+//! Returns the number of input sites after extracting the Voronoi diagram into CSR arrays (qh_extract_voronoi)
+//! voronoiVertices has dimension() coordinates for each Voronoi vertex
+//! Site i has Voronoi region regionIds[regionOffsets[i] .. regionOffsets[i+1]-1], as indices into voronoiVertices, or -1 for the vertex-at-infinity
+//! Same as option 'o' with 0-relative indices.  Regions are empty for coplanar and deleted sites
+//! Skips NULL arrays
+countT Qhull::
+extractVoronoi(vector<coordT> *voronoiVertices, vector<countT> *regionOffsets, vector<countT> *regionIds, bool printAll)
+{
+    checkIfQhullInitialized();
+    if(!qh_qh->DELAUNAY){
+        throw QhullError(10089, "Qhull error: extractVoronoi requires a Delaunay triangulation ('d' or 'v')");
+    }
+    int numsites= 0;
+    int numcenters= 0;
+    int numregionids= 0;
+    vector<coordT> centers;  // qh_extract_voronoi fills all three arrays.  Swapped into the non-NULL arrays
+    vector<countT> offsets;
+    vector<countT> ids;
+    {   // scope for QH_TRY_status
+        QH_TRY_(qh_qh){ // no object creation -- destructors skipped on longjmp()
+            numsites= qh_extract_voronoi(qh_qh, printAll, NULL, NULL, NULL, &numcenters, &numregionids);
+        }
+        qh_qh->NOerrexit= true;
+        qh_qh->maybeThrowQhullMessage(QH_TRY_status);
+    }
+    offsets.resize(numsites+1);
+    offsets[0]= 0;
+    if(numsites>0){
+        centers.resize(numcenters*(qh_qh->hull_dim-1)+1); // +1 for a non-NULL &[0], removed below
+        ids.resize(numregionids+1);
+        QH_TRY_(qh_qh){ // no object creation -- destructors skipped on longjmp()
+            qh_extract_voronoi(qh_qh, printAll, &centers[0], &offsets[0], &ids[0], &numcenters, &numregionids);
+        }
+        qh_qh->NOerrexit= true;
+        qh_qh->maybeThrowQhullMessage(QH_TRY_status);
+        centers.pop_back();
+        ids.pop_back();
+    }
+    if(voronoiVertices){
+        voronoiVertices->swap(centers);
+    }
+    if(regionOffsets){
+        regionOffsets->swap(offsets);
+    }
+    if(regionIds){
+        regionIds->swap(ids);
+    }
+    return numsites;
+}//extractVoronoi
+
+//! Returns the Delaunay region (facet) for an input site of dimension()-1 coordinates
+//! Lifts site to the paraboloid (qh_setdelaunay) and calls locateFacet with qh_ALL
+//! If the site is outside the triangulation, returns a nearby region and isOutside is false
+//! The region may be an adjacent or tricoplanar facet, see qh_findbestfacet in poly2_r.c
+QhullFacet Qhull::
+locateDelaunay(const coordT *site, double *bestDist, bool *isOutside)
+{
+    checkIfQhullInitialized();
+    if(!qh_qh->DELAUNAY){
+        throw QhullError(10082, "Qhull error: locateDelaunay requires a Delaunay triangulation ('d' or 'v').  Use locateFacet instead.");
+    }
+    vector<coordT> point(site, site+qh_qh->hull_dim-1);
+    point.push_back(0.0);
+    QH_TRY_(qh_qh){ // no object creation -- destructors skipped on longjmp()
+        qh_setdelaunay(qh_qh, qh_qh->hull_dim, 1, &point[0]);
+    }
+    qh_qh->NOerrexit= true;
+    qh_qh->maybeThrowQhullMessage(QH_TRY_status);
+    return locateFacet(&point[0], qh_ALL, bestDist, isOutside);
+}//locateDelaunay
+
+//! Returns the facet furthest below a point of hullDimension() coordinates (qh_locatefacet)
+//! Same as qh_findbestfacet, but starts at a nearby facet from the point-location grid
+//! For Delaunay triangulations, see locateDelaunay
+QhullFacet Qhull::
+locateFacet(const coordT *point, bool bestOutside, double *bestDist, bool *isOutside)
+{
+    checkIfQhullInitialized();
+    facetT *facet= 0;
+    realT bestdist= 0.0;
+    bool isoutside= false;
+    QH_TRY_(qh_qh){ // no object creation -- destructors skipped on longjmp()
+        facet= qh_locatefacet(qh_qh, const_cast<coordT *>(point), bestOutside, &bestdist, &isoutside);
+    }
+    qh_qh->NOerrexit= true;
+    qh_qh->maybeThrowQhullMessage(QH_TRY_status);
+    *bestDist= bestdist;
+    *isOutside= isoutside;
+    return QhullFacet(qh_qh, facet);
+}//locateFacet
+
+//! Returns the facets for pointCount points (qh_query_locate_all).  Uses 'QPn' threads if OpenMP
+//! points has hullDimension() coordinates per point, or dimension() coordinates for Delaunay input sites
+//! Same as locateFacet or locateDelaunay for each point.  If bestDists, sets the distance to each facet
+std::vector<QhullFacet> Qhull::
+locateFacets(int pointDimension, int pointCount, const coordT *points, bool bestOutside, std::vector<double> *bestDists)
+{
+    checkIfQhullInitialized();
+    vector<QhullFacet> result;
+    if(pointCount<=0){
+        return result;
+    }
+    vector<facetT *> facets(pointCount);
+    vector<realT> dists(pointCount);
+    QH_TRY_(qh_qh){ // no object creation -- destructors skipped on longjmp()
+        qh_query_locate_all(qh_qh, pointDimension, pointCount, const_cast<coordT *>(points), bestOutside, &facets[0], &dists[0], NULL);
+    }
+    qh_qh->NOerrexit= true;
+    qh_qh->maybeThrowQhullMessage(QH_TRY_status);
+    if(bestDists){
+        bestDists->swap(dists);
+    }
+    result.reserve(pointCount);
+    for(int i= 0; i<pointCount; ++i){
+        result.push_back(QhullFacet(qh_qh, facets[i]));
+    }
+    return result;
+}//locateFacets
+
 #//!\name Foreach
 
 //! Define QhullVertex::neighborFacets().
@@ -275,6 +528,31 @@ prepareVoronoi(bool *isLower, int *voronoiVertexCount)
   qh_qh->maybeThrowQhullMessage(QH_TRY_status);
 }//prepareVoronoi
 
+//! Builds the point-location grid for locateFacet and locateDelaunay (qh_locate_build)
+//! Rebuilt automatically if the hull changes
+void Qhull::
+prepareLocate()
+{
+    checkIfQhullInitialized();
+    QH_TRY_(qh_qh){ // no object creation -- destructors skipped on longjmp()
+        qh_locate_build(qh_qh);
+    }
+    qh_qh->NOerrexit= true;
+    qh_qh->maybeThrowQhullMessage(QH_TRY_status);
+}//prepareLocate
+
+//! Free the hull for another call to runQhull, with the options and streams of a new Qhull
+//! Keeps QhullQh and its memory freelists (QhullQh::resetQhull).  Used by QhullPool
+//! Invalidates QhullFacet, QhullVertex, etc. from the previous run
+void Qhull::
+resetQhull()
+{
+    qh_qh->resetQhull();
+    origin_point.clear();
+    feasible_point.clear();
+    run_called= false;
+}//resetQhull
+
 //! For qhull commands, see http://www.qhull.org/html/qhull.htm or html/qhull.htm
 void Qhull::
 runQhull(const RboxPoints &rboxPoints, const char *qhullCommand2)
@@ -333,6 +611,9 @@ runQhull(const char *inputComment2, int pointDimension, int pointCount, const re
         if(qh_qh->VERIFYoutput && !qh_qh->FORCEoutput && !qh_qh->STOPadd && !qh_qh->STOPcone && !qh_qh->STOPpoint){
             qh_check_points(qh_qh);
         }
+        if(qh_qh->PRINTprofile){
+            qh_printprofile(qh_qh, qh_qh->ferr);
+        }
     }
     qh_qh->NOerrexit= true;
     for(int k= qh_qh->hull_dim; k--; ){  // Do not move into QH_TRY block.  It may throw an error
@@ -341,6 +622,33 @@ runQhull(const char *inputComment2, int pointDimension, int pointCount, const re
     qh_qh->maybeThrowQhullMessage(QH_TRY_status);
 }//runQhull
 
+//! Invokes Qhull on a strided view of caller-owned points.  Point i is pointCoordinates[i*pointStride .. i*pointStride+pointDimension-1]
+//! Copies, compacts, and lifts the points ('d' or 'v') in one pass into scratchCoordinates or a malloc'd array (qh_copypoints_strided)
+//!   No copy if not Delaunay and pointStride==pointDimension, the same as runQhull without a stride
+//!   scratchCoordinates has pointCount*(pointDimension+1) coordinates for 'd' or 'v', otherwise pointCount*pointDimension.  It must outlive Qhull
+//!   scratchCoordinates may be pointCoordinates if pointStride>=pointDimension+1 ('d' or 'v').  The points are overwritten in place
+//! For 'H', 'Qz', and 'Qbk:0Bk:0', copies the points, then continues as runQhull without a stride
+//! For Delaunay, qh.input_dim is pointDimension+1 as for qh_readpoints
+void Qhull::
+runQhull(const char *inputComment2, int pointDimension, int pointCount, const double *pointCoordinates, int pointStride, const char *qhullCommand2, coordT *scratchCoordinates)
+{
+    if(sizeof(coordT)!=sizeof(double)){
+        throw QhullError(10084, "Qhull error: runQhull for double coordinates requires coordT as double.  Use the float version for qh_REALdigits %d", qh_REALdigits);
+    }
+    runQhullStrided(inputComment2, pointDimension, pointCount, pointCoordinates, pointStride, false, qhullCommand2, scratchCoordinates);
+}//runQhull, strided double
+
+//! Invokes Qhull on a strided view of caller-owned float points.  Converts each coordinate to coordT while copying.  See runQhull for double
+//! scratchCoordinates may not be pointCoordinates
+void Qhull::
+runQhull(const char *inputComment2, int pointDimension, int pointCount, const float *pointCoordinates, int pointStride, const char *qhullCommand2, coordT *scratchCoordinates)
+{
+    if(static_cast<const void *>(scratchCoordinates)==static_cast<const void *>(pointCoordinates)){
+        throw QhullError(10085, "Qhull error: runQhull can not convert float coordinates in place.  Use a separate scratch buffer");
+    }
+    runQhullStrided(inputComment2, pointDimension, pointCount, pointCoordinates, pointStride, true, qhullCommand2, scratchCoordinates);
+}//runQhull, strided float
+
 #//!\name Helpers -- be careful of allocating C++ objects due to setjmp/longjmp() error handling by qh_... routines
 
 //! initialize qh.feasible_point for half-space intersection
@@ -373,5 +681,71 @@ initializeFeasiblePoint(int hulldim)
     }
 }//initializeFeasiblePoint
 
+//! Shared by runQhull for strided double and float points
+//! Derived from runQhull without a stride
+void Qhull::
+runQhullStrided(const char *inputComment2, int pointDimension, int pointCount, const void *pointCoordinates, int pointStride, bool isFloat, const char *qhullCommand2, coordT *scratchCoordinates)
+{
+    if(run_called){
+        throw QhullError(10027, "Qhull error: runQhull called twice.  Only one call allowed.");
+    }
+    run_called= true;
+    string s("qhull ");
+    s += qhullCommand2;
+    char *command= const_cast<char*>(s.c_str());
+    QH_TRY_(qh_qh){ // no object creation -- destructors are skipped on longjmp()
+        qh_checkflags(qh_qh, command, const_cast<char *>(s_unsupported_options));
+        qh_initflags(qh_qh, command);
+        *qh_qh->rbox_command= '\0';
+        strncat( qh_qh->rbox_command, inputComment2, sizeof(qh_qh->rbox_command)-1);
+        pointT *newPoints;
+        int newDimension= pointDimension;
+        if(qh_qh->HALFspace || qh_qh->ATinfinity || qh_qh->PROJECTinput){
+            // qh_projectinput or qh_sethalfspace_all makes the final copy
+            if(isFloat || pointStride!=pointDimension){
+                newPoints= qh_qh->temp_malloc= qh_copypoints_strided(qh_qh, pointCoordinates, pointCount, pointDimension, pointStride, isFloat, false, NULL);
+            }else{
+                newPoints= static_cast<pointT *>(const_cast<void *>(pointCoordinates));
+            }
+            if(qh_qh->DELAUNAY){
+                qh_qh->PROJECTdelaunay= true;   // qh_init_B() calls qh_projectinput()
+            }
+            if(qh_qh->HALFspace){
+                --newDimension;
+                initializeFeasiblePoint(newDimension);
+                pointT *halfPoints= qh_sethalfspace_all(qh_qh, pointDimension, pointCount, newPoints, qh_qh->feasible_point);
+                if(qh_qh->temp_malloc){
+                    qh_free(qh_qh->temp_malloc);
+                }
+                newPoints= halfPoints;
+            }
+            qh_qh->temp_malloc= NULL;
+            qh_init_B(qh_qh, newPoints, pointCount, newDimension, (qh_qh->HALFspace || newPoints!=pointCoordinates));
+        }else if(!qh_qh->DELAUNAY && !isFloat && pointStride==pointDimension){
+            qh_init_B(qh_qh, static_cast<pointT *>(const_cast<void *>(pointCoordinates)), pointCount, pointDimension, false);
+        }else{
+            // Delaunay points are lifted here, as in qh_readpoints
+            newDimension += (qh_qh->DELAUNAY ? 1 : 0);
+            newPoints= qh_copypoints_strided(qh_qh, pointCoordinates, pointCount, pointDimension, pointStride, isFloat, qh_qh->DELAUNAY, scratchCoordinates);
+            qh_qh->PROJECTdelaunay= false;
+            qh_init_B(qh_qh, newPoints, pointCount, newDimension, !scratchCoordinates);
+        }
+        qh_qhull(qh_qh);
+        qh_check_output(qh_qh);
+        qh_prepare_output(qh_qh);
+        if(qh_qh->VERIFYoutput && !qh_qh->FORCEoutput && !qh_qh->STOPadd && !qh_qh->STOPcone && !qh_qh->STOPpoint){
+            qh_check_points(qh_qh);
+        }
+        if(qh_qh->PRINTprofile){
+            qh_printprofile(qh_qh, qh_qh->ferr);
+        }
+    }
+    qh_qh->NOerrexit= true;
+    for(int k= qh_qh->hull_dim; k--; ){  // Do not move into QH_TRY block.  It may throw an error
+        origin_point << 0.0;
+    }
+    qh_qh->maybeThrowQhullMessage(QH_TRY_status);
+}//runQhullStrided
+
 }//namespace orgQhull
 
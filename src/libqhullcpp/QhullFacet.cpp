@@ -104,6 +104,19 @@ getCenter(qh_PRINT printFormat)
     return QhullPoint();
  }//getCenter
 
+//! Copy the coordinates of getCenter() to center[].  center[] has room for hull_dim coordinates
+//! Returns the number of coordinates copied, 0 if none or qh_INFINITE
+countT QhullFacet::
+getCenter(qh_PRINT printFormat, coordT *center)
+{
+    QhullPoint p= getCenter(printFormat);
+    countT n= 0;
+    for(QhullPoint::const_iterator c= p.begin(); c!=p.end(); ++c){
+        center[n++]= *c;
+    }
+    return n;
+}//getCenter center
+
 //! Return innerplane clearly below the vertices
 //! from io_r.c[qh_PRINTinner]
 QhullHyperplane QhullFacet::
@@ -42,16 +42,24 @@ QhullFacetList(const Qhull &q, facetT *b, facetT *e )
 std::vector<QhullFacet> QhullFacetList::
 toStdVector() const
 {
-    QhullLinkedListIterator<QhullFacet> i(*this);
     std::vector<QhullFacet> vs;
+    toStdVector(&vs);
+    return vs;
+}//toStdVector
+
+//! Replace the contents of vs.  Reuses its capacity
+void QhullFacetList::
+toStdVector(std::vector<QhullFacet> *vs) const
+{
+    QhullLinkedListIterator<QhullFacet> i(*this);
+    vs->clear();
     while(i.hasNext()){
         QhullFacet f= i.next();
         if(isSelectAll() || f.isGood()){
-            vs.push_back(f);
+            vs->push_back(f);
         }
     }
-    return vs;
-}//toStdVector
+}//toStdVector vs
 #endif //QHULL_NO_STL
 
 #ifndef QHULL_NO_STL
@@ -60,13 +68,17 @@ std::vector<QhullVertex> QhullFacetList::
 vertices_toStdVector() const
 {
     std::vector<QhullVertex> vs;
-    QhullVertexSet qvs(qh(), first().getFacetT(), 0, isSelectAll());
-
-    for(QhullVertexSet::iterator i=qvs.begin(); i!=qvs.end(); ++i){
-        vs.push_back(*i);
-    }
+    vertices_toStdVector(&vs);
     return vs;
 }//vertices_toStdVector
+
+//! Replace the contents of vs.  Reuses its capacity
+void QhullFacetList::
+vertices_toStdVector(std::vector<QhullVertex> *vs) const
+{
+    QhullVertexSet qvs(qh(), first().getFacetT(), 0, isSelectAll());
+    qvs.toStdVector(vs);
+}//vertices_toStdVector vs
 #endif //QHULL_NO_STL
 
 #//!\name GetSet
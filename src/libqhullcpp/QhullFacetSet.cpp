@@ -34,16 +34,24 @@ namespace orgQhull {
 std::vector<QhullFacet> QhullFacetSet::
 toStdVector() const
 {
-    QhullSetIterator<QhullFacet> i(*this);
     std::vector<QhullFacet> vs;
+    toStdVector(&vs);
+    return vs;
+}//toStdVector
+
+//! Replace the contents of vs.  Reuses its capacity
+void QhullFacetSet::
+toStdVector(std::vector<QhullFacet> *vs) const
+{
+    QhullSetIterator<QhullFacet> i(*this);
+    vs->clear();
     while(i.hasNext()){
         QhullFacet f= i.next();
         if(isSelectAll() || f.isGood()){
-            vs.push_back(f);
+            vs->push_back(f);
         }
     }
-    return vs;
-}//toStdVector
+}//toStdVector vs
 #endif //QHULL_NO_STL
 
 #//!\name GetSet
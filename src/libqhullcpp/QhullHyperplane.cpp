@@ -47,14 +47,18 @@ QhullHyperplane(const Qhull &q, int hyperplaneDimension, coordT *c, coordT hyper
 std::vector<coordT> QhullHyperplane::
 toStdVector() const
 {
-    QhullHyperplaneIterator i(*this);
     std::vector<coordT> fs;
-    while(i.hasNext()){
-        fs.push_back(i.next());
-    }
-    fs.push_back(hyperplane_offset);
+    toStdVector(&fs);
     return fs;
 }//toStdVector
+
+//! Replace the contents of fs with the normal followed by the offset.  Reuses its capacity
+void QhullHyperplane::
+toStdVector(std::vector<coordT> *fs) const
+{
+    fs->assign(begin(), end());
+    fs->push_back(hyperplane_offset);
+}//toStdVector fs
 #endif //QHULL_NO_STL
 
 #//!\name GetSet
@@ -64,13 +64,17 @@ QhullPoint(const Qhull &q, Coordinates &c)
 std::vector<coordT> QhullPoint::
 toStdVector() const
 {
-    QhullPointIterator i(*this);
     std::vector<coordT> vs;
-    while(i.hasNext()){
-        vs.push_back(i.next());
-    }
+    toStdVector(&vs);
     return vs;
 }//toStdVector
+
+//! Replace the contents of vs.  Reuses its capacity
+void QhullPoint::
+toStdVector(std::vector<coordT> *vs) const
+{
+    vs->assign(begin(), end());
+}//toStdVector vs
 #endif //QHULL_NO_STL
 
 #//!\name GetSet
@@ -72,13 +72,22 @@ QhullPoints(QhullQh *qqh, int pointDimension, countT coordinateCount2, coordT *c
 std::vector<QhullPoint> QhullPoints::
 toStdVector() const
 {
-    QhullPointsIterator i(*this);
     std::vector<QhullPoint> vs;
-    while(i.hasNext()){
-        vs.push_back(i.next());
-    }
+    toStdVector(&vs);
     return vs;
 }//toStdVector
+
+//! Replace the contents of vs.  Reuses its capacity
+void QhullPoints::
+toStdVector(std::vector<QhullPoint> *vs) const
+{
+    QhullPointsIterator i(*this);
+    vs->clear();
+    vs->reserve(size());
+    while(i.hasNext()){
+        vs->push_back(i.next());
+    }
+}//toStdVector vs
 #endif //QHULL_NO_STL
 
 #//!\name GetSet
@@ -0,0 +1,115 @@
+/****************************************************************************
+**
+** Copyright (c) 2008-2020 C.B. Barber. All rights reserved.
+** $Id: //main/2019/qhull/src/libqhullcpp/QhullPool.cpp#1 $$Change: 3010 $
+** $DateTime: 2020/07/30 22:14:11 $$Author: bbarber $
+**
+****************************************************************************/
+
+#//! QhullPool -- warm Qhull instances for many independent hulls
+
+#include "QhullPool.h"
+
+#include "QhullError.h"
+#include "QhullQh.h"
+
+#ifdef QHULL_USES_MOVE
+
+using std::vector;
+
+namespace orgQhull {
+
+#//!\name Constructors
+
+//! Each warm Qhull has initialized qh.qhmem (qh_initqhull_mem) and a first buffer of short memory
+QhullPool::
+QhullPool(countT poolSize, int hullDimension)
+: idle_qhulls()
+, pool_mutex()
+, new_count(0)
+, reuse_count(0)
+{
+    if(poolSize<0 || hullDimension<0){
+        throw QhullError(10086, "Qhull error: QhullPool expects poolSize (%d) and hullDimension (%d) >= 0", poolSize, hullDimension);
+    }
+    idle_qhulls.reserve(poolSize);
+    for(countT i= 0; i<poolSize; ++i){
+        Qhull q;
+        if(hullDimension>0){
+            warmQhull(&q, hullDimension);
+        }
+        idle_qhulls.push_back(std::move(q));
+    }
+}//QhullPool
+
+#//!\name GetSet
+
+countT QhullPool::
+idleCount()
+{
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    return static_cast<countT>(idle_qhulls.size());
+}//idleCount
+
+countT QhullPool::
+newCount()
+{
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    return new_count;
+}//newCount
+
+countT QhullPool::
+reuseCount()
+{
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    return reuse_count;
+}//reuseCount
+
+#//!\name Methods
+
+//! Moves an idle Qhull out of the pool, ready for runQhull.  Constructs a new Qhull if none are idle
+Qhull QhullPool::
+acquire()
+{
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        if(!idle_qhulls.empty()){
+            Qhull q(std::move(idle_qhulls.back()));
+            idle_qhulls.pop_back();
+            reuse_count++;
+            return q;
+        }
+        new_count++;
+    }
+    return Qhull();
+}//acquire
+
+//! Resets q outside of the lock and moves it back into the pool.  Ignores a moved-from Qhull
+void QhullPool::
+release(Qhull &&q)
+{
+    if(!q.qh()){
+        return;
+    }
+    q.resetQhull();
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    idle_qhulls.push_back(std::move(q));
+}//release
+
+#//!\name Helpers
+
+//! Run Qhull on a simplex of hullDimension, then reset it
+void QhullPool::
+warmQhull(Qhull *q, int hullDimension)
+{
+    vector<coordT> simplex((hullDimension+1)*hullDimension, 0.0);
+    for(int k= 0; k<hullDimension; ++k){
+        simplex[(k+1)*hullDimension+k]= 1.0;
+    }
+    q->runQhull("QhullPool", hullDimension, hullDimension+1, &simplex[0], "");
+    q->resetQhull();
+}//warmQhull
+
+}//namespace orgQhull
+
+#endif //QHULL_USES_MOVE
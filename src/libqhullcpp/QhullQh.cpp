@@ -84,6 +84,27 @@ checkAndFreeQhullMemory()
 #endif
 }//checkAndFreeQhullMemory
 
+//! Free the hull and reinitialize qhT for another run of Qhull, as if newly constructed
+//! Keeps qh.qhmem.  Facets, vertices, ridges, and sets return to its freelists for reuse by the next run
+//! qh_init_B skips qh_initqhull_mem.  The next run may have a different dimension.
+//!   Short allocations round up to the sizes of the first run or use long memory
+//! Does not call clearQhullMessage since RoadError's global log is not thread-safe
+void QhullQh::
+resetQhull()
+{
+    // NOerrors: TRY_QHULL_ not needed since these routines do not call qh_errexit()
+    qh_freeqhull(this, qh_ALL);
+    qh_initstatistics(this);
+    qh_initqhull_start2(this, NULL, NULL, qh_FILEstderr);
+    this->ISqhullQh= true;
+    qhull_status= qh_ERRnone;
+    qhull_message.clear();
+    error_stream= 0;
+    output_stream= 0;
+    factor_epsilon= QhullQh::default_factor_epsilon;
+    use_output_stream= false;
+}//resetQhull
+
 #//!\name Messaging
 
 void QhullQh::
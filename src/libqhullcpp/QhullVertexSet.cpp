@@ -83,6 +83,32 @@ operator=(const QhullVertexSet &other)
     return *this;
 }//assignment
 
+#ifdef QHULL_USES_MOVE
+//! Move constructor takes ownership of a qh_settemp() set.  'other' is left empty
+QhullVertexSet::
+QhullVertexSet(QhullVertexSet &&other)
+: QhullSet<QhullVertex>(other)
+, qhsettemp_defined(other.qhsettemp_defined)
+{
+    other.qhsettemp_defined= false;
+    other.forceEmpty();
+}//move constructor
+
+//! Move assignment frees this qh_settemp() set, if any, and takes ownership of other's
+QhullVertexSet & QhullVertexSet::
+operator=(QhullVertexSet &&other)
+{
+    if(this!=&other){
+        freeQhSetTemp();
+        QhullSet<QhullVertex>::operator=(other);
+        qhsettemp_defined= other.qhsettemp_defined;
+        other.qhsettemp_defined= false;
+        other.forceEmpty();
+    }
+    return *this;
+}//move assignment
+#endif //QHULL_USES_MOVE
+
 void QhullVertexSet::
 freeQhSetTemp()
 {
@@ -106,14 +132,22 @@ QhullVertexSet::
 std::vector<QhullVertex> QhullVertexSet::
 toStdVector() const
 {
-    QhullSetIterator<QhullVertex> i(*this);
     std::vector<QhullVertex> vs;
-    while(i.hasNext()){
-        QhullVertex v= i.next();
-        vs.push_back(v);
-    }
+    toStdVector(&vs);
     return vs;
 }//toStdVector
+
+//! Replace the contents of vs.  Reuses its capacity
+void QhullVertexSet::
+toStdVector(std::vector<QhullVertex> *vs) const
+{
+    QhullSetIterator<QhullVertex> i(*this);
+    vs->clear();
+    vs->reserve(count());
+    while(i.hasNext()){
+        vs->push_back(i.next());
+    }
+}//toStdVector vs
 #endif //QHULL_NO_STL
 
 #//!\name Class functions
@@ -64,6 +64,33 @@ RboxPoints::
     resetQhullQh(0);
 }
 
+#ifdef QHULL_USES_MOVE
+RboxPoints::
+RboxPoints(RboxPoints &&other)
+: PointCoordinates(std::move(other))
+, rbox_new_count(other.rbox_new_count)
+, rbox_status(other.rbox_status)
+, rbox_message(std::move(other.rbox_message))
+{
+    other.resetQhullQh(0);  // this owns other's QhullQh
+}
+
+RboxPoints & RboxPoints::
+operator=(RboxPoints &&other)
+{
+    if(this!=&other){
+        QhullQh *qqh= qh();
+        PointCoordinates::operator=(std::move(other));
+        rbox_new_count= other.rbox_new_count;
+        rbox_status= other.rbox_status;
+        rbox_message= std::move(other.rbox_message);
+        delete qqh;
+        other.resetQhullQh(0);
+    }
+    return *this;
+}//operator= move
+#endif //QHULL_USES_MOVE
+
 // RboxPoints and qh_rboxpoints has several fields in qhT (rbox_errexit..cpp_object)
 // It shares last_random with qh_rand and qh_srand
 // The other fields are unused
@@ -112,6 +139,7 @@ hasRboxMessage() const
 //! Appends points as defined by rboxCommand
 //! If dimension previously defined, adds " Ddim" to rboxCommand
 //! Appends rboxCommand to comment
+//! Generates the coordinates in place with qh_rboxbuffer.  Option 'h' is not supported
 //! For rbox commands, see http://www.qhull.org/html/rbox.htm or html/rbox.htm
 void RboxPoints::
 appendPoints(const char *rboxCommand)
@@ -141,8 +169,10 @@ appendPoints(const char *rboxCommand)
         throw QhullError(10067, "Qhull error: Extra coordinates (%d) prior to calling RboxPoints::appendPoints.  Was %s", extraCoordinatesCount(), 0, 0.0, comment().c_str());
     }
     countT previousCount= count();
+    int newDimension= 0;
+    countT newPoints= 0;
     qh()->cpp_object= this;           // for qh_fprintf_rbox()
-    int status= qh_rboxpoints(qh(), command);
+    int status= qh_rboxbuffer(qh(), command, NULL, 0, &newDimension, &newPoints); // dimension and count only
     qh()->cpp_object= 0;
     if(rbox_status==qh_ERRnone){
         rbox_status= status;
@@ -150,6 +180,22 @@ appendPoints(const char *rboxCommand)
     if(rbox_status!=qh_ERRnone){
         throw QhullError(rbox_status, rbox_message);
     }
+    setDimension(newDimension);
+    setNewCount(newPoints);
+    coordT *newCoordinates= extendCoordinates(newDimension*newPoints);
+    qh()->cpp_object= this;
+    status= qh_rboxbuffer(qh(), command, newCoordinates, newDimension*newPoints, &newDimension, &newPoints);
+    qh()->cpp_object= 0;
+    if(rbox_status==qh_ERRnone){
+        rbox_status= status;
+    }
+    if(rbox_status!=qh_ERRnone){
+        throw QhullError(rbox_status, rbox_message);
+    }
+    string seededCommand(qh()->rbox_command);  // includes the seed for 't'
+    appendComment(" \"");
+    appendComment(seededCommand.substr(seededCommand.find(' ')+1));
+    appendComment("\"");
     if(extraCoordinatesCount()!=0){
         throw QhullError(10002, "Qhull error: extra coordinates (%d) for PointCoordinates (%x)", extraCoordinatesCount(), 0, 0.0, coordinates());
     }
@@ -170,7 +216,7 @@ appendPoints(const char *rboxCommand)
     cpp_object == RboxPoints
 
 notes:
-    only called from qh_rboxpoints()
+    only called from qh_rboxbuffer() and qh_rboxpoints()
     sets rbox_status to msgcode if error 6000..6999
     same as fprintf() and Qhull.qh_fprintf()
     fgets() is not trapped like fprintf()
@@ -202,48 +248,7 @@ void qh_fprintf_rbox(qhT *qh, FILE*, int msgcode, const char *fmt, ... ) {
         va_end(args);
         return;
     }
-    switch(msgcode){
-    case 9391:
-    case 9392:
-        out->rbox_message += "QH10010 Qhull input error (RboxPoints): options 'h', 'n' not supported.\n";
-        qh_errexit_rbox(qh, 10);
-        /* never returns */
-        break;
-    case 9393:  // QH11026 FIX: countT vs. int
-        {
-            int dimension= va_arg(args, int);
-            string command(va_arg(args, char*));
-            countT count= va_arg(args, countT);
-            out->setDimension(dimension);
-            out->appendComment(" \"");
-            out->appendComment(command.substr(command.find(' ')+1));
-            out->appendComment("\"");
-            out->setNewCount(count);
-            out->reservePoints();
-        }
-        break;
-    case 9407:
-        *out << va_arg(args, int);
-        // fall through
-    case 9405:
-        *out << va_arg(args, int);
-        // fall through
-    case 9403:
-        *out << va_arg(args, int);
-        break;
-    case 9408:
-        *out << va_arg(args, double);
-        // fall through
-    case 9406:
-        *out << va_arg(args, double);
-        // fall through
-    case 9404:
-        *out << va_arg(args, double);
-        break;
-    default:
-        // do nothing
-        break;
-    }
+    // RboxPoints generates points with qh_rboxbuffer.  Ignore other output
     va_end(args);
 } /* qh_fprintf_rbox */
 
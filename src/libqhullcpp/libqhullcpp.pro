@@ -35,6 +35,7 @@ SOURCES += ../libqhullcpp/QhullHyperplane.cpp
 SOURCES += ../libqhullcpp/QhullPoint.cpp
 SOURCES += ../libqhullcpp/QhullPoints.cpp
 SOURCES += ../libqhullcpp/QhullPointSet.cpp
+SOURCES += ../libqhullcpp/QhullPool.cpp
 SOURCES += ../libqhullcpp/QhullQh.cpp
 SOURCES += ../libqhullcpp/QhullRidge.cpp
 SOURCES += ../libqhullcpp/QhullSet.cpp
@@ -59,6 +60,7 @@ HEADERS += ../libqhullcpp/QhullLinkedList.h
 HEADERS += ../libqhullcpp/QhullPoint.h
 HEADERS += ../libqhullcpp/QhullPoints.h
 HEADERS += ../libqhullcpp/QhullPointSet.h
+HEADERS += ../libqhullcpp/QhullPool.h
 HEADERS += ../libqhullcpp/QhullQh.h
 HEADERS += ../libqhullcpp/QhullRidge.h
 HEADERS += ../libqhullcpp/QhullSet.h
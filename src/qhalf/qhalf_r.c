@@ -80,11 +80,15 @@ Qhull extra options:\n\
     Qw   - allow option warnings\n\
     Q12  - allow wide facets and wide dupridge\n\
     Q14  - merge pinched vertices that create a dupridge\n\
+    Q16  - reuse the initial simplex when 'QJ' restarts\n\
+    Q18  - build 2-d hulls directly by a monotone chain\n\
+    Q19  - build 3-d hulls with a half-edge triangulation\n\
 \n\
 T options:\n\
     TFn  - report summary when n or more facets created\n\
     TI file - input file, may be enclosed in single quotes\n\
     TO file - output file, may be enclosed in single quotes\n\
+    Tj   - JSON profile of wall-clock time by phase\n\
     Ts   - statistics\n\
     Tv   - verify result: structure, convexity, and in-circle test\n\
     Tz   - send all output to stdout\n\
@@ -244,8 +248,8 @@ Except for 'F.' and 'PG', upper_case options take an argument.\n\
  QJoggle        QRotate        Qsearch-all    Qtriangulate   QVertex-good\n\
  Qwarn-allow    Q12-allow-wide Q14-merge-pinched\n\
 \n\
- TFacet-log     TInput-file    TOutput-file   Tstatistics    Tverify\n\
- Tz-stdout\n\
+ TFacet-log     TInput-file    Tjson-profile  TOutput-file   Tstatistics\n\
+ Tverify        Tz-stdout\n\
 \n\
  T4-trace       Tannotate      TAdd-stop      Tcheck-often   TCone-stop\n\
  Tflush         TMerge-trace   TPoint-trace   TVertex-stop   TWide-trace\n\
@@ -320,6 +324,8 @@ qhull error: options 'Qbk:n' and 'QBk:n' are not used with qhalf.\n\
     qh_produce_output(qh);
     if (qh->VERIFYoutput && !qh->FORCEoutput && !qh->STOPpoint && !qh->STOPcone)
       qh_check_points(qh);
+    if (qh->PRINTprofile)
+      qh_printprofile(qh, qh->ferr);
     exitcode= qh_ERRnone;
   }
   qh->NOerrexit= True;  /* no more setjmp */
@@ -71,6 +71,7 @@ Qhull control options:\n\
     Qbb  - scale last coordinate to [0,m] for Delaunay triangulations\n\
     Qbk:0Bk:0 - remove k-th coordinate from input\n\
     QJn  - randomly joggle input in range [-n,n]\n\
+    QPn  - use up to n threads for parallel sections (OpenMP)\n\
     QRn  - random rotation (n=seed, n=0 time, n=-1 time/no rotate)\n\
     Qs   - search all points for the initial simplex\n\
     Qu   - for 'd' or 'v', compute upper hull without point at-infinity\n\
@@ -104,11 +105,15 @@ Qhull extra options:\n\
     Q12  - allow wide facets and wide dupridge\n\
     Q14  - merge pinched vertices that create a dupridge\n\
     Q15  - check for duplicate ridges with the same vertices\n\
+    Q16  - reuse the initial simplex when 'QJ' restarts\n\
+    Q18  - build 2-d hulls directly by a monotone chain\n\
+    Q19  - build 3-d hulls with a half-edge triangulation\n\
 \n\
 T options:\n\
     TFn  - report summary when n or more facets created\n\
     TI file - input file, may be enclosed in single quotes\n\
     TO file - output file, may be enclosed in single quotes\n\
+    Tj   - JSON profile of wall-clock time by phase\n\
     Ts   - statistics\n\
     Tv   - verify result: structure, convexity, and point inclusion\n\
     Tz   - send all output to stdout\n\
@@ -311,17 +316,18 @@ Except for 'F.' and 'PG', upper-case options take an argument.\n\
  Qtriangulate   QupperDelaunay Qwarn-allow    Qxact-merge    Qzinfinite\n\
 \n\
  Qfurthest      Qgood-only     QGood-point    Qmax-outside   Qrandom\n\
- Qvneighbors    QVertex-good\n\
+ QParallel      Qvneighbors    QVertex-good\n\
 \n\
 %s"; /* split literal */
 char qh_prompt3b[]= "\
  Q0-no-premerge Q1-angle-merge     Q2-no-independ  Q3-no-redundant\n\
  Q4-no-old      Q5-no-check-out    Q6-no-concave   Q7-depth-first\n\
  Q8-no-near-in  Q9-pick-furthest   Q10-no-narrow   Q11-trinormals\n\
- Q12-allow-wide Q14-merge-pinched  Q15-duplicates\n\
+ Q12-allow-wide Q14-merge-pinched  Q15-duplicates  Q16-reuse-simplex\n\
+ Q18-build-2d   Q19-build-3d\n\
 \n\
- TFacet-log     TInput-file    TOutput-file   Tstatistics    Tverify\n\
- Tz-stdout\n\
+ TFacet-log     TInput-file    Tjson-profile  TOutput-file   Tstatistics\n\
+ Tverify        Tz-stdout\n\
 \n\
  T4-trace       Tannotate      TAdd-stop      Tcheck-often   TCone-stop\n\
  Tflush         TMerge-trace   TPoint-trace   TRerun         TVertex-stop\n\
@@ -393,6 +399,8 @@ int main(int argc, char *argv[]) {
     qh_produce_output(qh);
     if (qh->VERIFYoutput && !qh->FORCEoutput && !qh->STOPadd && !qh->STOPcone && !qh->STOPpoint)
       qh_check_points(qh);
+    if (qh->PRINTprofile)
+      qh_printprofile(qh, qh->ferr);
     exitcode= qh_ERRnone;
   }
   qh->NOerrexit= true;  /* no more setjmp */
@@ -0,0 +1,681 @@
+#//! qhullbench_r.cpp -- Repeatable microbenchmarks of libqhull_r and end-to-end timings like eg/q_benchmark
+
+#include "RboxPoints.h"
+#include "QhullError.h"
+#include "QhullQh.h"
+#include "Qhull.h"
+
+#include <algorithm> // sort
+#include <cstdio>    // FILE, tmpfile
+#include <cstdlib>   // atof, atoi
+#include <cstring>   // strcmp, strncmp
+#include <fstream>
+#include <iomanip>   // setw, setprecision
+#include <iostream>
+#include <sstream>   // ostringstream
+#include <string>
+#include <vector>
+
+using std::cerr;
+using std::cout;
+using std::endl;
+using std::string;
+using std::vector;
+
+using orgQhull::Qhull;
+using orgQhull::QhullError;
+using orgQhull::QhullQh;
+using orgQhull::RboxPoints;
+
+int main(int argc, char **argv);
+int qhullbench(int argc, char **argv);
+
+char prompt[]= "\n========\n\
+qhullbench [options] [case or group ...] -- repeatable benchmarks of reentrant Qhull\n\
+\n\
+Microbenchmarks time a libqhull_r routine on a hull built before timing.\n\
+End-to-end cases time Qhull::runQhull like TIME_INTERIOR, TIME_SPHERE, and\n\
+TIME_DELAUNAY of eg/q_benchmark.  Input points use rbox with a fixed seed ('tn').\n\
+Each case reports the minimum, median, and mean of its repetitions.\n\
+\n\
+Options:\n\
+  list                 List the cases and exit\n\
+  csv                  Print results as comma-separated values\n\
+  json                 Print results as a JSON object\n\
+  repeat n             Repetitions of each case (default 5)\n\
+  seed n               rbox seed and seed for random matrices (default 1)\n\
+  scale f              Multiply the number of points by f, e.g., 0.1 for a quick run (default 1)\n\
+  baseline file        Compare medians with 'qhullbench csv' output from a previous build\n\
+  threshold pct        Report 'slower' or 'faster' if the median changed by more than pct percent (default 10)\n\
+\n\
+Groups are 'micro', 'interior', 'sphere', 'delaunay', 'highdim', 'planar', and 'build3d'.\n\
+A case or group may be a prefix, e.g., 'find' or 'sphere-D4'.  Default is all cases.\n\
+\n\
+Exits with status 1 if a case is slower than its baseline.\n\
+\n\
+For example\n\
+  qhullbench list\n\
+  qhullbench micro\n\
+  qhullbench csv scale 0.1 >before.csv\n\
+  qhullbench scale 0.1 baseline before.csv\n\
+  qhullbench json repeat 10 interior-D3 delaunay\n\
+";
+
+#//!\name Benchmark cases
+
+//! Options from the command line
+struct BenchOptions {
+    int                 repeat;
+    int                 seed;
+    double              scale;
+    double              threshold;      //!< fraction of the baseline median, e.g., 0.10
+};
+
+//! Timings for a case
+struct BenchResult {
+    string              name;
+    string              input;          //!< rbox and qhull options
+    countT              ops;            //!< operations per repetition
+    vector<double>      seconds;        //!< wall-clock seconds of each repetition
+    double              baseline;       //!< median seconds from the baseline file, or 0.0 if none
+
+    double              minSeconds() const { return seconds.empty() ? 0.0 : *std::min_element(seconds.begin(), seconds.end()); }
+    double              meanSeconds() const;
+    double              medianSeconds() const;
+    double              nsPerOp() const { return ops>0 ? 1e9*medianSeconds()/ops : 0.0; }
+    double              ratio() const { return baseline>0.0 ? medianSeconds()/baseline : 0.0; }
+    const char *        verdict(double threshold) const;
+};
+
+struct BenchCase;
+typedef void (*BenchFunction)(const BenchCase &c, const BenchOptions &options, BenchResult *result);
+
+//! A case is a benchmark function with its input
+struct BenchCase {
+    const char *        name;
+    const char *        group;
+    int                 pointCount;     //!< before 'scale'
+    const char *        rboxOptions;    //!< without the point count and seed
+    const char *        qhullOptions;
+    BenchFunction       function;
+    const char *        description;
+};
+
+void benchDistplane(const BenchCase &c, const BenchOptions &options, BenchResult *result);
+void benchFindbest(const BenchCase &c, const BenchOptions &options, BenchResult *result);
+void benchFindbestnew(const BenchCase &c, const BenchOptions &options, BenchResult *result);
+void benchGausselim(const BenchCase &c, const BenchOptions &options, BenchResult *result);
+void benchMemalloc(const BenchCase &c, const BenchOptions &options, BenchResult *result);
+void benchQhull(const BenchCase &c, const BenchOptions &options, BenchResult *result);
+void benchReadpoints(const BenchCase &c, const BenchOptions &options, BenchResult *result);
+void benchSetappend(const BenchCase &c, const BenchOptions &options, BenchResult *result);
+void benchTriangulate(const BenchCase &c, const BenchOptions &options, BenchResult *result);
+void readPoints(QhullQh *qh);
+void triangulateHull(QhullQh *qh);
+
+//! Point counts and options of the end-to-end cases are from eg/q_benchmark
+BenchCase benchCases[]= {
+    {"distplane", "micro", 100000, "D3", "", benchDistplane, "qh_distplane of each point to a facet"},
+    {"findbest", "micro", 100000, "D3", "", benchFindbest, "qh_findbest of each point from qh.facet_list"},
+    {"findbestnew", "micro", 100000, "D3", "", benchFindbestnew, "qh_findbestnew of each point for a cone of 64 facets"},
+    {"matchnewfacets", "micro", 5000, "s D4", "C0.01", benchTriangulate, "qh_triangulate of merged facets, mostly qh_matchnewfacets"},
+    {"setappend-setin", "micro", 1000, "D3", "", benchSetappend, "qh_setappend and qh_setin for sets of 64 elements"},
+    {"memalloc-memfree", "micro", 1000, "D3", "", benchMemalloc, "qh_memalloc and qh_memfree of facet, vertex, ridge, and set sizes"},
+    {"gausselim-D4", "micro", 1000, "D4", "", benchGausselim, "qh_gausselim of random 4x4 matrices"},
+    {"gausselim-D8", "micro", 1000, "D8", "", benchGausselim, "qh_gausselim of random 8x8 matrices"},
+    {"readpoints", "micro", 100000, "D3", "", benchReadpoints, "qh_readpoints of rbox output from a temporary file"},
+    {"interior-D2", "interior", 1000000, "D2", "", benchQhull, "TIME_INTERIOR, random points in a cube"},
+    {"interior-D3", "interior", 500000, "D3", "", benchQhull, "TIME_INTERIOR"},
+    {"interior-D4", "interior", 200000, "D4", "", benchQhull, "TIME_INTERIOR"},
+    {"interior-D5", "interior", 100000, "D5", "Q12", benchQhull, "TIME_INTERIOR"},
+    {"interior-D6", "interior", 3000, "D6", "", benchQhull, "TIME_INTERIOR"},
+    {"sphere-D2", "sphere", 100000, "s D2", "", benchQhull, "TIME_SPHERE, cospherical points"},
+    {"sphere-D3", "sphere", 100000, "s D3", "", benchQhull, "TIME_SPHERE"},
+    {"sphere-D4", "sphere", 50000, "s D4", "", benchQhull, "TIME_SPHERE"},
+    {"sphere-D5", "sphere", 10000, "s D5", "", benchQhull, "TIME_SPHERE"},
+    {"sphere-D6", "sphere", 1000, "s D6", "", benchQhull, "TIME_SPHERE"},
+    {"delaunay-D2", "delaunay", 100000, "D2", "d Qbb Qz", benchQhull, "TIME_DELAUNAY, Delaunay triangulation of random points"},
+    {"delaunay-D3", "delaunay", 50000, "D3", "d Qbb Qz", benchQhull, "TIME_DELAUNAY"},
+    {"delaunay-D4", "delaunay", 10000, "D4", "d Qbb Qz", benchQhull, "TIME_DELAUNAY"},
+    {"delaunay-D5", "delaunay", 1000, "D5", "d Qbb Qz", benchQhull, "TIME_DELAUNAY"},
+    {"delaunay-D6", "delaunay", 200, "D6", "d Qbb Qz", benchQhull, "TIME_DELAUNAY"},
+    {"highdim-D8", "highdim", 150, "D8", "", benchQhull, "random points in an 8-d cube"},
+    {"highdim-D10", "highdim", 50, "D10", "", benchQhull, "random points in a 10-d cube"},
+    {"highdim-D12", "highdim", 35, "D12", "", benchQhull, "random points in a 12-d cube"},
+    {"planar-D2", "planar", 1000000, "D2", "Q18", benchQhull, "2-d hull by qh_buildhull2d ('Q18'), same points as interior-D2"},
+    {"planar-circle", "planar", 100000, "s D2", "Q18", benchQhull, "'Q18' with cocircular points, same points as sphere-D2"},
+    {"build3d-D3", "build3d", 500000, "D3", "Q19", benchQhull, "3-d hull by qh_buildhull3d ('Q19'), same points as interior-D3"},
+    {"build3d-sphere", "build3d", 100000, "s D3", "Q19", benchQhull, "'Q19' with cospherical points, same points as sphere-D3"},
+    {"build3d-joggle", "build3d", 500000, "W1e-13 D3", "QJ Q19", benchQhull, "'Q19' with joggled points near the surface of a cube, TIME_JOGGLE"},
+};
+const int benchCount= static_cast<int>(sizeof(benchCases)/sizeof(BenchCase));
+
+//! Sum of results, to keep the compiler from removing a benchmark loop
+double benchSink= 0.0;
+
+/*--------------------------------------------
+-main-  main procedure of qhullbench
+*/
+int main(int argc, char **argv){
+
+    QHULL_LIB_CHECK
+
+    try{
+        return qhullbench(argc, argv);
+    }catch(QhullError &e){
+        cerr << e.what() << std::endl;
+        return e.errorCode();
+    }
+}//main
+
+#//!\name BenchResult
+
+double BenchResult::
+meanSeconds() const
+{
+    double total= 0.0;
+    for(size_t i= 0; i<seconds.size(); ++i){
+        total += seconds[i];
+    }
+    return seconds.empty() ? 0.0 : total/static_cast<double>(seconds.size());
+}//meanSeconds
+
+double BenchResult::
+medianSeconds() const
+{
+    if(seconds.empty()){
+        return 0.0;
+    }
+    vector<double> sorted(seconds);
+    std::sort(sorted.begin(), sorted.end());
+    size_t n= sorted.size();
+    return (n%2 ? sorted[n/2] : (sorted[n/2-1]+sorted[n/2])/2.0);
+}//medianSeconds
+
+//! 'slower', 'faster', or 'same' compared to the baseline, or "" if no baseline
+const char * BenchResult::
+verdict(double threshold) const
+{
+    if(baseline<=0.0){
+        return "";
+    }
+    double r= ratio();
+    return (r > 1.0+threshold ? "slower" : (r < 1.0-threshold ? "faster" : "same"));
+}//verdict
+
+#//!\name Helpers
+
+//! Number of points for a case after 'scale'.  At least enough for an initial simplex
+int benchPointCount(const BenchCase &c, const BenchOptions &options)
+{
+    int n= static_cast<int>(c.pointCount*options.scale + 0.5);
+    return (n < 20 ? 20 : n);
+}//benchPointCount
+
+//! rbox command for a case, e.g., '500000 D3 t1'
+string benchRbox(const BenchCase &c, const BenchOptions &options)
+{
+    std::ostringstream os;
+    os << benchPointCount(c, options) << " " << c.rboxOptions << " t" << options.seed;
+    return os.str();
+}//benchRbox
+
+//! Deterministic pseudo-random numbers in [-1,1), independent of the C library
+double benchRandom(unsigned int *state)
+{
+    *state= *state * 1103515245u + 12345u;
+    return ((*state >> 8) & 0xFFFFFF) / double(0x800000) - 1.0;
+}//benchRandom
+
+#//!\name Microbenchmarks
+
+void benchDistplane(const BenchCase &c, const BenchOptions &options, BenchResult *result)
+{
+    RboxPoints rbox(benchRbox(c, options).c_str());
+    Qhull q(rbox, c.qhullOptions);  // Qhull does not copy the points
+    QhullQh *qh= q.qh();
+    vector<facetT *> facets;
+    for(facetT *facet= qh->facet_list; facet && facet->next; facet= facet->next){
+        facets.push_back(facet);
+    }
+    countT numfacets= static_cast<countT>(facets.size());
+    result->ops= qh->num_points;
+    for(int r= 0; r<options.repeat; ++r){
+        double dist;
+        double total= 0.0;
+        double start= qh_wallclock();
+        for(int i= 0; i<qh->num_points; ++i){
+            qh_distplane(qh, qh_point(qh, i), facets[i % numfacets], &dist);
+            total += dist;
+        }
+        result->seconds.push_back(qh_wallclock() - start);
+        benchSink += total;
+    }
+}//benchDistplane
+
+void benchFindbest(const BenchCase &c, const BenchOptions &options, BenchResult *result)
+{
+    RboxPoints rbox(benchRbox(c, options).c_str());
+    Qhull q(rbox, c.qhullOptions);  // Qhull does not copy the points
+    QhullQh *qh= q.qh();
+    result->ops= qh->num_points;
+    for(int r= 0; r<options.repeat; ++r){
+        double dist;
+        double total= 0.0;
+        bool isoutside;
+        int numpart;
+        double start= qh_wallclock();
+        for(int i= 0; i<qh->num_points; ++i){
+            qh_findbest(qh, qh_point(qh, i), qh->facet_list, !qh_ALL, !qh_ISnewfacets, !qh_NOupper, &dist, &isoutside, &numpart);
+            total += dist;
+        }
+        result->seconds.push_back(qh_wallclock() - start);
+        benchSink += total;
+    }
+}//benchFindbest
+
+//! Treats the last 64 facets of qh.facet_list as a cone of new facets for qh_findbestnew
+void benchFindbestnew(const BenchCase &c, const BenchOptions &options, BenchResult *result)
+{
+    RboxPoints rbox(benchRbox(c, options).c_str());
+    Qhull q(rbox, c.qhullOptions);  // Qhull does not copy the points
+    QhullQh *qh= q.qh();
+    facetT *newfacets= qh->facet_tail;
+    for(int k= 0; k<64 && newfacets->previous; ++k){
+        newfacets= newfacets->previous;
+    }
+    facetT *oldnewfacets= qh->newfacet_list;
+    qh->newfacet_list= newfacets;
+    result->ops= qh->num_points;
+    for(int r= 0; r<options.repeat; ++r){
+        double dist;
+        double total= 0.0;
+        bool isoutside;
+        int numpart;
+        double start= qh_wallclock();
+        for(int i= 0; i<qh->num_points; ++i){
+            qh_findbestnew(qh, qh_point(qh, i), newfacets, &dist, qh_ALL, &isoutside, &numpart);
+            total += dist;
+        }
+        result->seconds.push_back(qh_wallclock() - start);
+        benchSink += total;
+    }
+    qh->newfacet_list= oldnewfacets;
+}//benchFindbestnew
+
+//! qh_triangulate in its own function.  Otherwise longjmp may clobber the caller's loop variable
+void triangulateHull(QhullQh *qh)
+{
+    QH_TRY_(qh){ // no object creation -- destructors skipped on longjmp()
+        qh_triangulate(qh);
+    }
+    qh->NOerrexit= true;
+    qh->maybeThrowQhullMessage(QH_TRY_status);
+}//triangulateHull
+
+//! Each repetition builds a post-merged hull before timing.  qh_triangulate calls qh_matchnewfacets for the new facets
+void benchTriangulate(const BenchCase &c, const BenchOptions &options, BenchResult *result)
+{
+    for(int r= 0; r<options.repeat; ++r){
+        RboxPoints rbox(benchRbox(c, options).c_str());
+        Qhull q(rbox, c.qhullOptions);
+        QhullQh *qh= q.qh();
+        result->ops= qh->num_facets;
+        double start= qh_wallclock();
+        triangulateHull(qh);
+        result->seconds.push_back(qh_wallclock() - start);
+        benchSink += qh->num_facets;
+    }
+}//benchTriangulate
+
+void benchSetappend(const BenchCase &c, const BenchOptions &options, BenchResult *result)
+{
+    const int numsets= 20000;
+    const int setsize= 64;
+    RboxPoints rbox(benchRbox(c, options).c_str());
+    Qhull q(rbox, c.qhullOptions);  // Qhull does not copy the points
+    QhullQh *qh= q.qh();
+    vector<void *> elements(setsize);
+    for(int k= 0; k<setsize; ++k){
+        elements[k]= qh_point(qh, k % qh->num_points) + k;
+    }
+    result->ops= numsets*setsize*2;
+    for(int r= 0; r<options.repeat; ++r){
+        int found= 0;
+        double start= qh_wallclock();
+        for(int i= 0; i<numsets; ++i){
+            setT *set= NULL;
+            for(int k= 0; k<setsize; ++k){
+                qh_setappend(qh, &set, elements[k]);
+            }
+            for(int k= setsize; k--; ){
+                found += qh_setin(set, elements[k]);
+            }
+            qh_setfree(qh, &set);
+        }
+        result->seconds.push_back(qh_wallclock() - start);
+        benchSink += found;
+    }
+}//benchSetappend
+
+//! Allocates a batch of objects and frees them in reverse order
+void benchMemalloc(const BenchCase &c, const BenchOptions &options, BenchResult *result)
+{
+    const int numbatches= 200;
+    const int batchsize= 1000;
+    RboxPoints rbox(benchRbox(c, options).c_str());
+    Qhull q(rbox, c.qhullOptions);  // Qhull does not copy the points
+    QhullQh *qh= q.qh();
+    int sizes[6]= { (int)sizeof(facetT), (int)sizeof(vertexT), (int)sizeof(ridgeT), qh->normal_size,
+                    (int)sizeof(setT) + 3*SETelemsize, (int)sizeof(setT) + 7*SETelemsize };
+    vector<void *> objects(batchsize);
+    result->ops= numbatches*batchsize*2;
+    for(int r= 0; r<options.repeat; ++r){
+        double start= qh_wallclock();
+        for(int i= 0; i<numbatches; ++i){
+            for(int k= 0; k<batchsize; ++k){
+                objects[k]= qh_memalloc(qh, sizes[k % 6]);
+            }
+            for(int k= batchsize; k--; ){
+                qh_memfree(qh, objects[k], sizes[k % 6]);
+            }
+        }
+        result->seconds.push_back(qh_wallclock() - start);
+    }
+}//benchMemalloc
+
+//! Random square matrices of the hull's dimension.  The matrices are copied before each qh_gausselim
+void benchGausselim(const BenchCase &c, const BenchOptions &options, BenchResult *result)
+{
+    const int nummatrix= 1000;
+    const int numcopies= 100;
+    RboxPoints rbox(benchRbox(c, options).c_str());
+    Qhull q(rbox, c.qhullOptions);  // Qhull does not copy the points
+    QhullQh *qh= q.qh();
+    int dim= qh->hull_dim;
+    unsigned int state= static_cast<unsigned int>(options.seed);
+    vector<realT> matrices(nummatrix*dim*dim);
+    for(size_t i= 0; i<matrices.size(); ++i){
+        matrices[i]= benchRandom(&state);
+    }
+    vector<realT> matrix(dim*dim);
+    vector<realT *> rows(dim);
+    for(int k= 0; k<dim; ++k){
+        rows[k]= &matrix[k*dim];
+    }
+    result->ops= nummatrix*numcopies;
+    for(int r= 0; r<options.repeat; ++r){
+        bool sign;
+        bool nearzero;
+        double total= 0.0;
+        double start= qh_wallclock();
+        for(int j= 0; j<numcopies; ++j){
+            for(int i= 0; i<nummatrix; ++i){
+                std::copy(matrices.begin() + i*dim*dim, matrices.begin() + (i+1)*dim*dim, matrix.begin());
+                qh_gausselim(qh, &rows[0], dim, dim, &sign, &nearzero);
+                total += rows[dim-1][dim-1];
+            }
+        }
+        result->seconds.push_back(qh_wallclock() - start);
+        benchSink += total;
+    }
+}//benchGausselim
+
+//! qh_readpoints from qh.fin in its own function.  Otherwise longjmp may clobber the caller's loop variable
+void readPoints(QhullQh *qh)
+{
+    QH_TRY_(qh){ // no object creation -- destructors skipped on longjmp()
+        int readcount;
+        int readdim;
+        bool ismalloc;
+        coordT *points= qh_readpoints(qh, &readcount, &readdim, &ismalloc);
+        benchSink += points[0] + readcount;
+        qh_free(points);
+    }
+    qh->NOerrexit= true;
+    qh->maybeThrowQhullMessage(QH_TRY_status);
+}//readPoints
+
+//! Writes the rbox points to a temporary file, then reads them with qh_readpoints for each repetition
+void benchReadpoints(const BenchCase &c, const BenchOptions &options, BenchResult *result)
+{
+    RboxPoints rbox(benchRbox(c, options).c_str());
+    int dim= rbox.dimension();
+    countT numpoints= rbox.count();
+    const coordT *coordinates= rbox.coordinates();
+    FILE *fp= tmpfile();
+    if(!fp){
+        throw QhullError(10090, "qhullbench error: cannot open a temporary file for benchmark 'readpoints'");
+    }
+    fprintf(fp, "%d rbox %s\n%d\n", dim, benchRbox(c, options).c_str(), numpoints);
+    for(countT i= 0; i<numpoints; ++i){
+        for(int k= 0; k<dim; ++k){
+            fprintf(fp, "%.16g ", coordinates[i*dim+k]);
+        }
+        fprintf(fp, "\n");
+    }
+    result->ops= numpoints;
+    for(int r= 0; r<options.repeat; ++r){
+        Qhull q;
+        QhullQh *qh= q.qh();
+        rewind(fp);
+        qh->fin= fp;
+        double start= qh_wallclock();
+        readPoints(qh);
+        result->seconds.push_back(qh_wallclock() - start);
+        qh->fin= NULL;
+    }
+    fclose(fp);
+}//benchReadpoints
+
+#//!\name End-to-end benchmarks
+
+//! Time Qhull::runQhull for the rbox points of a case.  The points are generated before timing
+void benchQhull(const BenchCase &c, const BenchOptions &options, BenchResult *result)
+{
+    RboxPoints rbox(benchRbox(c, options).c_str());
+    result->ops= rbox.count();
+    for(int r= 0; r<options.repeat; ++r){
+        Qhull q;
+        double start= qh_wallclock();
+        q.runQhull(rbox, c.qhullOptions);
+        result->seconds.push_back(qh_wallclock() - start);
+        benchSink += q.facetCount();
+    }
+}//benchQhull
+
+#//!\name Baseline and output
+
+//! Read medians from 'qhullbench csv' output.  Sets BenchResult::baseline for matching names
+void readBaseline(const char *filename, vector<BenchResult> *results)
+{
+    std::ifstream in(filename);
+    if(!in){
+        throw QhullError(10091, "qhullbench error: cannot read baseline file '%s'", 0, 0, 0.0, filename);
+    }
+    string line;
+    int medianColumn= -1;
+    while(std::getline(in, line)){
+        vector<string> fields;
+        std::istringstream is(line);
+        string field;
+        while(std::getline(is, field, ',')){
+            fields.push_back(field);
+        }
+        if(fields.empty()){
+            continue;
+        }
+        if(fields[0]=="name"){
+            for(size_t k= 0; k<fields.size(); ++k){
+                if(fields[k]=="median_seconds"){
+                    medianColumn= static_cast<int>(k);
+                }
+            }
+        }else if(medianColumn>0 && static_cast<int>(fields.size())>medianColumn){
+            for(size_t i= 0; i<results->size(); ++i){
+                if((*results)[i].name==fields[0]){
+                    (*results)[i].baseline= atof(fields[medianColumn].c_str());
+                }
+            }
+        }
+    }
+    if(medianColumn<0){
+        throw QhullError(10092, "qhullbench error: baseline file '%s' is not from 'qhullbench csv'.  It needs a header line with 'name' and 'median_seconds'", 0, 0, 0.0, filename);
+    }
+}//readBaseline
+
+void printText(const vector<BenchResult> &results, const BenchOptions &options, bool hasBaseline)
+{
+    cout << std::left << std::setw(18) << "case" << std::setw(24) << "input" << std::right << std::setw(10) << "ops"
+         << std::setw(12) << "median ms" << std::setw(12) << "min ms" << std::setw(12) << "ns/op";
+    if(hasBaseline){
+        cout << std::setw(12) << "baseline ms" << std::setw(8) << "ratio" << "  verdict";
+    }
+    cout << "\n" << std::fixed;
+    for(size_t i= 0; i<results.size(); ++i){
+        const BenchResult &r= results[i];
+        cout << std::left << std::setw(18) << r.name << std::setw(24) << r.input << std::right << std::setw(10) << r.ops
+             << std::setprecision(3) << std::setw(12) << 1000.0*r.medianSeconds() << std::setw(12) << 1000.0*r.minSeconds()
+             << std::setprecision(1) << std::setw(12) << r.nsPerOp();
+        if(r.baseline>0.0){
+            cout << std::setprecision(3) << std::setw(12) << 1000.0*r.baseline << std::setw(8) << r.ratio() << "  " << r.verdict(options.threshold);
+        }
+        cout << "\n";
+    }
+}//printText
+
+void printCsv(const vector<BenchResult> &results, const BenchOptions &options, bool hasBaseline)
+{
+    cout << "name,input,repeat,ops,min_seconds,median_seconds,mean_seconds,ns_per_op";
+    if(hasBaseline){
+        cout << ",baseline_median_seconds,ratio,verdict";
+    }
+    cout << "\n" << std::setprecision(9);
+    for(size_t i= 0; i<results.size(); ++i){
+        const BenchResult &r= results[i];
+        cout << r.name << "," << r.input << "," << r.seconds.size() << "," << r.ops << "," << r.minSeconds()
+             << "," << r.medianSeconds() << "," << r.meanSeconds() << "," << r.nsPerOp();
+        if(hasBaseline){
+            cout << "," << r.baseline << "," << r.ratio() << "," << r.verdict(options.threshold);
+        }
+        cout << "\n";
+    }
+}//printCsv
+
+void printJson(const vector<BenchResult> &results, const BenchOptions &options, bool hasBaseline)
+{
+    cout << std::setprecision(9);
+    cout << "{\n  \"qhullbench\": 1,\n  \"version\": \"" << qh_version << "\",\n  \"repeat\": " << options.repeat
+         << ", \"seed\": " << options.seed << ", \"scale\": " << options.scale << ", \"threshold\": " << options.threshold
+         << ",\n  \"results\": [";
+    for(size_t i= 0; i<results.size(); ++i){
+        const BenchResult &r= results[i];
+        cout << (i ? ",\n" : "\n") << "    {\"name\": \"" << r.name << "\", \"input\": \"" << r.input << "\", \"ops\": " << r.ops
+             << ", \"min_seconds\": " << r.minSeconds() << ", \"median_seconds\": " << r.medianSeconds()
+             << ", \"mean_seconds\": " << r.meanSeconds() << ", \"ns_per_op\": " << r.nsPerOp() << ", \"seconds\": [";
+        for(size_t k= 0; k<r.seconds.size(); ++k){
+            cout << (k ? ", " : "") << r.seconds[k];
+        }
+        cout << "]";
+        if(hasBaseline && r.baseline>0.0){
+            cout << ", \"baseline_median_seconds\": " << r.baseline << ", \"ratio\": " << r.ratio()
+                 << ", \"verdict\": \"" << r.verdict(options.threshold) << "\"";
+        }
+        cout << "}";
+    }
+    cout << "\n  ]\n}\n";
+}//printJson
+
+#//!\name Main
+
+//! True if arg selects case c by name, group, or prefix of its name
+bool isSelected(const BenchCase &c, const char *arg)
+{
+    return strcmp(arg, c.group)==0 || strncmp(arg, c.name, strlen(arg))==0;
+}//isSelected
+
+int qhullbench(int argc, char **argv)
+{
+    BenchOptions options= { 5, 1, 1.0, 0.10 };
+    const char *format= "text";
+    const char *baseline= NULL;
+    vector<const char *> selections;
+    for(int i= 1; i<argc; ++i){
+        const char *arg= argv[i];
+        bool hasValue= (i+1<argc);
+        if(strcmp(arg, "list")==0){
+            for(int k= 0; k<benchCount; ++k){
+                cout << std::left << std::setw(18) << benchCases[k].name << std::setw(10) << benchCases[k].group
+                     << benchCases[k].pointCount << " " << benchCases[k].rboxOptions << " | " << benchCases[k].qhullOptions
+                     << " -- " << benchCases[k].description << "\n";
+            }
+            return 0;
+        }else if(strcmp(arg, "csv")==0 || strcmp(arg, "json")==0){
+            format= arg;
+        }else if(strcmp(arg, "repeat")==0 && hasValue){
+            options.repeat= atoi(argv[++i]);
+        }else if(strcmp(arg, "seed")==0 && hasValue){
+            options.seed= atoi(argv[++i]);
+        }else if(strcmp(arg, "scale")==0 && hasValue){
+            options.scale= atof(argv[++i]);
+        }else if(strcmp(arg, "threshold")==0 && hasValue){
+            options.threshold= atof(argv[++i])/100.0;
+        }else if(strcmp(arg, "baseline")==0 && hasValue){
+            baseline= argv[++i];
+        }else if(strcmp(arg, "-?")==0 || strcmp(arg, "help")==0){
+            cout << prompt;
+            return 0;
+        }else{
+            bool isCase= false;
+            for(int k= 0; k<benchCount; ++k){
+                isCase= isCase || isSelected(benchCases[k], arg);
+            }
+            if(!isCase){
+                cerr << "qhullbench error: unknown option or case '" << arg << "'.  Use 'qhullbench help' or 'qhullbench list'\n";
+                return 1;
+            }
+            selections.push_back(arg);
+        }
+    }
+    if(options.repeat<1 || options.scale<=0.0 || options.threshold<0.0){
+        cerr << "qhullbench error: expecting 'repeat' >= 1, 'scale' > 0, and 'threshold' >= 0.  Got " << options.repeat << ", " << options.scale << ", " << 100.0*options.threshold << "\n";
+        return 1;
+    }
+    vector<BenchResult> results;
+    for(int k= 0; k<benchCount; ++k){
+        const BenchCase &c= benchCases[k];
+        bool isSelectedCase= selections.empty();
+        for(size_t i= 0; i<selections.size(); ++i){
+            isSelectedCase= isSelectedCase || isSelected(c, selections[i]);
+        }
+        if(!isSelectedCase){
+            continue;
+        }
+        BenchResult r;
+        r.name= c.name;
+        r.input= benchRbox(c, options) + (*c.qhullOptions ? " | " : "") + c.qhullOptions;
+        r.ops= 0;
+        r.baseline= 0.0;
+        c.function(c, options, &r);
+        results.push_back(r);
+        if(strcmp(format, "text")==0){
+            cerr << c.name << " " << std::setprecision(3) << 1000.0*r.medianSeconds() << " ms\n";  // progress for long runs
+        }
+    }
+    if(baseline){
+        readBaseline(baseline, &results);
+    }
+    if(strcmp(format, "csv")==0){
+        printCsv(results, options, baseline!=NULL);
+    }else if(strcmp(format, "json")==0){
+        printJson(results, options, baseline!=NULL);
+    }else{
+        printText(results, options, baseline!=NULL);
+    }
+    for(size_t i= 0; i<results.size(); ++i){
+        if(strcmp(results[i].verdict(options.threshold), "slower")==0){
+            return 1;
+        }
+    }
+    return 0;
+}//qhullbench
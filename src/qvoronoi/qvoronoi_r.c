@@ -82,6 +82,7 @@ T options:\n\
     TFn  - report summary when n or more facets created\n\
     TI file - input file, may be enclosed in single quotes\n\
     TO file - output file, may be enclosed in single quotes\n\
+    Tj   - JSON profile of wall-clock time by phase\n\
     Ts   - statistics\n\
     Tv   - verify result: structure, convexity, and in-circle test\n\
     Tz   - send all output to stdout\n\
@@ -236,8 +237,8 @@ Except for 'F.' and 'PG', upper-case options take an argument.\n\
  Qallow-short   QG-vertex-good QRotate        Qsearch-all    Qupper-voronoi\n\
  QV-point-good  Qwarn-allow    Qzinfinite     Q12-allow-wide Q14-merge-pinched\n\
 \n\
- TFacet-log     TInput-file    TOutput-file   Tstatistics    Tverify\n\
- Tz-stdout\n\
+ TFacet-log     TInput-file    Tjson-profile  TOutput-file   Tstatistics\n\
+ Tverify        Tz-stdout\n\
 \n\
  T4-trace       Tannotate      TAdd-stop      Tcheck-often   TCone-stop\n\
  Tflush         TMerge-trace   TPoint-trace   TVertex-stop   TWide-trace\n\
@@ -308,6 +309,8 @@ int main(int argc, char *argv[]) {
     qh_produce_output(qh);
     if (qh->VERIFYoutput && !qh->FORCEoutput && !qh->STOPpoint && !qh->STOPcone)
       qh_check_points(qh);
+    if (qh->PRINTprofile)
+      qh_printprofile(qh, qh->ferr);
     exitcode= qh_ERRnone;
   }
   qh->NOerrexit= True;  /* no more setjmp */
@@ -51,6 +51,8 @@ args (any order, space separated):                    Version: 2019/11/10\n\
   On      offset coordinates by n\n\
   t       use time as the random number seed(default is command line)\n\
   tn      use n as the random number seed\n\
+  X       use counter-based random numbers.  Point i is independent of other points\n\
+  Xn      same as 'X' with n threads.  Same points for all n\n\
   z       print integer coordinates, default 'Bn' is %2.2g\n\
 ";
 /* Not including 'V' for rbox version, clumsy coordination with rboxlib_r.c */
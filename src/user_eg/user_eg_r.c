@@ -20,7 +20,7 @@
                                          # 'v' returns Voronoi
                                          # transform is rotated for halfspaces
 
-   main() makes three runs of qhull.
+   main() makes four runs of qhull.
 
      1) compute the convex hull of a cube
 
@@ -30,6 +30,8 @@
 
      3) compute the halfspace intersection of a diamond
 
+     4) compute the convex hull of random points in a file with a small memory limit
+
  notes:
 
    For another example, see main() in unix_r.c and user_eg2_r.c.
@@ -55,6 +57,7 @@ void makecube(coordT *points, int numpoints, int dim);
 void makeDelaunay(qhT *qh, coordT *points, int numpoints, int dim, int seed);
 void findDelaunay(qhT *qh, int dim);
 void makehalf(coordT *points, int numpoints, int dim);
+void makeoutofcore(qhT *qh, FILE *fp, coordT *points, int numpoints, int dim, int seed);
 
 /*-------------------------------------------------
 -print_summary(qh)
@@ -169,18 +172,42 @@ void makehalf(coordT *points, int numpoints, int dim) {
   }
 } /*.makehalf.*/
 
+/*--------------------------------------------------
+-makeoutofcore- set points to random points in a dim cube and write them to fp
+  points is numpoints X dim
+  fp is a binary file of coordT for qh_new_qhull_outofcore
+*/
+void makeoutofcore(qhT *qh, FILE *fp, coordT *points, int numpoints, int dim, int seed) {
+  int j,k;
+  coordT *point, realr;
+
+  qh_RANDOMseed_(qh, seed);
+  for (j=0; j<numpoints; j++) {
+    point= points + j*dim;
+    for (k=0; k < dim; k++) {
+      realr= qh_RANDOMint;
+      point[k]= 2.0 * realr/(qh_RANDOMmax+1) - 1.0;
+    }
+  }
+  fwrite(points, sizeof(coordT), (size_t)(numpoints*dim), fp);
+  fflush(fp);
+} /*.makeoutofcore.*/
+
 #define DIM 3     /* dimension of points, must be < 31 for SIZEcube */
 #define SIZEcube (1<<DIM)
 #define SIZEdiamond (2*DIM)
 #define TOTpoints (SIZEcube + SIZEdiamond)
+#define SIZEoutofcore 1000  /* random points for qh_new_qhull_outofcore */
+#define MEMoutofcore 100000 /* memory limit in bytes, about 100 3-d points per chunk */
 
 /*--------------------------------------------------
 -main- derived from Qhull-template in user_r.c
 
   see program header
 
-  this contains three runs of Qhull for convex hull, Delaunay
-  triangulation or Voronoi vertices, and halfspace intersection
+  this contains four runs of Qhull for convex hull, Delaunay
+  triangulation or Voronoi vertices, halfspace intersection, and
+  an out-of-core convex hull
 
 */
 int main(int argc, char *argv[]) {
@@ -188,6 +215,11 @@ int main(int argc, char *argv[]) {
   int numpoints;            /* number of points */
   coordT points[(DIM+1)*TOTpoints]; /* array of coordinates for each point */
   coordT *rows[TOTpoints];
+  coordT oocpoints[DIM*SIZEoutofcore]; /* points written to pointfile for Run 4 */
+  char isvertex[SIZEoutofcore];  /* true if a vertex of the in-memory convex hull */
+  FILE *pointfile;          /* binary file of points for qh_new_qhull_outofcore() */
+  vertexT *vertex;          /* set by FORALLvertices */
+  ptr_intT id;              /* input id of a vertex from qh_pointid_input() */
   bool ismalloc= false;    /* true if qhull should free points in qh_freeqhull() or reallocation */
   char flags[250];          /* option flags for qhull, see qh-quick.htm */
   FILE *outfile= stdout;    /* output from qh_produce_output()
@@ -196,7 +228,7 @@ int main(int argc, char *argv[]) {
   int exitcode;             /* 0 if no error from qhull */
   facetT *facet;            /* set by FORALLfacets */
   int curlong, totlong;     /* memory remaining after qh_memfreeshort, used if !qh_NOmem  */
-  int i;
+  int i, numvertices, nummatched;
 
   qhT qh_qh;                /* Qhull's data structure.  First argument of most calls */
   qhT *qh= &qh_qh;
@@ -346,6 +378,68 @@ Try -- user_eg 'T1' 'T1' 'T1'\n\
   if (curlong || totlong)  /* could also check previous runs */
     fprintf(stderr, "qhull internal warning (user_eg, #3): did not free %d bytes of long memory (%d pieces)\n",
        totlong, curlong);
+#endif
+  if (exitcode)
+    return exitcode;
+
+  /*
+    Run 4: out-of-core convex hull of points in a binary file
+  */
+  printf( "\n========\ncompute convex hull of %d points in a file with a memory limit of %d bytes\n", SIZEoutofcore, MEMoutofcore);
+  if (!(pointfile= tmpfile())) {
+    fprintf(errfile, "user_eg: cannot open a temporary file for qh_new_qhull_outofcore\n");
+    return qh_ERRother;
+  }
+  makeoutofcore(qh, pointfile, oocpoints, SIZEoutofcore, dim, 1);
+  memset(isvertex, 0, (size_t)SIZEoutofcore);
+  numvertices= 0;
+  sprintf(flags, "qhull Tcv");
+  exitcode= qh_new_qhull(qh, dim, SIZEoutofcore, oocpoints, ismalloc,
+                      flags, NULL, errfile);
+  if (!exitcode) {
+    FORALLvertices {
+      isvertex[qh_pointid(qh, vertex->point)]= 1;
+      numvertices++;
+    }
+  }
+#ifdef qh_NOmem
+  qh_freeqhull(qh, qh_ALL);
+#else
+  qh_freeqhull(qh, !qh_ALL);
+  qh_memfreeshort(qh, &curlong, &totlong);
+#endif
+  if (!exitcode) {
+    sprintf(flags, "qhull s Tcv");
+    exitcode= qh_new_qhull_outofcore(qh, dim, pointfile, MEMoutofcore,
+                      flags, outfile, errfile);
+    fflush(NULL);
+  }
+  if (!exitcode) {
+    /* qh_pointid_input() is the index in pointfile.  qh_pointid() is the index of a surviving point */
+    nummatched= 0;
+    FORALLvertices {
+      id= qh_pointid_input(qh, vertex->point);
+      if (id >= 0 && id < SIZEoutofcore && isvertex[id])
+        nummatched++;
+    }
+    if (nummatched == numvertices && qh->num_vertices == numvertices)
+      printf("\n%d surviving points and %d vertices.  The vertices are the same as the in-memory convex hull\n",
+        qh->num_points, qh->num_vertices);
+    else {
+      fprintf(errfile, "qhull internal error (user_eg, #4): %d of %d vertices are vertices of the in-memory convex hull.  It has %d vertices\n",
+        nummatched, qh->num_vertices, numvertices);
+      exitcode= qh_ERRqhull;
+    }
+  }
+  fclose(pointfile);
+#ifdef qh_NOmem
+  qh_freeqhull(qh, qh_ALL);
+#else
+  qh_freeqhull(qh, !qh_ALL);
+  qh_memfreeshort(qh, &curlong, &totlong);
+  if (curlong || totlong)
+    fprintf(stderr, "qhull internal warning (user_eg, #4): did not free %d bytes of long memory (%d pieces)\n",
+       totlong, curlong);
 #endif
   return exitcode;
 } /* main */
@@ -8,14 +8,23 @@
 #include "QhullFacetSet.h"
 #include "QhullLinkedList.h"
 #include "QhullPoint.h"
+#ifdef QHULL_USES_MOVE
+#include "QhullPool.h"
+#endif
 #include "QhullUser.h"
 #include "QhullVertex.h"
 #include "QhullVertexSet.h"
 #include "Qhull.h"
 
+#include <algorithm> // sort, swap
 #include <cstdio>   /* for printf() of help message */
+#include <ctime>    // clock
+#ifdef _OPENMP
+#include <omp.h>    // omp_get_wtime
+#endif
 #include <iomanip> // setw
 #include <ostream>
+#include <sstream>  // ostringstream
 #include <stdexcept>
 
 using std::cerr;
@@ -30,9 +39,13 @@ using orgQhull::QhullFacetList;
 using orgQhull::QhullFacetListIterator;
 using orgQhull::QhullFacetSet;
 using orgQhull::QhullFacetSetIterator;
+using orgQhull::QhullHyperplane;
 using orgQhull::QhullPoint;
 using orgQhull::QhullPoints;
 using orgQhull::QhullPointsIterator;
+#ifdef QHULL_USES_MOVE
+using orgQhull::QhullPool;
+#endif
 using orgQhull::QhullQh;
 using orgQhull::QhullUser;
 using orgQhull::QhullVertex;
@@ -57,6 +70,11 @@ Commands:\n\
   eg-delaunay          'rbox y c | qdelaunay o' with std::vector and C++ classes\n\
   eg-voronoi           'rbox y c | qvoronoi o' with std::vector and C++ classes\n\
   eg-fifo              'rbox y c | qvoronoi FN Fi Fo' with QhullUser and qh_fprintf\n\
+  eg-locate            Queries per second for qh_findbestfacet, locateDelaunay, and locateFacets\n\
+  eg-iterate           Nanoseconds per facet to visit facets and vertices via C++ classes and facetT\n\
+  eg-pool              Hulls per second for 10,000 hulls of 50-500 points via new Qhull, resetQhull, and QhullPool\n\
+  eg-extract           Milliseconds to extract 'qvoronoi Qt i o' via outputQhull or extractDelaunay and extractVoronoi\n\
+  eg-mesh              Milliseconds to export 'qdelaunay Qt' as compressed sparse rows via C++ classes or extractDelaunay\n\
 \n\
 Rbox and Qhull commands:\n\
   rbox \"200 D4\" ...    Generate points from rbox\n\
@@ -76,6 +94,11 @@ For example\n\
   user_eg3 rbox D5 c P2 qhull d eg-delaunay\n\
   user_eg3 rbox \"D5 c P2\" qhull v eg-voronoi o\n\
   user_eg3 rbox D2 10 qhull \"v\" eg-fifo p Fi Fo\n\
+  user_eg3 rbox 100000 D3 eg-locate\n\
+  user_eg3 rbox 500000 s eg-iterate\n\
+  user_eg3 rbox 100000 D4 eg-pool\n\
+  user_eg3 rbox 100000 D2 eg-extract\n\
+  user_eg3 rbox 100000 D3 qhull \"d Qt QP4\" eg-mesh\n\
 ";
 // single quotes OK in Unix but not OK in Windows cmd.exe
 
@@ -437,6 +460,429 @@ void qvoronoi_pfn(const Qhull &qhull)
     }
 }//qvoronoi_pfn
 
+//! Elapsed seconds.  CPU seconds if not OpenMP
+double wallSeconds()
+{
+#ifdef _OPENMP
+    return omp_get_wtime();
+#else
+    return double(clock())/CLOCKS_PER_SEC;
+#endif
+}//wallSeconds
+
+/***
+Locate random query points in a Delaunay triangulation
+    Compares qh_findbestfacet, which starts at qh.facet_list,
+    with Qhull::locateDelaunay, which starts from the point-location grid (qh_locatefacet)
+    and Qhull::locateFacets, which locates all points with 'QPn' threads (qh_query_locate_all)
+    The query points are 'rbox 100000 Dn t1', within the bounding box of 'rbox Dn'
+*/
+void qdelaunay_locate(Qhull *qhull)
+{
+    const int numQueries= 100000;
+    int dim= qhull->dimension();
+    char command[100];
+    sprintf(command, "%d D%d t1", numQueries, dim);
+    RboxPoints queries(command);
+    const coordT *coordinates= &*queries.coordinates();
+    std::vector<coordT> point(dim+1);
+    std::vector<facetT *> bestFacets(numQueries);
+    std::vector<facetT *> locateFacets(numQueries);
+    double bestDist;
+    bool isOutside;
+
+    cout << "\nLocate " << numQueries << " query points (rbox " << command << ") in the Delaunay triangulation of " << qhull->vertexCount() << " sites\n";
+    QhullQh *qh= qhull->qh();
+    clock_t start= clock();
+    QH_TRY_(qh){ // no object creation -- destructors skipped on longjmp()
+        for(int i= 0; i<numQueries; ++i){
+            for(int k= 0; k<dim; ++k){
+                point[k]= coordinates[i*dim+k];
+            }
+            qh_setdelaunay(qh, dim+1, 1, &point[0]);
+            bestFacets[i]= qh_findbestfacet(qh, &point[0], qh_ALL, &bestDist, &isOutside);
+        }
+    }
+    qh->NOerrexit= true;
+    qh->maybeThrowQhullMessage(QH_TRY_status);
+    double seconds= double(clock() - start)/CLOCKS_PER_SEC;
+    cout << "  qh_findbestfacet        " << std::setw(10) << (seconds>0 ? numQueries/seconds : 0.0) << " queries per second\n";
+
+    start= clock();
+    qhull->prepareLocate();
+    seconds= double(clock() - start)/CLOCKS_PER_SEC;
+    cout << "  Qhull::prepareLocate    " << std::setw(10) << seconds << " seconds\n";
+    int numSame= 0;
+    start= clock();
+    for(int i= 0; i<numQueries; ++i){
+        QhullFacet facet= qhull->locateDelaunay(coordinates+i*dim, &bestDist, &isOutside);
+        locateFacets[i]= facet.getFacetT();
+        if(facet.getFacetT()==bestFacets[i]){
+            numSame++;
+        }
+    }
+    seconds= double(clock() - start)/CLOCKS_PER_SEC;
+    cout << "  Qhull::locateDelaunay   " << std::setw(10) << (seconds>0 ? numQueries/seconds : 0.0) << " queries per second\n";
+    cout << "  " << numSame << " of " << numQueries << " queries returned the same facet as qh_findbestfacet.  Both return a locally best facet\n";
+
+    double wallStart= wallSeconds();
+    std::vector<QhullFacet> facets= qhull->locateFacets(dim, numQueries, coordinates, qh_ALL);
+    seconds= wallSeconds() - wallStart;
+    numSame= 0;
+    for(int i= 0; i<numQueries; ++i){
+        if(facets[i].getFacetT()==locateFacets[i]){
+            numSame++;
+        }
+    }
+    cout << "  Qhull::locateFacets     " << std::setw(10) << (seconds>0 ? numQueries/seconds : 0.0) << " queries per second with " << qhull->qhullCommand() << "\n";
+    cout << "  " << numSame << " of " << numQueries << " queries returned the same facet as locateDelaunay\n";
+}//qdelaunay_locate
+
+/***
+Visit all facets, hyperplanes, and vertices of a convex hull
+    Compares FORALLfacets/FOREACHvertex_ on facetT with the STL-style and Java-style iterators of QhullFacetList and QhullVertexSet,
+    and with per-facet toStdVector() that allocates a std::vector or reuses one
+    Reports nanoseconds per facet, the best of 5 passes.  The sums should be identical
+*/
+void qhull_iterate(const Qhull &qhull)
+{
+    const int numPasses= 5;
+    const char *passNames[]= { "facetT and FOREACHvertex_", "STL-style iterators", "Java-style iterators", "toStdVector()", "toStdVector(&vs)" };
+    const int numMethods= 5;
+    QhullQh *qh= qhull.qh();
+    QhullFacetList facets= qhull.facetList();
+    std::vector<QhullVertex> vs;
+    double sums[numMethods];
+    double best[numMethods];
+    countT numFacets= qhull.facetCount();
+
+    cout << "\nVisit the hyperplanes and vertices of " << numFacets << " facets for '" << qhull.qhullCommand() << "'\n";
+    for(int m= 0; m<numMethods; ++m){
+        best[m]= 0.0;
+        for(int pass= 0; pass<numPasses; ++pass){
+            double sum= 0.0;
+            double wallStart= wallSeconds();
+            if(m==0){
+                facetT *facet;
+                vertexT *vertex, **vertexp;
+                FORALLfacet_(qh->facet_list){
+                    sum += facet->normal[0] + facet->offset;
+                    FOREACHvertex_(facet->vertices){
+                        sum += vertex->point[0];
+                    }
+                }
+            }else if(m==1){
+                for(QhullFacetList::const_iterator f= facets.begin(); f!=facets.end(); ++f){
+                    QhullFacet facet= *f;
+                    QhullHyperplane h= facet.hyperplane();
+                    sum += h[0] + h.offset();
+                    QhullVertexSet vertices= facet.vertices();
+                    for(QhullVertexSet::const_iterator v= vertices.begin(); v!=vertices.end(); ++v){
+                        sum += (*v).point()[0];
+                    }
+                }
+            }else if(m==2){
+                QhullFacetListIterator f(facets);
+                while(f.hasNext()){
+                    QhullFacet facet= f.next();
+                    QhullHyperplane h= facet.hyperplane();
+                    sum += h[0] + h.offset();
+                    QhullVertexSetIterator v(facet.vertices());
+                    while(v.hasNext()){
+                        sum += v.next().point()[0];
+                    }
+                }
+            }else{
+                for(QhullFacetList::const_iterator f= facets.begin(); f!=facets.end(); ++f){
+                    QhullFacet facet= *f;
+                    QhullHyperplane h= facet.hyperplane();
+                    sum += h[0] + h.offset();
+                    if(m==3){
+                        vs= facet.vertices().toStdVector();
+                    }else{
+                        facet.vertices().toStdVector(&vs);
+                    }
+                    for(size_t k= 0; k<vs.size(); ++k){
+                        sum += vs[k].point()[0];
+                    }
+                }
+            }
+            double seconds= wallSeconds() - wallStart;
+            if(pass==0 || seconds<best[m]){
+                best[m]= seconds;
+            }
+            sums[m]= sum;
+        }
+        cout << "  " << std::left << std::setw(28) << passNames[m] << std::right << std::setw(10) << std::setprecision(4) << (numFacets ? best[m]*1e9/numFacets : 0.0) << " ns per facet";
+        if(m>0){
+            cout << "  " << std::setw(6) << std::setprecision(3) << (best[0]>0 ? best[m]/best[0] : 0.0) << "x";
+        }
+        cout << (sums[m]==sums[0] ? "" : "  (different sum)") << "\n";
+    }
+}//qhull_iterate
+
+// True if each Voronoi region of (offsetsA, idsA) is a rotation of the same region of (offsetsB, idsB)
+// For 3-d hulls, qh_order_vertexneighbors ('o', extractVoronoi) may start a region at a different Voronoi vertex each time
+bool sameRegions(const std::vector<countT> &offsetsA, const std::vector<countT> &idsA, const std::vector<countT> &offsetsB, const std::vector<countT> &idsB)
+{
+    if(offsetsA!=offsetsB || idsA.size()!=idsB.size()){
+        return false;
+    }
+    for(size_t i= 0; i+1<offsetsA.size(); ++i){
+        countT first= offsetsA[i];
+        countT n= offsetsA[i+1] - first;
+        countT shift= 0;
+        while(shift<n && idsB[first+shift]!=idsA[first]){
+            shift++;
+        }
+        for(countT j= 0; j<n; ++j){
+            if(shift==n || idsA[first+j]!=idsB[first+(j+shift)%n]){
+                return false;
+            }
+        }
+    }
+    return true;
+}//sameRegions
+
+/***
+Extract the Delaunay triangulation and Voronoi diagram of a 'v Qt Pp' hull into CSR arrays
+    Compares parsing the text output of 'i' and 'o' (outputQhull) with extractDelaunay and extractVoronoi
+    Reports milliseconds for each.  The point ids and Voronoi regions should be identical
+*/
+void qvoronoi_extract(Qhull *qhull)
+{
+    const char *methodNames[]= { "outputQhull 'i o', parse", "extractDelaunay/Voronoi" };
+    const int numMethods= 2;
+    std::vector<countT> simplices[numMethods];
+    std::vector<countT> regionOffsets[numMethods];
+    std::vector<countT> regionIds[numMethods];
+    std::vector<coordT> voronoiVertices[numMethods];
+    int dim= qhull->dimension();
+
+    cout << "\nExtract " << qhull->facetCount() << " facets and " << qhull->vertexCount() << " vertices of '" << qhull->qhullCommand() << "'\n";
+    for(int m= 0; m<numMethods; ++m){
+        double wallStart= wallSeconds();
+        if(m==0){
+            std::ostringstream os;
+            qhull->setOutputStream(&os);
+            qhull->outputQhull("i o");
+            qhull->setOutputStream(0);
+            qhull->clearQhullMessage(); // QH7053 for 'i' with 'v'.  outputQhull does not accept 'Pp'
+            std::istringstream is(os.str());
+            int numSimplices, numCenters, numSites, k;
+            is >> numSimplices;
+            simplices[m].resize(numSimplices*(dim+1));
+            for(size_t i= 0; i<simplices[m].size(); ++i){
+                is >> simplices[m][i];
+            }
+            is >> k >> numCenters >> numSites >> k;
+            voronoiVertices[m].resize((numCenters-1)*dim);
+            coordT infinity;
+            for(k= 0; k<dim; ++k){
+                is >> infinity;
+            }
+            for(size_t i= 0; i<voronoiVertices[m].size(); ++i){
+                is >> voronoiVertices[m][i];
+            }
+            regionOffsets[m].assign(1, 0);
+            regionIds[m].clear();
+            for(int i= 0; i<numSites; ++i){
+                int n, id;
+                is >> n;
+                for(int j= 0; j<n; ++j){
+                    is >> id;
+                    regionIds[m].push_back(id-1);
+                }
+                regionOffsets[m].push_back(static_cast<countT>(regionIds[m].size()));
+            }
+        }else{
+            qhull->extractDelaunay(&simplices[m]);
+            qhull->extractVoronoi(&voronoiVertices[m], &regionOffsets[m], &regionIds[m]);
+        }
+        double seconds= wallSeconds() - wallStart;
+        cout << "  " << std::left << std::setw(28) << methodNames[m] << std::right << std::setw(10) << std::setprecision(4) << seconds*1e3 << " ms, "
+             << simplices[m].size()/(dim+1) << " simplices, " << voronoiVertices[m].size()/dim << " Voronoi vertices, " << regionIds[m].size() << " region ids";
+        if(m>0){
+            cout << ((simplices[m]==simplices[0] && sameRegions(regionOffsets[m], regionIds[m], regionOffsets[0], regionIds[0])) ? "" : "  (different ids)");
+        }
+        cout << "\n";
+    }
+}//qvoronoi_extract
+
+/***
+Export the Delaunay triangulation of a 'd Qt' hull as a mesh of compressed sparse rows
+    simplex-to-site ids, simplex neighbors (-1 for the boundary), and the simplices of each site
+    Compares QhullFacetList/QhullVertexSet with extractDelaunay.  The arrays should be identical
+*/
+void qdelaunay_mesh(Qhull *qhull)
+{
+    const char *methodNames[]= { "QhullFacetList, QhullVertexSet", "extractDelaunay" };
+    const int numMethods= 2;
+    std::vector<countT> simplices[numMethods];
+    std::vector<countT> neighborIds[numMethods];
+    std::vector<countT> siteOffsets[numMethods];
+    std::vector<countT> siteSimplices[numMethods];
+    int dim= qhull->hullDimension();
+
+    cout << "\nMesh of " << qhull->facetCount() << " facets and " << qhull->points().count() << " sites for '" << qhull->qhullCommand() << "'\n";
+    qhull->defineVertexNeighborFacets();
+    for(int m= 0; m<numMethods; ++m){
+        double wallStart= wallSeconds();
+        if(m==0){
+            std::vector<countT> simplexIndex(qhull->qh()->facet_id, -1); // by facet id
+            countT numSimplices= 0;
+            simplices[m].clear();
+            QhullFacetList facets= qhull->facetList();
+            for(QhullFacetList::const_iterator f= facets.begin(); f!=facets.end(); ++f){
+                if(!(*f).isUpperDelaunay()){
+                    simplexIndex[(*f).id()]= numSimplices++;
+                }
+            }
+            neighborIds[m].clear();
+            for(QhullFacetList::const_iterator f= facets.begin(); f!=facets.end(); ++f){
+                QhullFacet facet= *f;
+                if(facet.isUpperDelaunay()){
+                    continue;
+                }
+                size_t first= simplices[m].size();
+                QhullVertexSet vertices= facet.vertices();
+                for(QhullVertexSet::const_iterator v= vertices.begin(); v!=vertices.end(); ++v){
+                    simplices[m].push_back((*v).point().id());
+                }
+                QhullFacetSet neighbors= facet.neighborFacets();
+                for(QhullFacetSet::const_iterator n= neighbors.begin(); n!=neighbors.end(); ++n){
+                    neighborIds[m].push_back(simplexIndex[(*n).id()]);
+                }
+                if(!(facet.isTopOrient() ^ qh_ORIENTclock)){ // as 'i'
+                    std::swap(simplices[m][first], simplices[m][first+1]);
+                    std::swap(neighborIds[m][first], neighborIds[m][first+1]);
+                }
+            }
+            countT numSites= qhull->points().count();
+            std::vector<QhullVertex> siteVertices(numSites);
+            QhullVertexList vertices= qhull->vertexList();
+            for(QhullVertexList::const_iterator v= vertices.begin(); v!=vertices.end(); ++v){
+                siteVertices[(*v).point().id()]= *v;
+            }
+            siteOffsets[m].assign(1, 0);
+            siteSimplices[m].clear();
+            for(countT i= 0; i<numSites; ++i){
+                if(siteVertices[i].isValid()){
+                    size_t first= siteSimplices[m].size();
+                    QhullFacetSet neighbors= siteVertices[i].neighborFacets();
+                    for(QhullFacetSet::const_iterator n= neighbors.begin(); n!=neighbors.end(); ++n){
+                        if(!(*n).isUpperDelaunay()){
+                            siteSimplices[m].push_back(simplexIndex[(*n).id()]);
+                        }
+                    }
+                    std::sort(siteSimplices[m].begin()+first, siteSimplices[m].end());
+                }
+                siteOffsets[m].push_back(static_cast<countT>(siteSimplices[m].size()));
+            }
+        }else{
+            qhull->extractDelaunay(&simplices[m], &neighborIds[m], &siteOffsets[m], &siteSimplices[m]);
+        }
+        double seconds= wallSeconds() - wallStart;
+        cout << "  " << std::left << std::setw(32) << methodNames[m] << std::right << std::setw(10) << std::setprecision(4) << seconds*1e3 << " ms, "
+             << simplices[m].size()/dim << " simplices";
+        if(m>0){
+            cout << ((simplices[m]==simplices[0] && neighborIds[m]==neighborIds[0] && siteOffsets[m]==siteOffsets[0] && siteSimplices[m]==siteSimplices[0]) ? "" : "  (different arrays)");
+        }
+        cout << "\n";
+    }
+}//qdelaunay_mesh
+
+/***
+Build many small, independent hulls
+    Hull i has 50 to 500 consecutive points from 'sites', starting at a pseudo-random site
+    Compares a new Qhull for each hull, one Qhull reused by resetQhull, and a QhullPool of warm Qhull
+    QhullPool runs the hulls with OpenMP threads, if available.  Each thread acquires and releases a Qhull
+    Reports hulls per second.  The total number of facets should be identical
+    Requires QHULL_USES_MOVE (C++11) for QhullPool
+*/
+#ifdef QHULL_USES_MOVE
+void qhull_pool(const RboxPoints &sites, int numHulls)
+{
+    const int minPoints= 50;
+    const int maxPoints= 500;
+    const char *methodNames[]= { "new Qhull", "Qhull::resetQhull", "QhullPool" };
+    const int numMethods= 3;
+    int dim= sites.dimension();
+    countT numSites= sites.count();
+    const coordT *coordinates= &*sites.coordinates();
+    std::vector<countT> firstSite(numHulls);
+    std::vector<int> numPoints(numHulls);
+    countT totalPoints= 0;
+    int numThreads= 1;
+#ifdef _OPENMP
+    numThreads= omp_get_max_threads();
+#endif
+
+    if(numSites<=maxPoints){
+        cerr << "user_eg3 eg-pool: expecting more than " << maxPoints << " points.  Got " << numSites << endl;
+        return;
+    }
+    for(int i= 0; i<numHulls; ++i){
+        numPoints[i]= minPoints + (i*37) % (maxPoints-minPoints+1);
+        firstSite[i]= static_cast<countT>((i*7919LL) % (numSites-numPoints[i]));
+        totalPoints += numPoints[i];
+    }
+    cout << "\n" << numHulls << " hulls of " << minPoints << " to " << maxPoints << " points (" << totalPoints << " total) from " << sites.comment() << "\n";
+    for(int m= 0; m<numMethods; ++m){
+        countT numFacets= 0;
+        countT numErrors= 0;
+        double wallStart= wallSeconds();
+        if(m==0){
+            for(int i= 0; i<numHulls; ++i){
+                Qhull q("", dim, numPoints[i], coordinates+firstSite[i]*dim, "");
+                numFacets += q.facetCount();
+            }
+        }else if(m==1){
+            Qhull q;
+            for(int i= 0; i<numHulls; ++i){
+                q.resetQhull();
+                q.runQhull("", dim, numPoints[i], coordinates+firstSite[i]*dim, "");
+                numFacets += q.facetCount();
+            }
+        }else{
+            QhullPool pool(numThreads, dim);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(numThreads) schedule(dynamic, 16) reduction(+:numFacets, numErrors)
+#endif
+            for(int i= 0; i<numHulls; ++i){
+                try{
+                    Qhull q= pool.acquire();
+                    q.runQhull("", dim, numPoints[i], coordinates+firstSite[i]*dim, "");
+                    numFacets += q.facetCount();
+                    pool.release(std::move(q));
+                }catch(const std::exception &e){
+                    numErrors++;
+                }
+            }
+            if(pool.newCount()){
+                cout << "  QhullPool constructed " << pool.newCount() << " additional Qhull\n";
+            }
+        }
+        double seconds= wallSeconds() - wallStart;
+        cout << "  " << std::left << std::setw(20) << methodNames[m] << std::right << std::setw(10) << std::setprecision(5) << (seconds>0 ? numHulls/seconds : 0.0) << " hulls per second, " << numFacets << " facets";
+        if(m==2){
+            cout << ", " << numThreads << " threads";
+        }
+        if(numErrors){
+            cout << ", " << numErrors << " errors";
+        }
+        cout << "\n";
+    }
+}//qhull_pool
+#else
+void qhull_pool(const RboxPoints &sites, int numHulls)
+{
+    QHULL_UNUSED(sites)
+    QHULL_UNUSED(numHulls)
+    cerr << "user_eg3 eg-pool: QhullPool requires C++11 (QHULL_USES_MOVE).  Compile user_eg3 with -std=c++11 or later" << endl;
+}//qhull_pool
+#endif //QHULL_USES_MOVE
+
 int user_eg3(int argc, char **argv)
 {
     bool printFacets= false;
@@ -580,6 +1026,52 @@ int user_eg3(int argc, char **argv)
             qvoronoi_fifo(&q, "Fi");
             cout << "\nThe same result as 'qhull v Fo' using QhullUser and its custom qh_fprintf\n";
             qvoronoi_fifo(&q, "Fo");
+        }else if(strcmp(argv[i], "eg-locate")==0 && readingQhull>1 && qhull.isDelaunay()){
+            qdelaunay_locate(&qhull);
+        }else if(strcmp(argv[i], "eg-locate")==0 && !rbox.isEmpty()){
+            Qhull q(rbox, "d Qbb Qt");
+            qdelaunay_locate(&q);
+            noRboxOutput= true;
+        }else if(strcmp(argv[i], "eg-locate")==0){
+            RboxPoints sites("100000 D2");
+            Qhull q(sites, "d Qbb Qt");
+            qdelaunay_locate(&q);
+        }else if(strcmp(argv[i], "eg-iterate")==0 && readingQhull>1){
+            qhull_iterate(qhull);
+        }else if(strcmp(argv[i], "eg-iterate")==0 && !rbox.isEmpty()){
+            Qhull q(rbox, "");
+            qhull_iterate(q);
+            noRboxOutput= true;
+        }else if(strcmp(argv[i], "eg-iterate")==0){
+            RboxPoints sites("500000 s");
+            Qhull q(sites, "");
+            qhull_iterate(q);
+        }else if(strcmp(argv[i], "eg-pool")==0 && !rbox.isEmpty()){
+            qhull_pool(rbox, 10000);
+            noRboxOutput= true;
+        }else if(strcmp(argv[i], "eg-pool")==0){
+            RboxPoints sites("100000 D3");
+            qhull_pool(sites, 10000);
+        }else if(strcmp(argv[i], "eg-extract")==0 && readingQhull>1 && qhull.isDelaunay()){
+            qvoronoi_extract(&qhull);
+        }else if(strcmp(argv[i], "eg-extract")==0 && !rbox.isEmpty()){
+            Qhull q(rbox, "v Qt Pp");
+            qvoronoi_extract(&q);
+            noRboxOutput= true;
+        }else if(strcmp(argv[i], "eg-extract")==0){
+            RboxPoints sites("100000 D2");
+            Qhull q(sites, "v Qt Pp");
+            qvoronoi_extract(&q);
+        }else if(strcmp(argv[i], "eg-mesh")==0 && readingQhull>1 && qhull.isDelaunay()){
+            qdelaunay_mesh(&qhull);
+        }else if(strcmp(argv[i], "eg-mesh")==0 && !rbox.isEmpty()){
+            Qhull q(rbox, "d Qt");
+            qdelaunay_mesh(&q);
+            noRboxOutput= true;
+        }else if(strcmp(argv[i], "eg-mesh")==0){
+            RboxPoints sites("100000 D3");
+            Qhull q(sites, "d Qt");
+            qdelaunay_mesh(&q);
         }else if(strcmp(argv[i], "rbox")==0){
             if(readingRbox!=0 || readingQhull!=0){
                 cerr << "user_eg3 -- \"rbox\" must be first" << endl;
@@ -631,7 +1123,7 @@ int user_eg3(int argc, char **argv)
                 qhull.clearQhullMessage();
             }
         }else{
-            cerr << "user_eg3 error: Expecting eg-100, eg-convex, eg-delaunay, eg-voronoi, eg-fifo, qhull, qhull-cout, or rbox.  Got " << argv[i] << endl;
+            cerr << "user_eg3 error: Expecting eg-100, eg-convex, eg-delaunay, eg-voronoi, eg-fifo, eg-locate, eg-iterate, eg-pool, eg-extract, eg-mesh, qhull, qhull-cout, or rbox.  Got " << argv[i] << endl;
             return 1;
         }
     }//foreach argv